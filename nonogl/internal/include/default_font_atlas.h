@@ -0,0 +1,624 @@
+#ifndef _NN_DEFAULT_FONT_ATLAS_H
+#define _NN_DEFAULT_FONT_ATLAS_H
+
+// Generated by tools/bakefont.c, do not edit
+
+#define _NN_DEFAULT_FONT_SIZE 24
+#define _NN_DEFAULT_FONT_ATLAS_WIDTH 256
+#define _NN_DEFAULT_FONT_ATLAS_HEIGHT 128
+
+static const stbtt_packedchar _nnDefaultFontCharData[96] = {
+    {1, 1, 1, 1, 0.0f, 0.0f, 5.06999969f, 0.0f, 0.0f},
+    {2, 1, 5, 17, 1.0f, -15.0f, 5.26999998f, 4.0f, 1.0f},
+    {6, 1, 11, 7, 1.0f, -16.0f, 6.54999971f, 6.0f, -10.0f},
+    {12, 1, 24, 16, 1.0f, -15.0f, 12.6099997f, 13.0f, 0.0f},
+    {25, 1, 35, 21, 1.0f, -17.0f, 11.5f, 11.0f, 3.0f},
+    {36, 1, 50, 17, 1.0f, -15.0f, 15.0f, 15.0f, 1.0f},
+    {51, 1, 63, 17, 1.0f, -15.0f, 12.7299995f, 13.0f, 1.0f},
+    {64, 1, 66, 7, 1.0f, -16.0f, 3.56999993f, 3.0f, -10.0f},
+    {67, 1, 73, 23, 1.0f, -17.0f, 7.0f, 7.0f, 5.0f},
+    {74, 1, 80, 23, 0.0f, -17.0f, 7.11999989f, 6.0f, 5.0f},
+    {81, 1, 90, 10, 0.0f, -15.0f, 8.81999969f, 9.0f, -6.0f},
+    {91, 1, 102, 13, 0.0f, -13.0f, 11.6099997f, 11.0f, -1.0f},
+    {103, 1, 107, 7, 0.0f, -3.0f, 4.01999998f, 4.0f, 3.0f},
+    {108, 1, 114, 3, 0.0f, -7.0f, 5.6500001f, 6.0f, -5.0f},
+    {115, 1, 118, 5, 1.0f, -3.0f, 5.38999987f, 4.0f, 1.0f},
+    {119, 1, 127, 18, 0.0f, -15.0f, 8.43999958f, 8.0f, 2.0f},
+    {128, 1, 138, 17, 1.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {139, 1, 146, 16, 1.0f, -15.0f, 11.5f, 8.0f, 0.0f},
+    {147, 1, 158, 16, 0.0f, -15.0f, 11.5f, 11.0f, 0.0f},
+    {159, 1, 170, 17, 0.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {171, 1, 183, 16, 0.0f, -15.0f, 11.5f, 12.0f, 0.0f},
+    {184, 1, 194, 17, 1.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {195, 1, 205, 17, 1.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {206, 1, 217, 16, 0.0f, -15.0f, 11.5f, 11.0f, 0.0f},
+    {218, 1, 228, 17, 1.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {229, 1, 239, 17, 1.0f, -15.0f, 11.5f, 11.0f, 1.0f},
+    {240, 1, 243, 13, 1.0f, -11.0f, 4.96000004f, 4.0f, 1.0f},
+    {244, 1, 248, 15, 0.0f, -11.0f, 4.32999992f, 4.0f, 3.0f},
+    {1, 24, 10, 34, 0.0f, -11.0f, 10.4099998f, 9.0f, -1.0f},
+    {11, 24, 20, 31, 1.0f, -10.0f, 11.2399998f, 10.0f, -3.0f},
+    {21, 24, 30, 34, 1.0f, -11.0f, 10.6999998f, 10.0f, -1.0f},
+    {31, 24, 40, 40, 0.0f, -15.0f, 9.67000008f, 9.0f, 1.0f},
+    {41, 24, 58, 44, 1.0f, -15.0f, 18.3899994f, 18.0f, 5.0f},
+    {59, 24, 73, 39, 0.0f, -15.0f, 13.3599997f, 14.0f, 0.0f},
+    {74, 24, 85, 39, 1.0f, -15.0f, 12.75f, 12.0f, 0.0f},
+    {86, 24, 98, 40, 1.0f, -15.0f, 13.3299999f, 13.0f, 1.0f},
+    {99, 24, 111, 39, 1.0f, -15.0f, 13.4299994f, 13.0f, 0.0f},
+    {112, 24, 122, 39, 1.0f, -15.0f, 11.6399994f, 11.0f, 0.0f},
+    {123, 24, 133, 39, 1.0f, -15.0f, 11.3199997f, 11.0f, 0.0f},
+    {134, 24, 146, 40, 1.0f, -15.0f, 13.9499998f, 13.0f, 1.0f},
+    {147, 24, 159, 39, 1.0f, -15.0f, 14.5999994f, 13.0f, 0.0f},
+    {160, 24, 163, 39, 1.0f, -15.0f, 5.56999969f, 4.0f, 0.0f},
+    {164, 24, 174, 40, 0.0f, -15.0f, 11.3000002f, 10.0f, 1.0f},
+    {175, 24, 187, 39, 1.0f, -15.0f, 12.8400002f, 13.0f, 0.0f},
+    {188, 24, 198, 39, 1.0f, -15.0f, 11.0199995f, 11.0f, 0.0f},
+    {199, 24, 215, 39, 1.0f, -15.0f, 17.8799992f, 17.0f, 0.0f},
+    {216, 24, 228, 39, 1.0f, -15.0f, 14.5999994f, 13.0f, 0.0f},
+    {229, 24, 241, 40, 1.0f, -15.0f, 14.0799999f, 13.0f, 1.0f},
+    {242, 24, 254, 39, 1.0f, -15.0f, 12.9200001f, 13.0f, 0.0f},
+    {1, 45, 13, 63, 1.0f, -15.0f, 14.0799999f, 13.0f, 3.0f},
+    {14, 45, 26, 60, 1.0f, -15.0f, 12.6099997f, 13.0f, 0.0f},
+    {27, 45, 39, 61, 0.0f, -15.0f, 12.1499996f, 12.0f, 1.0f},
+    {40, 45, 52, 60, 0.0f, -15.0f, 12.2199993f, 12.0f, 0.0f},
+    {53, 45, 64, 61, 1.0f, -15.0f, 13.2799997f, 12.0f, 1.0f},
+    {65, 45, 78, 60, 0.0f, -15.0f, 13.0299997f, 13.0f, 0.0f},
+    {79, 45, 97, 60, 0.0f, -15.0f, 18.1700001f, 18.0f, 0.0f},
+    {98, 45, 111, 60, 0.0f, -15.0f, 12.8400002f, 13.0f, 0.0f},
+    {112, 45, 125, 60, 0.0f, -15.0f, 12.3000002f, 13.0f, 0.0f},
+    {126, 45, 138, 60, 0.0f, -15.0f, 12.2599993f, 12.0f, 0.0f},
+    {139, 45, 144, 66, 1.0f, -17.0f, 5.42999983f, 6.0f, 4.0f},
+    {145, 45, 154, 62, 0.0f, -15.0f, 8.39999962f, 9.0f, 2.0f},
+    {155, 45, 159, 66, 0.0f, -17.0f, 5.42999983f, 4.0f, 4.0f},
+    {160, 45, 168, 53, 0.0f, -15.0f, 8.55999947f, 8.0f, -7.0f},
+    {169, 45, 179, 47, 0.0f, 0.0f, 9.23999977f, 10.0f, 2.0f},
+    {180, 45, 185, 49, 0.0f, -16.0f, 6.32999992f, 5.0f, -12.0f},
+    {186, 45, 196, 58, 1.0f, -12.0f, 11.1399994f, 11.0f, 1.0f},
+    {197, 45, 207, 62, 1.0f, -16.0f, 11.4899998f, 11.0f, 1.0f},
+    {208, 45, 219, 58, 0.0f, -12.0f, 10.7199993f, 11.0f, 1.0f},
+    {220, 45, 231, 62, 0.0f, -16.0f, 11.5500002f, 11.0f, 1.0f},
+    {232, 45, 243, 58, 0.0f, -12.0f, 10.8499994f, 11.0f, 1.0f},
+    {244, 45, 252, 61, 0.0f, -16.0f, 7.10999966f, 8.0f, 0.0f},
+    {1, 67, 12, 84, 0.0f, -12.0f, 11.4899998f, 11.0f, 5.0f},
+    {13, 67, 22, 83, 1.0f, -16.0f, 11.2799997f, 10.0f, 0.0f},
+    {23, 67, 26, 82, 1.0f, -15.0f, 4.96999979f, 4.0f, 0.0f},
+    {27, 67, 32, 87, -1.0f, -15.0f, 4.88999987f, 4.0f, 5.0f},
+    {33, 67, 43, 83, 1.0f, -16.0f, 10.3800001f, 11.0f, 0.0f},
+    {44, 67, 47, 83, 1.0f, -16.0f, 4.96999979f, 4.0f, 0.0f},
+    {48, 67, 64, 79, 1.0f, -12.0f, 17.9499989f, 17.0f, 0.0f},
+    {65, 67, 74, 79, 1.0f, -12.0f, 11.3000002f, 10.0f, 0.0f},
+    {75, 67, 86, 80, 0.0f, -12.0f, 11.6799994f, 11.0f, 1.0f},
+    {87, 67, 97, 84, 1.0f, -12.0f, 11.4899998f, 11.0f, 5.0f},
+    {98, 67, 109, 84, 0.0f, -12.0f, 11.6399994f, 11.0f, 5.0f},
+    {110, 67, 116, 79, 1.0f, -12.0f, 6.92999983f, 7.0f, 0.0f},
+    {117, 67, 127, 80, 0.0f, -12.0f, 10.5599995f, 10.0f, 1.0f},
+    {128, 67, 134, 82, 0.0f, -14.0f, 6.69000006f, 6.0f, 1.0f},
+    {135, 67, 144, 79, 1.0f, -11.0f, 11.29f, 10.0f, 1.0f},
+    {145, 67, 155, 78, 0.0f, -11.0f, 9.92000008f, 10.0f, 0.0f},
+    {156, 67, 171, 78, 0.0f, -11.0f, 15.3899994f, 15.0f, 0.0f},
+    {172, 67, 182, 78, 0.0f, -11.0f, 10.1499996f, 10.0f, 0.0f},
+    {183, 67, 193, 83, 0.0f, -11.0f, 9.68999958f, 10.0f, 5.0f},
+    {194, 67, 204, 78, 0.0f, -11.0f, 10.1499996f, 10.0f, 0.0f},
+    {205, 67, 212, 87, 0.0f, -16.0f, 6.92999983f, 7.0f, 4.0f},
+    {213, 67, 216, 85, 1.0f, -15.0f, 4.98999977f, 4.0f, 3.0f},
+    {217, 67, 224, 87, 0.0f, -16.0f, 6.92999983f, 7.0f, 4.0f},
+    {225, 67, 237, 72, 1.0f, -9.0f, 13.9299994f, 13.0f, -4.0f},
+    {238, 67, 246, 82, 1.0f, -15.0f, 9.07999992f, 9.0f, 0.0f},
+};
+
+static const unsigned char _nnDefaultFontAtlas[32768] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,47,143,87,0,58,71,0,85,43,0,0,0,0,0,62,140,2,0,52,143,11,0,0,0,0,0,0,178,171,0,0,0,0,0,0,42,143,148,47,0,0,0,0,0,0,0,0,0,0,0,0,4,73,161,134,44,0,0,0,0,0,0,
+88,49,0,0,0,0,0,6,26,0,27,6,0,0,0,0,0,0,0,0,46,143,27,0,0,0,0,0,0,0,0,2,15,11,0,0,0,0,0,0,35,48,4,0,151,240,240,240,240,60,0,0,6,0,0,0,0,0,0,0,0,121,105,0,
+0,0,53,134,179,158,107,7,0,0,0,0,0,0,0,22,113,47,0,0,0,0,74,146,180,125,40,0,0,0,0,0,0,0,15,98,176,158,99,4,0,0,0,0,0,0,0,0,0,19,142,143,3,0,0,0,0,33,143,143,143,143,143,143,
+143,37,0,0,0,0,0,17,65,114,68,0,0,0,33,143,143,143,143,143,143,143,143,143,87,0,0,0,9,83,166,127,39,0,0,0,0,0,0,58,127,179,141,64,0,0,0,0,79,211,77,0,0,127,205,35,0,0,0,0,0,0,0,0,
+0,0,81,255,152,0,161,196,0,238,120,0,0,0,0,0,150,214,0,0,132,235,0,0,0,0,0,0,0,194,186,0,0,0,0,0,70,252,171,165,250,83,0,0,0,6,0,0,0,0,0,0,6,224,255,229,244,255,120,0,0,0,0,0,
+245,135,0,0,0,0,8,179,127,0,127,178,7,0,0,0,0,0,0,0,77,255,43,0,0,0,0,0,0,0,0,41,255,178,0,0,0,0,0,0,186,255,20,0,92,145,145,145,145,36,0,85,248,124,0,0,0,0,0,0,38,254,110,0,
+0,97,249,255,229,252,255,199,20,0,0,0,6,81,176,250,255,74,0,0,3,171,255,255,221,251,255,207,11,0,0,0,0,145,247,254,216,252,255,204,10,0,0,0,0,0,0,0,0,162,255,255,5,0,0,0,0,79,255,255,255,255,255,255,
+255,66,0,0,0,2,127,252,255,255,120,0,0,0,56,245,245,245,245,245,245,245,248,255,140,0,0,109,241,255,224,249,255,201,20,0,0,0,111,255,255,231,255,253,121,0,0,0,134,255,132,0,0,195,255,71,0,0,0,0,0,0,0,0,
+0,0,78,255,149,0,162,186,0,238,109,0,0,0,0,0,200,164,0,0,183,185,0,0,0,0,0,5,96,235,231,78,0,0,0,0,170,174,0,0,157,181,0,0,7,210,80,0,0,0,0,0,81,255,141,4,11,201,231,7,0,0,0,0,
+246,124,0,0,0,10,187,245,39,0,24,228,184,9,0,0,0,15,7,0,70,255,36,0,7,4,0,0,0,0,0,41,255,178,0,0,0,0,0,0,199,250,9,0,0,0,0,0,0,0,0,90,251,130,0,0,0,0,0,0,136,248,19,0,
+18,246,233,102,5,42,175,255,135,0,0,53,234,255,245,227,255,74,0,0,119,255,183,50,0,25,160,255,101,0,0,0,41,254,182,36,0,23,160,255,136,0,0,0,0,0,0,0,72,255,255,255,5,0,0,0,0,105,255,108,38,38,38,38,
+38,10,0,0,7,187,255,195,75,28,0,0,0,0,0,0,0,0,0,0,0,0,153,254,41,0,40,250,237,61,1,22,159,255,162,0,0,73,253,209,69,1,86,225,255,57,0,0,4,48,3,0,0,13,43,0,0,0,0,0,0,0,0,0,
+0,0,74,255,145,0,162,164,0,239,88,0,0,0,0,4,246,114,0,0,233,134,0,0,0,0,67,225,255,245,250,255,194,38,0,0,239,113,0,0,97,251,2,0,126,231,16,0,0,0,0,0,173,255,40,0,0,124,255,54,0,0,0,0,
+246,110,0,0,0,131,255,105,0,0,0,57,249,131,0,0,0,124,237,150,114,255,83,150,237,70,0,0,0,0,0,41,255,178,0,0,0,0,0,28,253,197,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,4,230,170,0,0,
+115,255,136,0,0,0,5,234,237,6,0,75,190,97,13,145,255,74,0,0,217,255,53,0,0,0,27,252,207,0,0,0,152,255,56,0,0,0,44,255,205,0,0,0,0,0,0,12,224,212,219,255,5,0,0,0,0,131,255,56,0,0,0,0,
+0,0,0,0,105,255,146,1,0,0,0,0,0,0,0,0,0,0,0,0,0,23,247,181,0,0,104,255,151,0,0,0,29,252,231,0,0,160,255,83,0,0,0,83,255,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,71,255,142,0,163,143,0,239,66,0,5,102,102,124,255,146,102,113,255,158,102,36,0,0,188,254,95,12,30,154,255,147,0,0,188,152,0,0,139,209,0,38,247,87,0,0,0,0,0,0,162,255,111,0,11,203,242,6,0,0,0,0,
+247,95,0,0,14,239,180,1,0,0,0,0,164,238,14,0,0,66,162,235,255,255,255,238,167,53,0,0,0,0,0,41,255,178,0,0,0,0,0,118,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,255,72,0,0,
+164,255,84,0,0,0,0,168,255,34,0,1,0,0,0,145,255,74,0,4,184,168,0,0,0,0,0,219,242,5,0,0,58,64,0,0,0,0,10,248,222,0,0,0,0,0,0,146,253,58,214,255,5,0,0,0,0,157,255,28,0,0,0,0,
+0,0,0,6,225,216,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,255,67,0,0,115,255,107,0,0,0,2,233,240,2,0,213,248,13,0,0,0,18,252,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,68,255,138,0,95,73,0,139,29,0,13,252,252,254,255,252,252,253,255,253,252,88,0,26,252,194,0,0,0,8,243,221,0,0,91,240,110,101,234,110,1,189,183,0,0,0,0,0,0,0,68,254,228,40,199,250,82,0,0,0,0,0,
+106,36,0,0,120,255,42,0,0,0,0,0,67,255,118,0,0,0,0,19,236,255,193,4,0,0,0,45,207,207,207,214,255,240,207,207,207,157,0,75,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,226,3,0,0,
+190,255,32,0,0,0,0,146,255,62,0,0,0,0,0,145,255,74,0,0,0,0,0,0,0,0,21,254,175,0,0,0,0,0,0,0,0,0,99,255,144,0,0,0,0,0,58,253,147,0,214,255,5,0,0,0,0,183,251,16,73,116,76,13,
+0,0,0,71,255,130,37,100,127,83,11,0,0,0,0,0,0,0,0,0,12,238,208,0,0,0,44,255,194,0,0,0,68,255,169,0,0,239,234,1,0,0,0,0,202,255,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,65,255,135,0,0,0,0,0,0,0,0,0,0,145,219,0,0,127,239,1,0,0,0,56,255,166,0,0,0,0,164,235,34,0,6,102,201,210,110,10,94,245,34,0,0,0,0,0,0,0,0,150,255,251,243,80,0,0,0,0,0,0,
+0,0,0,7,233,242,2,0,0,0,0,0,2,224,231,6,0,0,0,170,239,116,255,93,0,0,0,53,240,240,240,242,255,250,240,240,240,182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,250,131,0,0,0,
+213,255,0,0,0,0,0,131,255,85,0,0,0,0,0,145,255,74,0,0,0,0,0,0,0,0,147,255,86,0,0,0,0,0,5,46,67,149,237,209,30,0,0,0,0,7,214,226,13,0,214,255,5,0,0,0,0,209,253,250,255,255,255,221,
+53,0,0,104,255,176,248,255,255,255,213,36,0,0,0,0,0,0,0,0,113,255,95,0,0,0,0,150,254,186,94,137,232,228,45,0,0,191,255,51,0,0,0,0,191,255,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,62,255,131,0,0,0,0,0,0,0,0,0,0,195,170,0,0,177,190,0,0,0,0,1,221,247,27,0,0,0,0,0,0,0,0,0,0,0,0,19,234,119,0,0,0,0,0,0,0,0,2,152,255,255,126,0,0,0,0,0,0,0,
+0,0,0,44,255,193,0,0,0,0,0,0,0,152,255,43,0,0,100,255,102,0,181,242,37,0,0,0,0,0,0,41,255,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,254,34,0,0,0,
+217,255,0,0,0,0,0,130,255,87,0,0,0,0,0,145,255,74,0,0,0,0,0,0,0,83,255,165,0,0,0,0,0,0,26,255,255,255,233,21,0,0,0,0,0,131,255,76,0,0,214,255,5,0,0,0,0,190,240,140,69,100,207,255,
+224,9,0,135,255,255,136,42,54,178,255,157,0,0,0,0,0,0,0,5,225,230,6,0,0,0,0,1,190,255,255,255,253,56,0,0,0,135,255,149,4,0,0,104,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,59,255,128,0,0,0,0,0,0,0,0,0,2,243,120,0,0,227,140,0,0,0,0,0,126,255,242,133,19,0,0,0,0,0,0,0,0,0,0,158,210,5,5,83,106,17,0,0,0,6,169,255,162,227,250,65,0,0,171,142,0,0,
+0,0,0,80,255,142,0,0,0,0,0,0,0,122,255,78,0,0,35,145,1,0,30,162,15,0,0,0,0,0,0,41,255,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,214,190,0,0,0,0,
+217,255,0,0,0,0,0,130,255,86,0,0,0,0,0,145,255,74,0,0,0,0,0,0,49,241,218,13,0,0,0,0,0,0,8,84,104,180,247,218,52,0,0,0,46,250,168,0,0,0,214,255,5,0,0,0,0,0,4,0,0,0,0,205,
+255,100,0,165,255,143,0,0,0,0,220,236,5,0,0,0,0,0,0,93,255,122,0,0,0,0,10,167,253,187,98,144,235,232,62,0,0,14,212,255,219,128,191,248,237,246,1,0,0,6,0,0,0,30,48,10,0,0,0,0,0,0,0,0,
+0,0,55,255,125,0,0,0,0,0,0,0,97,120,134,255,163,120,125,255,174,120,72,0,0,0,1,87,220,255,244,145,32,0,0,0,0,0,0,0,63,252,58,31,232,227,206,246,79,0,0,128,255,152,1,50,244,237,37,35,255,168,0,0,
+0,0,0,115,255,92,0,0,0,0,0,0,0,94,255,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,255,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,255,92,0,0,0,0,
+203,255,9,0,0,0,0,144,255,69,0,0,0,0,0,145,255,74,0,0,0,0,0,34,231,239,45,0,0,0,0,0,0,0,0,0,0,0,70,255,186,0,0,3,202,237,23,0,0,0,214,255,5,0,0,0,0,0,0,0,0,0,0,118,
+255,144,0,168,255,50,0,0,0,0,144,255,70,0,0,0,0,0,1,210,245,19,0,0,0,0,104,255,139,0,0,0,23,250,225,1,0,0,34,170,238,252,205,65,220,217,0,0,108,249,101,0,0,156,255,51,0,0,0,0,0,0,0,0,
+0,0,47,227,108,0,0,0,0,0,0,0,186,230,240,255,230,230,239,255,232,230,138,0,0,0,0,0,6,109,233,255,246,60,0,0,0,0,0,7,215,152,0,128,215,4,0,157,187,0,0,207,250,18,0,0,83,254,215,111,255,128,0,0,
+0,0,0,150,255,51,0,0,0,0,0,0,0,65,255,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,255,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,240,10,0,0,0,0,
+174,255,30,0,0,0,0,195,255,44,0,0,0,0,0,145,255,74,0,0,0,0,21,218,245,60,0,0,0,0,0,0,0,0,0,0,0,0,2,221,249,15,0,97,255,246,227,227,227,227,251,255,228,227,9,0,0,0,0,0,0,0,0,62,
+255,166,0,136,255,105,0,0,0,0,100,255,119,0,0,0,0,0,73,255,150,0,0,0,0,0,181,255,43,0,0,0,0,173,255,51,0,0,0,0,3,13,0,16,253,175,0,0,114,251,106,0,0,168,255,34,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,228,0,0,119,245,3,0,0,0,0,0,0,0,0,0,12,125,255,238,11,0,0,0,0,126,231,16,0,210,142,0,0,79,253,18,0,232,246,16,0,0,0,123,255,251,248,28,0,0,
+0,0,0,157,255,54,0,0,0,0,0,0,0,57,255,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,138,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,242,151,0,0,0,0,0,
+141,255,77,0,0,0,4,244,252,16,0,0,0,0,0,145,255,74,0,0,0,12,202,250,75,0,0,0,0,0,0,2,207,202,6,0,0,0,1,220,255,18,0,74,158,158,158,158,158,158,239,255,160,158,6,0,56,212,103,0,0,0,0,128,
+255,132,0,97,255,176,0,0,0,0,167,255,84,0,0,0,0,0,190,253,38,0,0,0,0,0,204,255,38,0,0,0,0,165,255,76,0,0,0,0,0,0,0,142,255,59,0,0,0,9,0,0,9,241,228,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,178,0,0,169,198,0,0,0,0,0,63,73,1,0,0,0,0,192,255,63,0,0,0,38,247,88,0,0,184,160,0,0,99,242,10,0,179,255,109,0,0,0,21,220,255,192,0,0,0,
+0,0,0,123,255,78,0,0,0,0,0,0,0,98,255,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,255,53,0,0,0,0,0,
+51,255,187,16,0,0,76,255,178,0,0,0,0,0,0,145,255,74,0,0,5,183,253,92,0,0,0,0,0,0,0,0,201,255,88,0,0,0,55,255,220,0,0,0,0,0,0,0,0,0,214,255,5,0,0,0,1,212,227,6,0,0,6,208,
+255,71,0,12,233,242,42,0,0,19,239,245,26,0,0,0,0,53,255,177,0,0,0,0,0,0,153,255,133,0,0,0,16,246,253,27,0,0,0,0,0,7,120,252,187,0,0,0,0,0,0,0,88,255,130,0,0,0,0,0,0,0,0,0,
+0,0,45,225,123,0,0,0,0,0,0,0,0,0,236,128,0,0,219,149,0,0,0,0,0,162,255,56,0,0,0,0,147,255,75,0,0,0,58,154,0,0,0,88,238,67,39,201,155,0,0,41,244,251,184,106,162,247,255,248,255,106,0,0,
+0,0,0,88,255,103,0,0,0,0,0,0,0,142,255,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,194,210,0,0,0,0,0,0,
+0,182,255,236,123,178,255,250,62,0,0,0,0,0,0,145,255,74,0,0,150,255,213,130,130,130,130,130,130,98,0,0,60,251,246,172,101,161,240,254,72,0,0,0,0,0,0,0,0,0,214,255,5,0,0,0,0,93,255,214,128,126,231,255,
+181,0,0,0,97,254,252,155,143,244,255,124,0,0,0,0,0,171,255,63,0,0,0,0,0,0,28,236,252,189,107,146,231,255,134,0,0,0,0,140,183,231,255,177,22,0,0,0,0,0,0,0,56,162,4,0,0,0,0,0,0,0,0,0,
+0,0,58,249,150,0,0,0,0,0,0,0,0,31,255,78,0,15,254,99,0,0,0,0,0,77,255,149,0,0,0,12,239,233,5,0,0,0,0,0,0,0,0,8,147,238,250,172,36,0,0,0,48,189,253,255,255,226,107,27,224,251,69,0,
+0,0,0,54,255,129,0,0,0,0,0,0,0,186,255,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,254,113,0,0,0,0,0,0,
+0,8,154,243,255,254,217,64,0,0,0,0,0,0,0,145,255,74,0,0,201,255,255,255,255,255,255,255,255,191,0,0,0,44,131,216,255,222,135,46,0,0,0,0,0,0,0,0,0,0,214,255,5,0,0,0,0,4,83,169,245,255,244,142,
+10,0,0,0,0,79,224,255,255,235,104,1,0,0,0,0,36,252,205,0,0,0,0,0,0,0,0,30,115,200,254,237,157,72,3,0,0,0,0,236,208,163,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,234,255,217,130,160,235,255,142,0,0,0,0,0,0,0,0,0,0,0,8,21,0,0,0,0,0,0,0,8,40,18,0,0,0,0,0,0,0,
+0,0,0,16,248,195,0,0,0,0,0,0,0,231,247,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,249,21,0,0,0,0,0,0,
+0,0,0,2,36,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,33,2,0,
+0,0,0,0,0,0,0,24,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,5,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,117,227,255,255,194,85,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,153,254,29,0,0,0,0,0,20,255,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,52,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,240,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,35,252,115,0,0,0,0,0,114,251,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,237,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,166,235,29,0,0,0,10,232,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,32,225,198,5,0,1,161,225,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,33,222,116,0,112,222,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,30,55,0,56,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3,85,177,0,92,191,191,191,191,191,191,191,164,0,142,122,19,0,0,0,0,0,0,0,0,0,7,77,161,137,49,0,0,0,0,0,0,0,0,0,0,6,58,27,0,0,0,0,0,0,0,0,0,0,0,0,0,
+38,143,90,0,0,0,0,0,0,0,44,143,143,143,143,138,111,70,2,0,0,0,0,0,0,20,87,156,176,136,56,0,0,0,0,44,143,143,143,142,98,34,0,0,0,0,0,0,44,143,143,143,143,143,143,143,143,120,0,44,143,143,143,143,
+143,143,143,143,101,0,0,0,0,52,120,167,178,142,67,0,0,0,0,44,143,87,0,0,0,0,0,0,7,143,126,0,24,143,107,0,0,0,0,0,0,0,0,30,143,103,0,44,143,87,0,0,0,0,0,25,142,141,23,0,44,143,89,0,
+0,0,0,0,0,0,0,44,143,143,40,0,0,0,0,0,0,0,0,60,143,143,26,0,44,143,115,0,0,0,0,0,0,4,143,126,0,0,0,0,16,84,156,161,90,22,0,0,0,0,44,143,143,143,143,143,127,90,28,0,0,0,0,0,
+0,0,0,0,0,9,104,219,255,229,0,105,219,219,219,219,219,219,219,189,0,166,255,245,151,39,0,0,0,0,0,0,52,239,255,243,252,255,204,2,0,0,0,0,0,30,105,176,242,255,255,214,147,81,3,0,0,0,0,0,0,0,0,0,
+144,255,231,5,0,0,0,0,0,0,79,255,255,255,255,255,255,255,211,33,0,0,0,0,103,253,255,237,240,255,254,153,2,0,0,79,255,255,255,255,255,255,226,92,0,0,0,0,79,255,255,255,255,255,255,255,255,214,0,79,255,255,255,255,
+255,255,255,255,181,0,0,3,128,252,255,238,238,255,255,178,7,0,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,0,0,0,0,15,208,255,116,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,255,152,0,0,0,0,0,0,0,0,187,255,255,46,0,79,255,255,79,0,0,0,0,0,8,255,224,0,0,0,93,251,255,249,247,255,253,115,0,0,0,79,255,255,255,255,255,255,255,246,126,0,0,0,0,
+0,0,0,18,124,233,255,238,142,38,0,0,0,0,0,0,0,0,0,0,0,9,93,193,254,253,180,67,1,0,0,0,167,255,91,8,28,169,255,70,0,0,0,0,46,240,228,158,86,21,40,84,142,250,139,0,0,0,0,0,0,0,0,6,
+235,252,255,79,0,0,0,0,0,0,79,255,158,5,5,15,74,171,255,197,0,0,0,75,251,215,49,1,7,78,201,255,117,0,0,79,255,158,5,6,37,90,223,251,82,0,0,0,79,255,158,5,5,5,5,5,5,4,0,79,255,158,5,5,
+5,5,5,5,4,0,0,124,255,213,47,1,5,67,190,255,153,0,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,0,0,0,7,190,255,144,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,255,242,12,0,0,0,0,0,0,36,254,255,255,46,0,79,255,255,229,16,0,0,0,0,8,255,224,0,0,59,248,228,68,7,5,58,216,253,78,0,0,79,255,158,5,5,5,37,127,227,255,103,0,0,0,
+0,19,143,243,255,202,97,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,138,232,255,209,91,0,18,212,169,0,0,0,49,255,167,0,0,0,30,228,172,2,0,0,0,0,0,0,57,224,94,0,0,0,0,0,0,0,84,
+255,132,251,176,0,0,0,0,0,0,79,255,156,0,0,0,0,19,247,255,17,0,23,243,241,19,0,0,0,0,59,255,244,6,0,79,255,156,0,0,0,0,16,208,248,60,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,19,240,241,18,0,0,0,0,34,250,252,21,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,0,0,2,169,255,170,2,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,227,255,101,0,0,0,0,0,0,137,255,225,255,46,0,79,255,251,255,157,0,0,0,0,8,255,224,0,16,233,246,30,0,0,0,0,17,234,243,30,0,79,255,156,0,0,0,0,0,81,255,229,0,0,0,
+0,71,255,242,80,0,0,0,0,0,0,72,150,150,150,150,150,150,150,129,0,0,0,0,0,0,10,164,255,224,0,0,0,0,0,0,0,40,255,192,0,0,17,212,200,9,0,0,0,0,0,0,0,0,40,245,55,0,0,0,0,0,0,181,
+250,22,180,250,23,0,0,0,0,0,79,255,156,0,0,0,0,0,215,255,32,0,78,255,138,0,0,0,0,0,0,203,255,62,0,79,255,156,0,0,0,0,0,70,255,153,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,108,255,143,0,0,0,0,0,0,120,181,60,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,0,0,145,255,192,7,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,140,249,203,0,0,0,0,0,6,233,229,157,255,46,0,79,255,169,221,254,69,0,0,0,8,255,224,0,70,255,148,0,0,0,0,0,0,126,255,91,0,79,255,156,0,0,0,0,0,5,231,255,22,0,0,
+0,23,158,249,251,176,72,2,0,0,0,122,255,255,255,255,255,255,255,219,0,0,0,0,35,135,231,255,218,100,0,0,0,0,0,0,0,144,255,130,0,0,158,224,23,0,0,10,100,193,202,136,15,0,0,172,178,0,0,0,0,0,27,252,
+180,0,87,255,116,0,0,0,0,0,79,255,156,0,0,0,0,63,255,212,0,0,129,255,77,0,0,0,0,0,0,17,31,12,0,79,255,156,0,0,0,0,0,0,234,211,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,144,255,84,0,0,0,0,0,0,0,0,0,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,0,119,255,211,16,0,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,125,169,255,50,0,0,0,0,86,255,130,160,255,46,0,79,255,158,66,254,223,12,0,0,8,255,224,0,120,255,76,0,0,0,0,0,0,56,255,140,0,79,255,156,0,0,0,0,0,11,241,254,14,0,0,
+0,0,0,28,140,242,255,222,121,24,0,1,3,3,3,3,3,3,3,2,0,6,87,188,254,255,191,78,2,0,0,0,0,0,0,0,58,244,224,16,0,0,228,126,0,0,0,167,255,179,130,238,174,0,0,62,217,0,0,0,0,0,121,255,
+87,0,9,240,213,0,0,0,0,0,79,255,190,89,89,99,168,242,230,60,0,0,181,255,47,0,0,0,0,0,0,0,0,0,0,79,255,156,0,0,0,0,0,0,199,253,16,0,79,255,185,77,77,77,77,77,70,0,0,79,255,156,0,0,
+0,0,0,0,0,0,177,255,55,0,0,0,0,0,0,0,0,0,0,79,255,185,77,77,77,77,77,77,85,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,156,94,254,230,28,0,0,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,133,66,255,153,0,0,0,0,188,252,30,167,255,46,0,79,255,158,0,154,255,146,0,0,8,255,224,0,170,255,43,0,0,0,0,0,0,27,255,189,0,79,255,156,0,0,0,0,0,97,255,219,0,0,0,
+0,0,0,0,0,16,121,231,255,227,0,0,0,0,0,0,0,0,0,0,0,164,255,249,163,50,0,0,0,0,0,0,0,0,0,43,240,245,59,0,0,36,255,67,0,0,107,254,82,0,0,221,157,0,0,26,251,5,0,0,0,1,218,241,
+9,0,0,156,255,56,0,0,0,0,79,255,255,255,255,255,255,255,114,0,0,0,207,255,31,0,0,0,0,0,0,0,0,0,0,79,255,156,0,0,0,0,0,0,175,255,55,0,79,255,255,255,255,255,255,255,235,0,0,79,255,255,255,255,
+255,255,255,184,0,0,199,255,38,0,0,0,54,64,64,64,64,28,0,79,255,255,255,255,255,255,255,255,255,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,213,250,255,246,47,0,0,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,141,1,216,242,13,0,0,37,254,179,0,175,255,46,0,79,255,158,0,15,227,253,59,0,8,255,224,0,207,255,23,0,0,0,0,0,0,6,255,225,0,79,255,182,69,69,69,103,181,247,254,78,0,0,0,
+0,0,0,0,0,0,0,8,102,192,0,0,0,0,0,0,0,0,0,0,0,150,134,26,0,0,0,0,0,0,0,0,0,0,4,203,255,73,0,0,0,100,251,12,0,0,223,204,0,0,0,244,133,0,0,7,255,40,0,0,0,61,255,157,
+0,0,0,63,255,154,0,0,0,0,79,255,174,48,48,50,102,181,255,170,1,0,200,255,40,0,0,0,0,0,0,0,0,0,0,79,255,156,0,0,0,0,0,0,187,255,36,0,79,255,182,69,69,69,69,69,63,0,0,79,255,212,145,145,
+145,145,145,105,0,0,190,255,46,0,0,0,214,255,255,255,255,112,0,79,255,182,69,69,69,69,69,69,78,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,255,239,141,255,218,14,0,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,149,0,114,255,102,0,0,138,255,75,0,182,255,46,0,79,255,158,0,0,76,255,215,8,8,255,224,0,197,255,33,0,0,0,0,0,0,12,255,211,0,79,255,255,255,255,255,255,255,217,83,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,255,219,0,0,0,0,163,203,0,0,33,255,130,0,0,12,255,109,0,0,0,242,78,0,0,0,158,255,148,
+97,97,97,98,246,241,10,0,0,0,79,255,156,0,0,0,0,0,206,255,49,0,168,255,100,0,0,0,0,0,0,0,0,0,0,79,255,156,0,0,0,0,0,0,222,235,1,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,140,255,78,0,0,0,66,79,79,162,255,112,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,0,0,0,0,0,0,54,255,184,0,79,255,242,56,0,164,255,170,0,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,155,0,19,247,204,0,6,233,224,3,0,188,255,46,0,79,255,158,0,0,0,164,255,135,8,255,224,0,147,255,62,0,0,0,0,0,0,42,255,163,0,79,255,185,77,77,77,61,28,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,230,129,0,0,0,0,195,173,0,0,97,255,57,0,0,36,255,85,0,0,15,251,75,0,0,12,243,255,255,
+255,255,255,255,255,255,94,0,0,0,79,255,156,0,0,0,0,0,117,255,126,0,132,255,167,0,0,0,0,0,0,106,158,50,0,79,255,156,0,0,0,0,0,26,252,179,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,84,255,122,0,0,0,0,0,0,120,255,112,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,2,5,2,0,0,0,0,56,255,182,0,79,255,156,0,0,11,213,255,109,0,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,156,0,0,162,255,51,87,255,124,0,0,189,255,46,0,79,255,158,0,0,0,20,233,251,58,255,224,0,94,255,106,0,0,0,0,0,0,82,255,114,0,79,255,156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,206,0,0,91,255,51,0,0,62,255,64,0,0,78,255,32,0,0,98,255,150,51,
+51,51,51,51,76,255,192,0,0,0,79,255,156,0,0,0,0,0,155,255,121,0,63,255,233,1,0,0,0,0,19,245,254,24,0,79,255,156,0,0,0,0,0,157,255,117,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,29,255,229,8,0,0,0,0,0,120,255,112,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,97,255,161,0,0,0,0,119,255,151,0,79,255,156,0,0,0,42,243,249,54,0,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,156,0,0,59,255,153,189,250,25,0,0,189,255,46,0,79,255,158,0,0,0,0,86,255,213,255,224,0,41,255,214,2,0,0,0,0,0,187,255,64,0,79,255,156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,241,0,0,48,255,81,0,0,179,255,82,0,0,146,212,1,0,0,195,255,41,0,
+0,0,0,0,0,203,254,35,0,0,79,255,156,0,0,0,0,37,244,255,61,0,0,183,255,112,0,0,0,0,127,255,188,0,0,79,255,156,0,0,0,7,139,253,179,5,0,0,79,255,156,0,0,0,0,0,0,0,0,79,255,156,0,0,
+0,0,0,0,0,0,0,141,255,162,7,0,0,0,2,155,255,112,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,50,255,241,10,0,0,4,211,255,99,0,79,255,156,0,0,0,0,91,255,224,18,0,0,79,255,158,0,
+0,0,0,0,0,0,0,79,255,156,0,0,0,210,246,254,172,0,0,0,189,255,46,0,79,255,158,0,0,0,0,0,174,255,255,224,0,0,152,255,143,2,0,0,0,109,255,174,2,0,79,255,156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,228,99,0,0,0,0,79,255,22,0,8,252,225,99,157,215,246,168,32,151,252,82,0,0,38,254,204,0,0,
+0,0,0,0,0,109,255,132,0,0,79,255,212,145,145,147,205,255,255,152,0,0,0,38,221,255,180,117,141,216,255,234,28,0,0,79,255,212,145,148,184,233,255,188,8,0,0,0,79,255,212,145,145,145,145,145,145,137,0,79,255,156,0,0,
+0,0,0,0,0,0,0,1,165,255,211,137,105,133,203,255,201,29,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,169,255,235,150,134,228,255,202,4,0,79,255,156,0,0,0,0,0,151,255,180,1,0,79,255,213,145,
+145,145,145,145,145,76,0,79,255,156,0,0,0,107,255,255,68,0,0,0,189,255,46,0,79,255,158,0,0,0,0,0,25,238,255,224,0,0,4,184,255,206,140,133,192,255,206,11,0,0,79,255,156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,251,122,0,0,0,0,39,255,76,0,0,69,205,255,201,23,104,244,255,238,94,0,0,0,135,255,112,0,0,
+0,0,0,0,0,21,250,226,3,0,79,255,255,255,255,254,229,192,85,1,0,0,0,0,16,163,236,255,255,245,158,26,0,0,0,79,255,255,255,253,206,143,79,9,0,0,0,0,79,255,255,255,255,255,255,255,255,240,0,79,255,156,0,0,
+0,0,0,0,0,0,0,0,6,117,186,246,255,249,211,137,6,0,0,79,255,156,0,0,0,0,0,0,13,255,224,0,43,255,191,0,0,12,134,243,255,255,248,153,19,0,0,79,255,156,0,0,0,0,0,8,204,255,120,0,79,255,255,255,
+255,255,255,255,255,133,0,79,255,156,0,0,0,15,244,219,1,0,0,0,189,255,46,0,79,255,158,0,0,0,0,0,0,96,255,224,0,0,0,14,127,197,251,253,205,136,26,0,0,0,79,255,156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,3,192,229,24,0,0,2,26,0,0,0,7,34,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,28,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,7,37,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,28,35,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,220,193,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,240,186,99,31,0,0,0,53,45,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,161,227,255,217,199,232,252,115,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,105,118,87,27,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,21,91,162,155,84,17,0,0,0,0,46,143,143,143,143,139,110,72,3,0,0,0,0,0,0,0,2,56,137,175,122,66,1,0,0,0,73,143,143,143,143,143,143,143,143,143,143,107,0,86,143,43,0,0,0,0,0,0,141,134,
+0,88,143,67,0,0,0,0,0,0,0,61,143,95,0,46,143,85,0,0,0,0,0,97,143,14,0,0,0,0,38,143,95,0,20,143,142,16,0,0,0,0,0,35,143,137,7,0,99,143,71,0,0,0,0,0,0,31,143,134,3,0,1,143,
+143,143,143,143,143,143,143,143,143,20,0,88,163,163,163,38,0,70,143,38,0,0,0,0,0,0,0,149,163,163,142,0,0,0,0,69,140,5,0,0,0,245,255,255,255,255,255,255,255,255,51,0,25,92,84,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,55,92,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,92,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,110,124,13,0,0,0,0,
+0,0,0,115,253,255,246,249,255,252,96,0,0,0,82,255,255,255,255,255,255,255,213,55,0,0,0,0,0,106,229,255,248,234,255,255,161,6,0,0,130,255,255,255,255,255,255,255,255,255,255,191,0,153,255,76,0,0,0,0,0,0,252,240,
+0,84,255,188,0,0,0,0,0,0,0,178,255,96,0,34,255,198,0,0,0,0,1,229,255,80,0,0,0,0,112,255,121,0,0,164,255,152,0,0,0,0,0,186,255,131,0,0,68,255,223,6,0,0,0,0,0,158,255,134,0,0,3,255,
+255,255,255,255,255,255,255,255,255,34,0,138,255,234,224,52,0,49,255,145,0,0,0,0,0,0,0,204,224,254,222,0,0,0,0,205,255,85,0,0,0,125,130,130,130,130,130,130,130,130,26,0,2,170,255,94,0,0,0,10,137,203,244,187,
+105,23,0,0,0,153,255,64,0,0,0,0,0,0,0,0,0,0,3,107,177,238,189,97,14,0,0,0,0,0,0,0,0,0,0,0,196,255,20,0,0,0,0,88,171,240,220,158,18,0,0,0,0,0,0,164,251,255,255,20,0,0,0,0,
+0,0,77,253,218,59,5,8,67,226,249,61,0,0,82,255,158,5,5,13,81,166,255,227,18,0,0,0,65,253,236,78,12,2,60,170,255,165,0,0,3,5,5,5,5,215,255,23,5,5,5,4,0,153,255,76,0,0,0,0,0,0,252,240,
+0,7,237,252,24,0,0,0,0,0,17,249,244,13,0,0,227,248,8,0,0,0,47,255,255,150,0,0,0,0,170,255,59,0,0,21,235,253,59,0,0,0,91,255,216,8,0,0,0,183,255,106,0,0,0,0,39,252,234,15,0,0,0,5,
+5,5,5,5,5,5,130,255,176,0,0,138,255,82,0,0,0,0,206,236,7,0,0,0,0,0,0,0,0,250,222,0,0,0,55,255,254,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,195,237,25,0,20,209,253,197,140,206,
+255,201,0,0,0,153,255,64,0,0,0,0,0,0,0,0,0,0,145,255,248,163,203,255,231,8,0,0,0,0,0,0,0,0,0,0,196,255,20,0,0,0,111,255,242,158,217,255,225,18,0,0,0,0,38,255,199,55,13,1,0,0,0,0,
+0,30,242,236,19,0,0,0,0,28,245,235,17,0,82,255,156,0,0,0,0,0,213,255,96,0,0,0,149,255,130,0,0,0,0,20,247,248,11,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,150,255,108,0,0,0,0,0,99,255,162,0,0,0,166,255,60,0,0,0,119,255,228,221,0,0,0,0,228,246,6,0,0,0,93,255,212,6,0,18,233,254,63,0,0,0,0,45,252,229,9,0,0,0,168,255,109,0,0,0,0,0,
+0,0,0,0,0,52,250,233,22,0,0,138,255,82,0,0,0,0,108,255,86,0,0,0,0,0,0,0,0,250,222,0,0,0,160,245,142,254,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,145,81,0,113,255,139,0,0,0,
+159,255,55,0,0,153,255,64,0,0,0,0,0,0,0,0,0,96,255,178,26,0,0,101,255,102,0,0,0,0,0,0,0,0,0,0,196,255,20,0,0,71,252,190,15,0,1,127,255,134,0,0,0,0,126,255,86,0,0,0,0,0,0,0,
+0,93,255,127,0,0,0,0,0,0,149,255,70,0,82,255,156,0,0,0,0,0,117,255,139,0,0,0,153,255,95,0,0,0,0,0,118,166,42,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,55,255,196,0,0,0,0,0,188,255,67,0,0,0,104,255,119,0,0,0,191,239,134,255,36,0,0,31,255,190,0,0,0,0,0,185,255,123,0,155,255,154,0,0,0,0,0,0,158,255,115,0,0,48,253,218,5,0,0,0,0,0,
+0,0,0,0,9,214,255,79,0,0,0,138,255,82,0,0,0,0,18,247,184,0,0,0,0,0,0,0,0,250,222,0,0,19,246,159,29,252,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,46,10,0,0,0,
+70,255,150,0,0,153,255,64,0,0,0,0,0,0,0,0,0,176,255,72,0,0,0,5,206,191,0,0,0,0,0,0,0,0,0,0,196,255,20,0,0,162,255,75,0,0,0,23,251,223,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,143,255,56,0,0,0,0,0,0,79,255,120,0,82,255,156,0,0,0,0,0,156,255,101,0,0,0,45,254,216,24,0,0,0,0,0,0,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,0,216,254,30,0,0,0,24,252,226,2,0,0,0,43,255,178,0,0,14,250,169,60,255,107,0,0,89,255,128,0,0,0,0,0,33,244,247,98,254,230,16,0,0,0,0,0,0,27,245,234,12,0,179,255,84,0,0,0,0,0,0,
+0,0,0,0,144,255,157,0,0,0,0,138,255,82,0,0,0,0,0,167,253,29,0,0,0,0,0,0,0,250,222,0,0,115,255,59,0,180,238,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,100,129,143,
+166,255,163,0,0,153,255,71,142,218,245,197,80,0,0,0,0,229,249,11,0,0,0,0,0,0,0,0,0,0,8,145,220,243,197,69,196,255,20,0,0,216,247,104,102,102,102,102,225,251,4,0,84,209,241,255,216,209,98,0,0,0,0,0,
+0,193,255,23,0,0,0,0,0,0,50,255,169,0,82,255,156,0,0,0,0,33,246,253,24,0,0,0,0,177,255,249,162,52,0,0,0,0,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,0,122,255,117,0,0,0,109,255,133,0,0,0,0,1,235,236,1,0,81,255,95,4,239,177,0,0,147,255,66,0,0,0,0,0,0,115,255,255,255,84,0,0,0,0,0,0,0,0,132,255,123,57,255,198,1,0,0,0,0,0,0,
+0,0,0,67,254,222,13,0,0,0,0,138,255,82,0,0,0,0,0,69,255,125,0,0,0,0,0,0,0,250,222,0,1,218,213,0,0,79,255,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,161,253,255,233,194,
+205,255,163,0,0,153,255,233,234,168,215,255,253,95,0,0,15,255,204,0,0,0,0,0,0,0,0,0,0,4,196,255,252,173,194,248,244,255,20,0,11,254,255,255,255,255,255,255,255,255,26,0,62,156,224,255,171,156,73,0,0,0,0,0,
+0,230,255,3,0,0,0,0,0,0,29,255,205,0,82,255,201,117,117,125,195,253,250,115,0,0,0,0,0,1,79,202,255,255,204,103,13,0,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,0,29,253,205,0,0,0,198,255,39,0,0,0,0,0,174,255,40,0,153,253,22,0,171,242,6,0,205,249,10,0,0,0,0,0,0,3,223,255,195,0,0,0,0,0,0,0,0,0,14,233,239,197,254,59,0,0,0,0,0,0,0,
+0,0,16,226,253,62,0,0,0,0,0,138,255,82,0,0,0,0,0,2,224,222,2,0,0,0,0,0,0,250,222,0,39,181,91,0,0,4,172,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,255,172,28,0,0,
+54,255,163,0,0,153,255,210,13,0,3,88,251,229,7,0,1,245,240,4,0,0,0,0,0,0,0,0,0,95,255,193,38,0,0,80,252,255,20,0,2,246,238,34,31,31,31,31,31,31,3,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,220,255,12,0,0,0,0,0,0,35,255,191,0,82,255,255,255,255,255,255,246,57,0,0,0,0,0,0,0,0,0,71,187,254,255,215,28,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,0,0,188,255,38,0,32,254,199,0,0,0,0,0,0,113,255,99,0,225,200,0,0,99,255,64,11,251,198,0,0,0,0,0,0,0,65,254,255,248,40,0,0,0,0,0,0,0,0,0,107,255,255,173,0,0,0,0,0,0,0,0,
+0,0,163,255,138,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,128,255,66,0,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,205,253,30,0,0,0,
+54,255,163,0,0,153,255,70,0,0,0,0,201,255,76,0,0,210,255,57,0,0,0,0,86,100,1,0,0,198,255,87,0,0,0,0,197,255,20,0,0,208,255,70,0,0,0,0,0,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,170,255,41,0,0,0,0,0,0,65,255,145,0,82,255,166,28,28,28,194,255,70,0,0,0,0,0,0,0,0,0,0,0,41,163,255,218,1,0,0,0,0,0,0,214,255,18,0,0,0,0,0,153,255,76,0,0,0,0,0,0,252,240,
+0,0,0,0,93,255,126,0,119,255,105,0,0,0,0,0,0,51,255,158,43,255,126,0,0,27,254,134,65,255,136,0,0,0,0,0,0,9,219,255,180,255,195,2,0,0,0,0,0,0,0,0,5,230,255,46,0,0,0,0,0,0,0,0,
+0,85,255,209,7,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,31,253,164,0,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,67,0,0,6,
+179,255,169,0,0,153,255,64,0,0,0,0,138,255,110,0,0,119,255,147,3,0,0,54,254,181,0,0,0,234,255,25,0,0,0,0,196,255,20,0,0,117,255,175,8,0,0,0,114,68,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,117,255,85,0,0,0,0,0,0,105,255,98,0,82,255,156,0,0,0,58,255,208,2,0,0,0,9,56,44,0,0,0,0,0,6,229,255,44,0,0,0,0,0,0,214,255,18,0,0,0,0,0,143,255,99,0,0,0,0,0,20,254,230,
+0,0,0,0,11,243,214,0,208,248,17,0,0,0,0,0,0,3,241,213,114,255,51,0,0,0,210,204,120,255,74,0,0,0,0,0,0,137,255,176,4,205,255,105,0,0,0,0,0,0,0,0,0,212,255,23,0,0,0,0,0,0,0,0,
+25,236,248,47,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,186,246,16,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,255,233,147,139,214,
+251,255,205,0,0,153,255,64,0,0,0,0,90,255,137,0,0,8,216,255,221,114,146,234,241,60,0,0,7,255,223,0,0,0,0,0,196,255,20,0,0,5,205,255,234,133,110,182,255,136,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,64,255,194,0,0,0,0,0,1,209,255,49,0,82,255,156,0,0,0,0,175,255,97,0,0,0,7,242,247,24,0,0,0,0,0,174,255,80,0,0,0,0,0,0,214,255,18,0,0,0,0,0,100,255,185,0,0,0,0,0,105,255,188,
+0,0,0,0,0,160,255,88,255,170,0,0,0,0,0,0,0,0,183,249,180,230,1,0,0,0,138,251,174,252,15,0,0,0,0,0,50,251,242,28,0,51,252,241,28,0,0,0,0,0,0,0,0,212,255,23,0,0,0,0,0,0,0,1,
+182,255,119,0,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,88,255,105,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,198,254,253,193,
+47,251,245,1,0,153,255,64,0,0,0,0,135,255,117,0,0,0,15,162,245,255,249,196,45,0,0,0,0,239,248,10,0,0,0,0,196,255,20,0,0,0,10,145,241,255,254,216,112,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,2,173,255,123,0,0,0,1,131,255,156,0,0,82,255,156,0,0,0,0,42,252,228,10,0,0,0,171,255,140,1,0,0,0,34,251,255,30,0,0,0,0,0,0,214,255,18,0,0,0,0,0,35,247,251,42,0,0,0,13,201,255,105,
+0,0,0,0,0,65,255,237,255,76,0,0,0,0,0,0,0,0,121,255,250,156,0,0,0,0,66,255,249,206,0,0,0,0,0,4,206,255,108,0,0,0,142,255,177,0,0,0,0,0,0,0,0,212,255,23,0,0,0,0,0,0,0,104,
+255,195,3,0,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,8,237,203,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,14,0,
+0,0,0,0,0,153,255,64,0,0,0,0,196,255,85,0,0,0,0,0,3,36,10,0,0,0,0,0,0,205,255,69,0,0,0,0,196,255,20,0,0,0,0,0,1,32,18,0,0,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,0,10,201,255,198,135,138,201,255,202,8,0,0,82,255,156,0,0,0,0,0,157,255,124,0,0,0,32,205,255,228,154,114,175,239,255,136,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,0,113,255,254,197,119,170,246,255,187,2,
+0,0,0,0,0,2,224,255,232,4,0,0,0,0,0,0,0,0,59,255,255,82,0,0,0,0,6,242,255,144,0,0,0,0,0,119,255,199,2,0,0,0,12,224,255,86,0,0,0,0,0,0,0,212,255,23,0,0,0,0,0,0,19,244,
+255,176,145,145,145,145,145,145,145,67,0,138,255,82,0,0,0,0,0,0,0,0,147,255,47,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,153,255,184,4,0,0,45,248,240,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,255,165,10,0,0,54,244,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,0,0,23,133,203,253,255,255,255,165,7,0,0,82,255,156,0,0,0,0,0,29,246,242,22,0,0,0,9,141,212,252,255,255,217,99,2,0,0,0,0,0,0,0,214,255,18,0,0,0,0,0,0,0,75,210,253,255,255,223,122,4,0,
+0,0,0,0,0,0,131,255,142,0,0,0,0,0,0,0,0,0,7,246,249,13,0,0,0,0,0,176,255,82,0,0,0,0,37,246,250,45,0,0,0,0,0,75,255,232,18,0,0,0,0,0,0,212,255,23,0,0,0,0,0,0,36,255,
+255,255,255,255,255,255,255,255,255,117,0,138,255,82,0,0,0,0,0,0,0,0,49,255,145,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,153,255,245,201,123,170,253,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,222,255,231,126,150,237,250,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,0,0,0,0,0,21,35,36,203,255,201,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,41,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,42,26,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,0,0,206,236,7,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,153,255,60,189,252,255,241,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,189,252,255,241,114,169,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,41,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8,159,255,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,0,0,36,64,12,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,11,36,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,34,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,138,255,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,138,255,151,102,23,0,0,0,0,0,0,0,0,0,0,0,93,102,252,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,138,255,255,255,59,0,0,0,0,0,0,0,0,0,0,0,232,255,255,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,17,31,31,31,7,0,0,0,0,0,0,0,0,0,0,0,28,31,31,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,55,92,23,0,0,0,0,0,0,0,51,170,51,0,0,0,71,167,30,0,54,92,24,0,0,0,0,0,0,0,0,40,92,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,105,102,0,0,0,134,209,44,0,0,0,0,203,184,0,109,209,74,0,0,0,0,101,209,82,0,94,209,79,0,0,0,43,209,112,0,0,0,11,207,165,0,44,208,185,5,0,0,1,170,209,67,0,132,209,79,0,0,0,0,140,209,
+62,0,6,209,209,209,209,209,209,209,209,36,0,0,0,0,0,5,119,111,0,36,143,34,0,130,104,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,138,138,138,138,138,142,11,0,0,0,0,0,0,0,0,0,0,
+0,0,0,9,146,220,243,196,71,130,209,21,0,153,255,64,0,0,0,0,0,0,0,124,255,126,0,0,0,160,255,88,0,150,255,66,0,0,0,0,0,0,0,0,112,255,105,0,128,209,42,142,216,245,196,88,0,57,174,233,210,120,30,0,
+0,125,209,37,121,208,240,160,64,1,0,0,0,0,92,169,236,227,176,44,0,0,0,125,209,36,149,219,245,197,77,0,0,0,0,0,10,147,219,245,201,80,138,209,15,0,125,209,58,168,238,150,0,0,0,28,112,193,237,164,83,9,0,0,
+0,0,240,232,0,0,0,163,255,54,0,0,0,0,247,224,0,49,255,167,0,0,0,0,198,250,22,0,48,255,157,0,0,0,125,255,209,0,0,0,69,255,134,0,0,155,255,115,0,0,95,255,182,0,0,77,255,173,0,0,0,5,238,241,
+9,0,5,181,181,181,181,181,200,255,247,26,0,0,0,0,43,212,242,79,0,64,255,61,0,98,248,200,30,0,0,0,0,0,32,142,237,206,87,0,0,0,8,190,97,0,235,42,0,0,0,35,226,20,0,0,0,0,0,0,0,0,0,0,
+0,0,4,199,255,252,174,194,248,233,255,25,0,153,255,64,0,0,0,0,0,0,0,10,68,10,0,0,0,17,66,4,0,150,255,66,0,0,0,0,0,0,0,0,112,255,105,0,156,255,230,221,161,207,255,251,135,245,222,163,230,255,208,0,
+0,153,255,208,241,171,194,253,255,50,0,0,0,119,255,253,172,212,255,246,81,0,0,153,255,230,225,163,226,255,253,92,0,0,0,5,202,255,250,163,177,245,242,255,18,0,153,255,231,254,214,131,0,0,3,216,248,186,151,228,255,145,0,0,
+0,0,240,232,0,0,0,163,255,54,0,0,0,0,247,224,0,0,211,243,9,0,0,27,253,181,0,0,1,228,224,0,0,0,204,252,255,34,0,0,133,255,60,0,0,15,226,242,26,17,233,240,29,0,0,5,235,246,12,0,0,67,255,161,
+0,0,0,0,0,0,0,2,187,255,104,0,0,0,0,0,153,255,48,0,0,64,255,61,0,0,73,255,126,0,0,0,0,5,235,249,178,227,255,163,22,0,87,255,47,0,151,135,0,0,0,131,134,20,0,0,0,0,0,0,0,0,0,0,
+0,0,97,255,196,39,0,0,82,252,255,25,0,153,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,66,0,0,0,0,0,0,0,0,112,255,105,0,156,255,184,3,0,0,114,255,255,143,1,0,2,184,255,38,
+0,153,255,216,17,0,0,95,255,128,0,0,80,254,199,41,0,2,85,243,231,14,0,153,255,186,7,0,7,107,255,226,6,0,0,101,255,193,34,0,0,64,245,255,18,0,153,255,217,26,0,0,0,0,91,255,118,0,0,3,212,245,21,0,
+190,209,252,251,209,194,0,163,255,54,0,0,0,0,247,224,0,0,119,255,81,0,0,107,255,89,0,0,0,155,255,36,0,30,254,142,255,113,0,0,198,237,3,0,0,0,73,255,166,150,255,100,0,0,0,0,148,255,88,0,0,146,255,72,
+0,0,0,0,0,0,0,127,255,167,0,0,0,0,0,1,229,224,0,0,0,64,255,61,0,0,5,245,203,0,0,0,0,74,255,67,0,15,171,255,239,190,254,210,0,0,138,134,15,0,11,137,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,197,255,92,0,0,0,0,195,255,25,0,153,255,64,0,0,0,0,0,0,0,92,209,86,0,0,0,113,209,65,0,150,255,66,0,0,0,0,0,0,0,0,112,255,105,0,156,255,62,0,0,0,26,253,248,23,0,0,0,103,255,119,
+0,153,255,73,0,0,0,17,251,204,0,0,168,255,93,0,0,0,0,173,255,110,0,153,255,64,0,0,0,0,217,255,72,0,0,200,255,91,0,0,0,0,199,255,18,0,153,255,74,0,0,0,0,0,146,255,99,0,0,0,46,92,33,0,
+142,156,249,246,156,145,0,163,255,54,0,0,0,0,247,224,0,0,29,253,166,0,0,190,242,10,0,0,0,81,255,104,0,108,254,27,210,192,0,12,250,166,0,0,0,0,0,158,255,253,186,1,0,0,0,0,57,255,173,0,1,224,234,4,
+0,0,0,0,0,0,67,252,217,13,0,0,0,0,0,46,255,169,0,0,0,64,255,61,0,0,0,194,254,21,0,0,0,94,157,4,0,0,0,92,206,224,117,14,0,0,138,39,109,0,104,44,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,232,255,30,0,0,0,0,194,255,25,0,153,255,66,122,209,240,160,64,1,0,112,255,105,0,0,0,138,255,79,0,150,255,66,0,0,3,157,209,102,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,0,223,254,25,0,0,0,0,97,255,153,0,153,255,64,0,0,0,0,148,255,105,0,0,235,255,27,0,0,0,0,199,255,18,0,153,255,64,0,0,0,0,0,58,247,243,160,74,6,0,0,0,0,
+0,0,240,232,0,0,0,163,255,54,0,0,0,0,247,224,0,0,0,189,242,8,20,251,161,0,0,0,0,13,249,171,0,187,201,0,129,252,20,71,255,92,0,0,0,0,0,29,254,255,55,0,0,0,0,0,1,219,246,12,49,255,150,0,
+0,0,0,0,0,24,231,246,47,0,0,0,0,0,0,61,255,156,0,0,0,64,255,61,0,0,0,181,255,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,146,2,147,0,117,20,0,0,0,0,0,0,0,0,0,0,
+0,3,254,228,0,0,0,0,0,194,255,25,0,153,255,217,241,171,194,253,255,50,0,112,255,105,0,0,0,138,255,79,0,150,255,66,0,1,159,255,162,2,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,14,255,217,0,0,0,0,0,41,255,185,0,153,255,64,0,0,0,0,96,255,132,0,7,255,223,0,0,0,0,0,199,255,18,0,153,255,64,0,0,0,0,0,0,53,182,249,255,238,159,24,0,0,
+0,0,240,232,0,0,0,163,255,54,0,0,0,0,247,224,0,0,0,97,255,79,99,255,70,0,0,0,0,0,188,236,19,250,121,0,47,255,95,135,253,20,0,0,0,0,0,150,255,255,178,0,0,0,0,0,0,128,255,88,128,255,61,0,
+0,0,0,0,3,190,255,100,0,0,0,0,0,0,0,65,255,153,0,0,0,64,255,61,0,0,0,178,255,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,76,138,82,0,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,234,250,12,0,0,0,0,194,255,25,0,153,255,216,17,0,0,95,255,128,0,112,255,105,0,0,0,138,255,79,0,150,255,66,0,147,255,177,4,0,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,1,243,245,9,0,0,0,0,92,255,151,0,153,255,64,0,0,0,0,143,255,112,0,0,239,248,10,0,0,0,0,199,255,18,0,153,255,64,0,0,0,0,0,0,0,0,16,96,189,253,227,25,0,
+0,0,240,232,0,0,0,140,255,77,0,0,0,0,247,224,0,0,0,14,246,164,181,230,3,0,0,0,0,0,114,255,141,255,41,0,0,220,175,199,199,0,0,0,0,0,66,254,184,153,255,93,0,0,0,0,0,36,254,173,208,226,2,0,
+0,0,0,0,130,255,163,0,0,0,0,0,0,0,0,121,255,111,0,0,0,64,255,61,0,0,0,134,255,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,2,207,3,0,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,201,255,73,0,0,0,0,194,255,25,0,153,255,73,0,0,0,17,251,204,0,112,255,105,0,0,0,138,255,79,0,150,255,66,132,255,190,8,0,0,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,0,206,255,72,0,0,0,0,160,255,96,0,153,255,64,0,0,0,0,207,255,80,0,0,206,255,71,0,0,0,0,199,255,18,0,153,255,64,0,0,0,0,1,83,74,0,0,0,0,155,255,104,0,
+0,0,240,232,0,0,0,64,255,145,0,0,0,95,254,224,0,0,0,0,167,241,249,142,0,0,0,0,0,0,40,255,249,217,0,0,0,138,245,251,124,0,0,0,0,12,223,246,35,18,233,238,26,0,0,0,0,0,199,248,255,138,0,0,
+0,0,0,69,253,214,12,0,0,0,0,0,0,0,53,212,250,45,0,0,0,64,255,61,0,0,0,63,253,196,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,31,211,36,0,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,112,255,167,10,0,0,53,244,255,25,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,163,255,222,13,0,0,0,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,0,102,255,171,11,0,0,36,231,246,33,0,153,255,139,0,0,0,47,253,238,14,0,0,119,255,163,7,0,0,37,236,255,18,0,153,255,64,0,0,0,0,0,202,255,55,0,0,0,132,255,77,0,
+0,0,240,232,0,0,0,4,237,249,169,114,168,250,254,224,0,0,0,0,75,255,255,50,0,0,0,0,0,0,0,221,255,137,0,0,0,56,255,255,50,0,0,0,0,150,255,124,0,0,93,255,178,0,0,0,0,0,107,255,255,49,0,0,
+0,0,13,233,255,171,130,130,130,130,130,61,0,87,255,254,82,0,0,0,0,64,255,61,0,0,0,0,84,253,255,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,128,36,131,0,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,10,223,255,232,126,150,237,254,255,25,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,255,255,253,68,0,0,0,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,0,3,197,255,234,124,162,251,252,81,0,0,153,255,255,170,102,169,253,255,120,0,0,0,13,227,255,226,113,130,228,255,255,18,0,153,255,64,0,0,0,0,0,91,252,228,145,97,150,246,204,1,0,
+0,0,240,232,0,0,0,0,65,170,248,255,231,88,229,224,0,0,0,0,4,233,214,0,0,0,0,0,0,0,0,147,255,58,0,0,0,1,228,230,1,0,0,0,67,254,215,6,0,0,1,190,255,93,0,0,0,0,20,251,216,0,0,0,
+0,0,31,255,255,255,255,255,255,255,255,120,0,59,226,255,150,1,0,0,0,64,255,61,0,0,0,4,157,255,219,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,9,139,0,136,11,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,0,25,190,252,255,242,118,196,255,24,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,215,78,250,232,24,0,0,0,0,112,255,105,0,156,255,61,0,0,0,0,245,229,0,0,0,0,74,255,143,
+0,153,255,64,0,0,0,0,240,232,0,0,0,7,142,239,255,249,191,88,0,0,0,153,255,105,199,254,255,240,118,0,0,0,0,0,27,192,252,255,245,127,203,255,18,0,153,255,64,0,0,0,0,0,0,71,210,251,255,223,150,45,0,0,
+0,0,222,244,4,0,0,0,0,0,18,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,255,127,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,179,255,70,0,0,0,64,255,61,0,0,0,92,255,155,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,98,50,0,44,104,117,20,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,13,35,2,10,242,246,2,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,71,0,113,255,188,3,0,0,0,112,255,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,33,12,0,0,0,0,0,153,255,64,0,14,36,2,0,0,0,0,0,0,0,0,13,36,3,0,199,255,18,0,0,0,0,0,0,0,0,0,0,0,0,10,33,0,0,0,0,0,
+0,0,151,255,159,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,167,252,37,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,255,126,0,0,0,64,255,61,0,0,0,151,255,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,147,0,0,0,147,118,20,0,0,0,0,0,0,0,0,0,0,
+0,0,3,121,12,0,0,0,88,255,197,0,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,66,0,1,175,255,126,0,0,0,112,255,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,255,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,48,198,255,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,79,148,255,141,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,255,156,0,0,0,64,255,61,0,0,0,181,255,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,197,89,0,0,0,81,183,20,0,0,0,0,0,0,0,0,0,0,
+0,0,56,247,211,116,86,167,246,252,56,0,0,153,255,64,0,0,0,0,240,232,0,112,255,105,0,0,0,138,255,79,0,150,255,66,0,0,17,223,252,64,0,0,112,255,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,255,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,32,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,255,255,196,11,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,255,156,0,0,0,64,255,61,0,0,0,181,255,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,143,138,138,138,141,251,20,0,0,0,0,0,0,0,0,0,0,
+0,0,0,54,206,252,255,255,218,69,0,0,0,153,255,64,0,0,0,0,240,232,0,0,0,0,0,0,0,138,255,79,0,150,255,66,0,0,0,54,249,230,22,0,112,255,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,255,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,82,39,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,254,180,0,0,0,64,255,61,0,0,0,202,245,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,13,54,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,41,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,239,2,0,0,64,255,61,0,0,15,252,177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,83,231,235,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,255,110,0,0,45,179,43,0,2,133,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,255,243,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,138,250,125,0,0,0,0,0,152,246,122,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,77,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,64,0,0,0,0,0,76,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+#endif // _NN_DEFAULT_FONT_ATLAS_H
@@ -22,6 +22,13 @@ typedef struct
     int y; // Y-coordinate
 } nnPos;
 
+// Represents a 2D position with subpixel precision.
+typedef struct
+{
+    float x; // X-coordinate
+    float y; // Y-coordinate
+} nnPosf;
+
 // Represents a 2D rectangle.
 typedef struct
 {
@@ -53,6 +60,53 @@ typedef struct
     float angle;            // Rotation angle in degrees
 } nnImage;
 
+// Statistics of the image cache, see `nnImageCacheStatistics`.
+typedef struct
+{
+    size_t bytesResident;  // Memory used by all cached images: textures plus copies of memory keys
+    size_t bytesBudget;    // Memory budget of the cache
+    int images;            // Number of cached images
+    int referencedImages;  // Number of cached images that have not been released
+    unsigned int hits;     // Number of loads served from the cache
+    unsigned int misses;   // Number of loads that had to decode the image
+    float hitRate;         // hits / (hits + misses)
+} nnImageCacheStats;
+
+// Statistics of the font atlas pages, see `nnFontAtlasStatistics`.
+typedef struct
+{
+    int pages;          // Number of atlas pages
+    int glyphPages;     // Number of pages holding glyphs rasterized on demand
+    size_t bytes;       // Texture memory of all pages
+    size_t usedPixels;  // Pixels reserved for baked blocks and glyphs
+    size_t totalPixels; // Pixels of all pages
+    float utilization;  // usedPixels / totalPixels
+} nnFontAtlasStats;
+
+// A small image (e.g. an icon) packed into the UI atlas, see `nnLoadAtlasImage`.
+typedef struct
+{
+    int page;   // Atlas page holding the image, -1 if it could not be loaded
+    int x;      // Left edge of the image on the page
+    int y;      // Top edge of the image on the page
+    int width;  // Width of the image
+    int height; // Height of the image
+} nnAtlasImage;
+
+// Read-only view of bytes, e.g. of a file mapped with `nnMapFile` or a file inside an archive.
+typedef struct
+{
+    const unsigned char *data; // First byte, NULL if the view is empty
+    size_t size;               // Number of bytes
+    int source;                // How the memory is held (borrowed, mapped or buffered), used by `nnUnmapFile`
+} nnFileView;
+
+// A packed archive of files, created with the `nnpack` tool and opened with `nnOpenArchive`.
+typedef struct _nnArchive nnArchive;
+
+// Handle of an image that is loaded in the background. Created with `nnLoadImageAsync`.
+typedef struct _nnAsyncImage nnAsyncImage;
+
 // Represents a 2D buffer of colors (`nnColorf`), for fast pixel manipulations.
 typedef struct
 {
@@ -65,19 +119,97 @@ typedef struct
     bool isFlippedY;        // Is y-axies flipped
     float angle;            // Rotation angle in degrees
     nnColorf *pixels;       // CPU-side pixel pixmap
+    int dirtyX0, dirtyY0;   // Top left corner of the region written with `nnUnlockPixmap` or `nnWritePixels` that is not uploaded yet
+    int dirtyX1, dirtyY1;   // Bottom right corner of that region (exclusive), equal to the top left if there is none
+    bool isLocked;          // Is locked with `nnLockPixmap`
+    int lockX, lockY;       // Top left corner of the locked region
+    int lockWidth;          // Width of the locked region
+    int lockHeight;         // Height of the locked region
 } nnPixmap;
 
-// Represents a font loaded with stb_truetype.
+// Layout of the pixels of a pixmap in memory.
+typedef enum
+{
+    NN_PIXEL_FORMAT_RGBA_FLOAT // Four floats per pixel, laid out like `nnColorf`
+} nnPixelFormat;
+
+// Memory of a region of a pixmap, returned by `nnLockPixmap`.
 typedef struct
 {
-    stbtt_fontinfo fontInfo;
+    nnColorf *pixels;     // Top left pixel of the region, NULL if nothing could be locked
+    int stride;           // Distance from one row to the one below in pixels, negative as pixmaps are stored bottom up
+    int width;            // Width of the locked region
+    int height;           // Height of the locked region
+    nnPixelFormat format; // Layout of the pixels
+} nnPixmapLock;
+
+// Returns the text of the item at the given index. `userData` is the pointer passed to `nnVirtualList`.
+typedef const char *(*nnListItemFunc)(int index, void *userData);
+
+// Returns the height in pixels of the item at the given index. `userData` is the pointer passed to `nnVirtualList`.
+typedef int (*nnListItemHeightFunc)(int index, void *userData);
+
+// A text document stored as a piece table, used by `nnTextView`. Created with `nnCreateTextDocument` or `nnLoadTextDocument`.
+typedef struct _nnTextDocument nnTextDocument;
+
+// A ring buffer of plot samples, used by `nnPlot`. Created with `nnCreatePlotData`.
+typedef struct _nnPlotData nnPlotData;
+
+// A typeface loaded with stb_truetype. It holds the font data once and is shared by all sizes of the font.
+typedef struct _nnFontFace nnFontFace;
+
+// A string whose glyph quads are laid out once, for text that does not change. Created with `nnCreateText`.
+typedef struct _nnText nnText;
+
+// A shape made of lines and Bezier curves whose triangles are tessellated once and reused until it changes. Created with `nnCreatePath`.
+typedef struct _nnPath nnPath;
+
+// How `nnStrokePath` joins two segments of a path.
+typedef enum
+{
+    NN_JOIN_MITER, // Sharp corner, beveled where it would reach further than four times the thickness
+    NN_JOIN_ROUND, // Rounded corner
+    NN_JOIN_BEVEL  // Corner cut off straight
+} nnLineJoin;
+
+// How `nnStrokePath` ends the open subpaths of a path.
+typedef enum
+{
+    NN_CAP_BUTT,   // Ends flat at the end point
+    NN_CAP_ROUND,  // Ends with a half circle around the end point
+    NN_CAP_SQUARE  // Ends flat half the thickness past the end point
+} nnLineCap;
+
+// How `nnBlitPixmap` combines the source pixels with the destination pixels.
+typedef enum
+{
+    NN_BLEND_COPY,         // Replaces the destination
+    NN_BLEND_ALPHA,        // Draws the source over the destination by its alpha
+    NN_BLEND_ADD,          // Adds the source weighted by its alpha, e.g. for light and glow
+    NN_BLEND_MULTIPLY,     // Multiplies the destination colors with the source colors weighted by its alpha, e.g. for shadows
+    NN_BLEND_PREMULTIPLIED // Draws the source over the destination, both holding colors multiplied by their alpha
+} nnBlendMode;
+
+// Represents one pixel size of a font. Sizes of the same typeface share an `nnFontFace`, and all fonts share the glyph atlas pages.
+typedef struct _nnFont
+{
+    nnFontFace *face;             // Shared typeface (font data and stb_truetype info)
+    float size;                   // Pixel height the glyphs were baked at
     float glyphHeight;            // Height of the loaded font
-    unsigned char *fontBuffer;    // Holds the font file data
-    unsigned int textureID;       // OpenGL texture for the font atlas
-    int atlasWidth;               // Width of the font atlas
-    int atlasHeight;              // Height of the font atlas
     float scale;                  // Font scaling factor
-    stbtt_bakedchar charData[96]; // Holds character data for ASCII 32-127
+    unsigned int textureID;       // OpenGL texture of the atlas page holding the glyphs
+    int atlasWidth;               // Width of the atlas page
+    int atlasHeight;              // Height of the atlas page
+    int atlasPage;                // Index of the atlas page
+    bool sdf;                     // Glyphs are signed distance fields shared by all SDF sizes of the face
+    int oversampling;             // Oversampling of the baked ASCII glyphs (1 or 2)
+    stbtt_packedchar charData[96]; // Holds character data for ASCII 32-127
+    struct _nnGlyph *glyphs;      // Hash table of the glyphs outside ASCII, rasterized on demand
+    int glyphCapacity;            // Number of slots in the glyph table (a power of two)
+    int glyphCount;               // Number of used slots in the glyph table
+    int refCount;                 // Number of loaded handles and text objects using this size
+    bool kept;                    // Switched to with nnSetFontSize, so the size stays cached until its face is freed
+    struct _nnFont *nextSize;     // Next cached size of the same face
 } nnFont;
 
 // Theme used by gui elements
@@ -158,6 +290,44 @@ void nnScaleImage(nnImage *image, float scaleX, float scaleY);
 // Frees the given image.
 void nnFreeImage(nnImage image);
 
+// Loads an image in the background and returns a handle immediately. The file is read and decoded by worker threads and
+// uploaded to the GPU at the start of a later frame.
+nnAsyncImage *nnLoadImageAsync(const char *filepath);
+
+// Returns `true` once the background load of the given image has finished (successfully or not).
+bool nnIsImageLoaded(nnAsyncImage *image);
+
+// Returns the loaded image. The texture ID is 0 while the image is still loading or if loading failed.
+nnImage nnGetAsyncImage(nnAsyncImage *image);
+
+// Frees the given async image handle and its texture. Images that are still loading are freed once they are done.
+void nnFreeAsyncImage(nnAsyncImage *image);
+
+// Starts loading all images listed in the manifest file (one path per line, lines starting with '#' are ignored).
+// The handles are written to `images`. Returns the number of images that are loading or -1 if the manifest could not be read.
+int nnPrefetchImages(const char *manifestPath, nnAsyncImage **images, int maxImages);
+
+// Returns the progress (0.0 to 1.0) of all background image loads started since the loader was last idle.
+float nnImageLoadProgress();
+
+// Sets how many bytes of decoded images and how many milliseconds are spent per frame uploading them to the GPU.
+void nnSetImageUploadBudget(int bytesPerFrame, int milliseconds);
+
+// Loads an image through the image cache. Loading the same path again returns the same texture. Release it with `nnReleaseImage`.
+nnImage nnLoadImageCached(const char *filepath);
+
+// Loads an image from memory through the image cache, keyed by the content of the memory.
+nnImage nnLoadImageMemCached(const unsigned char *data, int size);
+
+// Releases an image loaded with `nnLoadImageCached` or `nnLoadImageMemCached`. Unreferenced images stay cached until the memory budget requires evicting them.
+void nnReleaseImage(nnImage image);
+
+// Sets the memory budget of the image cache in bytes. The least recently used unreferenced images are evicted when it is exceeded.
+void nnSetImageCacheBudget(size_t bytes);
+
+// Returns statistics about the image cache.
+nnImageCacheStats nnImageCacheStatistics();
+
 /*
  * Pixmap Management and Drawing
  */
@@ -189,14 +359,83 @@ void nnScalePixmap(nnPixmap *pixmap, float scaleX, float scaleY);
 // Returns a copy of the given pixmap.
 nnPixmap *nnCopyPixmap(nnPixmap *pixmap);
 
+// Combines the `srcRec` part of `src` into `dst` with its top left corner at x, y. Call `nnUpdatePixmap` on `dst` to show the result.
+void nnBlitPixmap(nnPixmap *dst, nnPixmap *src, nnRecf srcRec, int x, int y, nnBlendMode mode);
+
+// Combines the `srcRec` part of `src` into `dst`, scaled to fill `dstRec`. Samples the nearest source pixel, or interpolates between the four around it if `bilinear` is set.
+void nnBlitPixmapScaled(nnPixmap *dst, nnPixmap *src, nnRecf srcRec, nnRecf dstRec, nnBlendMode mode, bool bilinear);
+
 // Free the given Pixmap
 void nnFreePixmap(nnPixmap *pixmap);
 
+// Loads a pixmap from the specified image file path.
+nnPixmap *nnLoadPixmap(const char *filepath);
+
+// Loads a pixmap from an image in memory, e.g. a view into an archive.
+nnPixmap *nnLoadPixmapMem(const unsigned char *data, size_t size);
+
+// Gives direct access to the pixels of a region of the pixmap (clipped to it), so whole rows can be written at once. Call `nnUnlockPixmap` when done.
+nnPixmapLock nnLockPixmap(nnPixmap *pixmap, nnRecf rect);
+
+// Ends the access started with `nnLockPixmap`. The locked region is uploaded the next time the pixmap is drawn.
+void nnUnlockPixmap(nnPixmap *pixmap);
+
+// Writes `count` pixels into the row y starting at x. They are uploaded the next time the pixmap is drawn.
+void nnWritePixels(nnPixmap *pixmap, int x, int y, const nnColorf *pixels, int count);
+
+// Reads `count` pixels from the row y starting at x. Pixels outside of the pixmap are read as transparent.
+void nnReadPixels(nnPixmap *pixmap, int x, int y, nnColorf *pixels, int count);
+
 //// Primitives Drawing
 
 // Draw an individual pixel to the screen (When drawing large chunks of pixels, it is recommended to use a Pixmap instead for performance reasons)
 void nnPutPixel(float x, float y);
 
+// Draws a line from x0, y0 to x1, y1 with the given thickness to the screen.
+void nnPutLine(float x0, float y0, float x1, float y1, float thickness);
+
+// Draws a rectangle where x and y is the top left corner to the screen. The outline is one pixel wide, inside the rectangle.
+void nnPutRect(float x, float y, float width, float height, bool filled);
+
+// Draws a circle with its center at x, y to the screen.
+void nnPutCircle(float x, float y, float radius, bool filled);
+
+// Draws a polygon through `count` points to the screen. Filled polygons must not cross themselves.
+void nnPutPolygon(const nnPosf *points, int count, bool filled);
+
+// Draws the queued screen primitives right away, e.g. before drawing with OpenGL directly.
+void nnFlushPrimitives();
+
+// Creates an empty path.
+nnPath *nnCreatePath();
+
+// Starts a new subpath at x, y.
+void nnPathMoveTo(nnPath *path, float x, float y);
+
+// Adds a line from the current point to x, y.
+void nnPathLineTo(nnPath *path, float x, float y);
+
+// Adds a quadratic Bezier curve from the current point to x, y with the control point cx, cy.
+void nnPathQuadTo(nnPath *path, float cx, float cy, float x, float y);
+
+// Adds a cubic Bezier curve from the current point to x, y with the control points cx1, cy1 and cx2, cy2.
+void nnPathCubicTo(nnPath *path, float cx1, float cy1, float cx2, float cy2, float x, float y);
+
+// Closes the current subpath with a line back to its start.
+void nnPathClose(nnPath *path);
+
+// Removes all subpaths, so the path can be built again.
+void nnClearPath(nnPath *path);
+
+// Draws the outline of a path moved by x, y with the current color.
+void nnStrokePath(nnPath *path, float x, float y, float thickness, nnLineJoin join, nnLineCap cap);
+
+// Fills a path moved by x, y with the current color. Open subpaths are closed, overlaps are inside by the nonzero or the even-odd rule.
+void nnFillPath(nnPath *path, float x, float y, bool evenOdd);
+
+// Free the given path.
+void nnFreePath(nnPath *path);
+
 // Writes a pixel at x, y location with the given color to the given Pixmap.
 void nnDrawPixel(nnPixmap *pixmap, int x, int y, nnColorf color);
 
@@ -212,6 +451,12 @@ void nnDrawTriangle(nnPixmap *pixmap, int x1, int y1, int x2, int y2, int x3, in
 // Draws a rectangle where x and y is the top left corner.
 void nnDrawRect(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf color, bool filled);
 
+// Draws an anti-aliased line from x0, y0 to x1, y1, blended over the pixels. Lines thinner than a pixel are drawn fainter.
+void nnDrawLineAA(nnPixmap *pixmap, float x0, float y0, float x1, float y1, float thickness, nnColorf color);
+
+// Draws an anti-aliased oval with its center at x, y, blended over the pixels. The outline is one pixel wide, inside the oval.
+void nnDrawOvalAA(nnPixmap *pixmap, float x, float y, float width, float height, nnColorf color, bool filled);
+
 /*
  * Text Rendering
  */
@@ -219,33 +464,78 @@ void nnDrawRect(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf
 // Load a font from a .ttf file
 nnFont *nnLoadFont(const char *filepath, float fontSize);
 
-// Load a font from a .ttf file
+// Load a font from a .ttf file in memory. The data is used in place and must stay valid and unchanged until the font is freed.
 nnFont *nnLoadFontMem(const unsigned char *data, size_t dataSize, float fontSize);
 
+// Load a font from a .ttf file that renders signed distance field glyphs, which stay sharp at any size and scale.
+nnFont *nnLoadFontSDF(const char *filepath, float fontSize);
+
+// Load a font from a .ttf file in memory that renders signed distance field glyphs.
+nnFont *nnLoadFontMemSDF(const unsigned char *data, size_t dataSize, float fontSize);
+
 // Set font for text rendering.
 void nnSetFont(nnFont *font);
 
 // Get the font that is currently set.
 nnFont *nnGetFont();
 
+// Switches the current font to another pixel size of the same typeface. Sizes are baked once and cached.
+// They belong to the face and are freed with it, when the last font loaded from the face is freed.
+void nnSetFontSize(float size);
+
+// Returns the pixel size of the current font.
+float nnGetFontSize();
+
+// Enables 2x oversampling for font sizes baked from now on, which makes filtered text sharper at 4 times the atlas memory.
+void nnSetFontOversampling(bool enabled);
+
+// Enables kerning for fonts loaded from now on. The kerning of ASCII pairs is looked up in a table built once per typeface.
+void nnSetFontKerning(bool enabled);
+
+// Returns statistics about the font atlas pages: their number, memory and how much of them is used.
+nnFontAtlasStats nnFontAtlasStatistics();
+
 // Render the given formatted text using the font set with `nnSetFont`. If no font has been set, the internal default font will be used.
 void nnDrawText(const char *format, int x, int y, ...);
 
 // Render the given formatted text using the font set with `nnSetFont` and a custom z-index (-1.0 to 1.0). If no font has been set, the internal default font will be used.
 void nnDrawTextZ(const char *format, int x, int y, float zIndex, ...);
 
-// Draws text when debug is enabled.
+// Render `length` bytes of text as they are, without formatting. The text does not need to be zero terminated.
+void nnDrawTextN(const char *text, size_t length, int x, int y);
+
+// Draws text when debug is enabled. The text is queued and drawn on top of the frame after the render function returns.
 void nnDrawDebugText(const char *format, int x, int y, ...);
 
 // Returns the width in pixels of the given string regarding the current font.
 float nnTextWidth(const char *format, ...);
 
+// Returns the width in pixels of `length` bytes of text regarding the current font, without formatting.
+float nnTextWidthN(const char *text, size_t length);
+
 // Returns the height in pixels of the the current font.
 float nnTextHeight();
 
-// Free the given font.
+// Free the given font. Only pass fonts returned by the nnLoadFont functions. The size is freed once no text object uses it,
+// sizes switched to with `nnSetFontSize` stay cached until their face is freed.
 void nnFreeFont(nnFont *font);
 
+// Lays out the glyph quads of a string once, so drawing it takes one call per atlas page. Uses the current font if `font` is NULL.
+// The text object keeps its font alive until it is freed.
+nnText *nnCreateText(nnFont *font, const char *text);
+
+// Draws a text object with the current color.
+void nnDrawTextObject(nnText *text, int x, int y);
+
+// Returns the width in pixels of a text object, measured when it was created.
+float nnTextObjectWidth(nnText *text);
+
+// Returns the height in pixels of the font of a text object.
+float nnTextObjectHeight(nnText *text);
+
+// Free the given text object and release its reference to the font.
+void nnFreeText(nnText *text);
+
 /*
  * Collision Handling
  */
@@ -310,12 +600,35 @@ void nnFlushMouse();
  * Utility
  */
 
-// Load a file as bytes into a buffer and return the pointer to that buffer.
+// Load a file as bytes into a buffer and return the pointer to that buffer. Returns NULL for files larger than INT_MAX bytes.
 unsigned char *nnLoadFileBytes(const char *filepath, int *size);
 
 // Free the buffer allocated by nnLoadFileBytes.
 void nnFreeFileBytes(unsigned char *buffer);
 
+// Maps a file read-only into memory and returns a view of it, without reading the whole file up front. Falls back to reading
+// the file into a buffer if it can't be mapped. The view is empty if the file could not be opened.
+nnFileView nnMapFile(const char *filepath);
+
+// Releases a view returned by `nnMapFile`.
+void nnUnmapFile(nnFileView view);
+
+// Opens a packed archive created with the `nnpack` tool. The archive is memory mapped, its files are not read until they are used.
+nnArchive *nnOpenArchive(const char *filepath);
+
+// Returns a view of the file with the given name inside the archive, without copying it. The view is empty if there is no such file.
+// Views stay valid until the archive is closed.
+nnFileView nnArchiveFile(nnArchive *archive, const char *name);
+
+// Returns the number of files in the archive.
+int nnArchiveFileCount(nnArchive *archive);
+
+// Returns the name of the file at the given index (files are sorted by name).
+const char *nnArchiveFileName(nnArchive *archive, int index);
+
+// Closes the archive. All views into the archive become invalid.
+void nnCloseArchive(nnArchive *archive);
+
 // Lerps between min and max by the given speed. Use ease to define a smooth transition when changing direction.
 float nnLerp(float min, float max, float speed, float ease);
 
@@ -344,15 +657,24 @@ bool nnPanel(int x, int y, int width, int height);
 // Displays text with an optional border. Wraps text within the defined width and clips it if it exceeds the provided height.
 void nnLabel(const char *format, int x, int y, int width, int height, bool border, ...);
 
+// Same as `nnLabel` for `length` bytes of text that are shown as they are, without formatting.
+void nnLabelN(const char *text, size_t length, int x, int y, int width, int height, bool border);
+
 // A basic single line text input box.
 int nnTextInput(char *buffer, int maxLength, int x, int y, int width, int height, const char *placeholder);
 
 // Button that returns `true` when it has been clicked.
 bool nnButton(const char *format, int x, int y, int width, int height, ...);
 
+// Same as `nnButton` for `length` bytes of text that are shown as they are, without formatting.
+bool nnButtonN(const char *text, size_t length, int x, int y, int width, int height);
+
 // Checkbox that returns `true` when it is checked, otherwise `false`
 bool nnCheckbox(const char *format, bool isChecked, int x, int y, ...);
 
+// Same as `nnCheckbox` for `length` bytes of text that are shown as they are, without formatting.
+bool nnCheckboxN(const char *text, size_t length, bool isChecked, int x, int y);
+
 // Horizontal slider that returns the current set value.
 float nnHSlider(float min, float max, float initial, float step, int x, int y, int height);
 
@@ -370,9 +692,100 @@ int nnVProgressbar(float min, float max, float deltaFillState, int x, int y, int
 // A dropdown that accepts a list of options to choose from. Returns the selected index.
 int nnDropdown(const char *buttonText, const char **options, int numOptions, int x, int y, int width, int height);
 
+// A dropdown with a filter text field for large option sets. Typing narrows the options down to those containing the typed text,
+// options starting with it are listed first. Returns the selected index into `options`.
+int nnFilterDropdown(const char *buttonText, const char **options, int numOptions, int x, int y, int width, int height);
+
 // A scrollable list that accepty items to choose from. Returns the selected index.
 int nnScrollableList(const char **items, int numItems, int x, int y, int width, int height);
 
+// A virtualized scrollable list for large amounts of items. Items are fetched through `itemFunc` only when they become visible.
+// `heightFunc` can be `NULL` for rows of equal height. Supports smooth scrolling and keyboard navigation. Returns the selected index.
+int nnVirtualList(nnListItemFunc itemFunc, nnListItemHeightFunc heightFunc, void *userData, int numItems, int x, int y, int width, int height);
+
+// A multi-line text view for large documents. Only the visible lines are drawn. If `editable` is `true` the document can be edited
+// once the view has been clicked. Returns the cursor offset in bytes.
+size_t nnTextView(nnTextDocument *document, bool editable, int x, int y, int width, int height);
+
+// A line plot of the samples in the given plot data. Zoom with the mouse wheel and pan by dragging. While the newest sample is
+// visible the plot follows newly appended samples.
+void nnPlot(nnPlotData *data, int x, int y, int width, int height);
+
+//// Text Documents
+
+// Creates a text document from the given text (which gets copied).
+nnTextDocument *nnCreateTextDocument(const char *text, size_t length);
+
+// Loads a text document from the specified file path.
+nnTextDocument *nnLoadTextDocument(const char *filepath);
+
+// Inserts text at the given byte offset.
+void nnTextDocumentInsert(nnTextDocument *document, size_t offset, const char *text, size_t length);
+
+// Deletes `length` bytes starting at the given byte offset.
+void nnTextDocumentDelete(nnTextDocument *document, size_t offset, size_t length);
+
+// Returns the length of the document in bytes.
+size_t nnTextDocumentLength(nnTextDocument *document);
+
+// Returns the number of lines in the document.
+size_t nnTextDocumentLineCount(nnTextDocument *document);
+
+// Returns the byte offset at which the given line (starting at 0) begins.
+size_t nnTextDocumentLineOffset(nnTextDocument *document, size_t line);
+
+// Returns the line (starting at 0) that contains the given byte offset.
+size_t nnTextDocumentLineAt(nnTextDocument *document, size_t offset);
+
+// Copies up to `length` bytes starting at `offset` into `buffer` and returns the number of bytes copied. The buffer is not zero terminated.
+size_t nnTextDocumentGetText(nnTextDocument *document, size_t offset, size_t length, char *buffer);
+
+// Free the given text document.
+void nnFreeTextDocument(nnTextDocument *document);
+
+//// Plot Data
+
+// Creates plot data that keeps the newest `capacity` samples.
+nnPlotData *nnCreatePlotData(size_t capacity);
+
+// Appends samples to the plot data. The oldest samples are dropped once the capacity is reached.
+void nnPlotAppend(nnPlotData *data, const float *samples, size_t count);
+
+// Removes all samples from the plot data.
+void nnPlotClear(nnPlotData *data);
+
+// Returns the number of samples currently in the plot data.
+size_t nnPlotSampleCount(nnPlotData *data);
+
+// Free the given plot data.
+void nnFreePlotData(nnPlotData *data);
+
+// Begins a cached gui region. The region is rendered into an offscreen texture and that texture is redrawn on later frames
+// as long as no input touched the region, the theme did not change and none of the widget states drawn inside it changed.
+// Returns `true` if the gui elements inside the region have to be drawn this frame, `false` if the cached texture is used instead.
+// Always call `nnGuiEndCached` afterwards. Text and values passed to the widgets are not seen while the texture is used,
+// so call `nnGuiInvalidateCached` when they change (e.g. a label showing a counter).
+bool nnGuiBeginCached(unsigned int id, nnRecf rect);
+
+// Ends the cached gui region started with `nnGuiBeginCached` and draws it.
+void nnGuiEndCached();
+
+// Forces the cached gui region with the given id to be redrawn (e.g. when the data it displays has changed).
+void nnGuiInvalidateCached(unsigned int id);
+
+// Enables the UI atlas: glyphs of all fonts, a white pixel for solid fills and atlas images share RGBA atlas pages, so gui elements
+// and their text are drawn in one batch without texture switches. Must be called before any font is loaded or text is drawn.
+void nnSetUIAtlas(bool enabled);
+
+// Loads a small image (e.g. an icon or a checkbox mark) into the UI atlas. Atlas images stay in the atlas until the program ends.
+nnAtlasImage nnLoadAtlasImage(const char *filepath);
+
+// Loads a small image from memory into the UI atlas.
+nnAtlasImage nnLoadAtlasImageMem(const unsigned char *data, int size);
+
+// Draws an atlas image with the current color, in the same batch as the gui elements and text around it.
+void nnDrawAtlasImage(nnAtlasImage image, int x, int y);
+
 /******************************************************************************************************************************/
 /*  End of Public Interface */
 /******************************************************************************************************************************/
@@ -393,8 +806,31 @@ int nnScrollableList(const char **items, int numItems, int x, int y, int width,
 #define STB_TRUETYPE_IMPLEMENTATION
 #include "internal/include/stb_truetype.h"
 
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+
+// Pixmap blits use SSE2 where the compiler targets it, the four floats of a pixel fill one register
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _NN_SSE
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "internal/include/key_definitions.h"
 #include "internal/include/default_font.h"
+#include "internal/include/default_font_atlas.h"
+#include "internal/include/debug_font.h"
 
 #define _NN_MAX_KEYS 256
 #define _NN_MAX_MOUSE_BUTTONS 3
@@ -416,6 +852,7 @@ typedef struct
     float windowScaleX;
     float windowScaleY;
     nnFont *font;
+    nnFont *defaultFont; // Created on first text use, see nnGetFont
     nnColorf currentDrawColor;
     bool debugMode;
 
@@ -438,6 +875,8 @@ typedef struct
 
     // Gui
     bool isAnyPopupOpen;
+    bool anyKeyEvent;        // Whether a key was pressed or released this frame
+    unsigned int frameCount; // Number of frames rendered so far
 
     // Function pointer for the display callback
     void (*displayCallback)(void);
@@ -520,6 +959,35 @@ typedef struct
 static _nnDropdownState _nnDropdownStates[_NN_MAX_DROPDOWN_STATES];
 static int _nnDropdownStateCount = 0;
 
+#define _NN_FILTER_TRIGRAM_BUCKETS 4096 // Must be a power of two
+#define _NN_FILTER_MAX_LENGTH 128
+typedef struct
+{
+    unsigned int id;
+    bool isOpen;
+    int selectedIndex;    // Selected option index (-1 means no selection)
+    int highlightedMatch; // Match highlighted with the arrow keys
+    int scrollOffset;     // Scroll offset in terms of matches
+    char filter[_NN_FILTER_MAX_LENGTH];
+
+    // Index over the options, only rebuilt when the options pointer or count changes
+    const char **options;
+    int numOptions;
+    char *lowerText;     // Lowercase copies of all options, zero terminated one after another
+    int *lowerOffsets;   // Start of each option in `lowerText`
+    int *trigramStarts;  // Start of each trigram bucket in `trigramOptions` (_NN_FILTER_TRIGRAM_BUCKETS + 1 entries)
+    int *trigramOptions; // Options containing a trigram of each bucket, ascending per bucket
+
+    // Result of the last query, prefix matches first
+    char matchedFilter[_NN_FILTER_MAX_LENGTH];
+    int *matches;
+    int numMatches;
+} _nnFilterDropdownState;
+
+#define _NN_MAX_FILTER_DROPDOWN_STATES 16
+static _nnFilterDropdownState _nnFilterDropdownStates[_NN_MAX_FILTER_DROPDOWN_STATES];
+static int _nnFilterDropdownStateCount = 0;
+
 typedef struct
 {
     unsigned int id;
@@ -531,6 +999,178 @@ typedef struct
 static _nnScrollableListState _nnScrollableListStates[_NN_MAX_SCROLLABLELIST_STATES];
 static int _nnScrollableListStateCount = 0;
 
+#define _NN_VIRTUALLIST_CACHE_SIZE 128 // Must be a power of two
+#define _NN_VIRTUALLIST_CACHE_TEXT_LENGTH 256
+typedef struct
+{
+    int index;         // Item index the entry belongs to (-1 if unused)
+    unsigned int hash; // Hash of the item text the entry was created from
+    float maxWidth;    // Width the text was truncated to
+    nnFont *font;      // Font the text was measured with
+    char text[_NN_VIRTUALLIST_CACHE_TEXT_LENGTH];
+} _nnVirtualListCacheEntry;
+
+typedef struct
+{
+    unsigned int id;
+    int selectedIndex;
+    bool hasFocus;
+    bool draggingScrollbar;
+    float scrollY;      // Current scroll position in pixels
+    float scrollTarget; // Scroll position the list eases towards
+    int *rowOffsets;    // Prefix sums of the row heights: rowOffsets[i] is the top of row i, rowOffsets[numRows] the total height
+    int numRows;        // Number of rows in the height index
+    int rowCapacity;
+    nnListItemHeightFunc heightFunc; // Height function and user data the index was built with
+    void *userData;
+    _nnVirtualListCacheEntry cache[_NN_VIRTUALLIST_CACHE_SIZE]; // Truncated display strings, indexed by item index
+} _nnVirtualListState;
+
+// Piece of a text document, stored in a treap ordered by document position.
+typedef struct _nnPieceNode
+{
+    struct _nnPieceNode *left;
+    struct _nnPieceNode *right;
+    unsigned int priority;
+    int buffer;              // 0 = original text, 1 = added text
+    size_t start;            // Start of the piece in its buffer
+    size_t length;           // Length of the piece in bytes
+    size_t lineFeeds;        // Number of '\n' in the piece
+    size_t subtreeLength;    // Length of all pieces in this subtree
+    size_t subtreeLineFeeds; // Number of '\n' in this subtree
+} _nnPieceNode;
+
+struct _nnTextDocument
+{
+    char *buffers[2]; // Original text and append-only added text
+    size_t bufferLengths[2];
+    size_t bufferCapacities[2];
+    size_t *lineFeeds[2]; // Ascending positions of all '\n' in each buffer
+    size_t lineFeedCounts[2];
+    size_t lineFeedCapacities[2];
+    _nnPieceNode *root;
+};
+
+typedef struct
+{
+    unsigned int id;
+    nnTextDocument *document;
+    bool hasFocus;
+    size_t cursor;         // Cursor offset in bytes
+    float preferredX;      // Horizontal cursor position kept when moving up and down
+    size_t scrollLine;     // First visible line
+    float scrollX;         // Horizontal scroll in pixels
+    nnFont *advanceFont;   // Font the glyph advances were cached for
+    float advances[128];   // Horizontal advance of each ASCII character
+} _nnTextViewState;
+
+#define _NN_PLOT_MAX_LEVELS 32
+#define _NN_PLOT_LEVEL_SHIFT 2 // Every pyramid level combines 4 blocks of the level below
+
+struct _nnPlotData
+{
+    float *samples; // Ring buffer of the newest samples
+    size_t capacity;
+    size_t total; // Number of samples appended since creation or the last clear
+    int levelCount;
+    float *levelMin[_NN_PLOT_MAX_LEVELS]; // Level k holds the min/max of blocks of 4^k samples, also as ring buffers
+    float *levelMax[_NN_PLOT_MAX_LEVELS];
+    size_t levelMasks[_NN_PLOT_MAX_LEVELS]; // Level capacities are powers of two, so a block's slot is `block & mask`
+};
+
+typedef struct
+{
+    unsigned int id;
+    nnPlotData *data;
+    bool zoomed;         // false = show all samples
+    bool follow;         // Keep the newest sample in view
+    bool dragging;
+    int lastMouseX;
+    double viewStart;    // First visible sample (absolute index)
+    double viewLength;   // Number of visible samples
+    float *vertices;     // Line strip vertices, reused every frame
+    int vertexCapacity;
+} _nnPlotState;
+
+#define _NN_MAX_PLOT_STATES 16
+static _nnPlotState _nnPlotStates[_NN_MAX_PLOT_STATES];
+static int _nnPlotStateCount = 0;
+
+#define _NN_MAX_TEXTVIEW_STATES 16
+static _nnTextViewState _nnTextViewStates[_NN_MAX_TEXTVIEW_STATES];
+static int _nnTextViewStateCount = 0;
+
+#define _NN_MAX_VIRTUALLIST_STATES 16
+static _nnVirtualListState *_nnVirtualListStates[_NN_MAX_VIRTUALLIST_STATES];
+static int _nnVirtualListStateCount = 0;
+
+// Kinds of widget states a cached gui region can depend on
+#define _NN_CACHED_WIDGET_TEXTINPUT 0
+#define _NN_CACHED_WIDGET_CHECKBOX 1
+#define _NN_CACHED_WIDGET_SLIDER 2
+#define _NN_CACHED_WIDGET_PROGRESSBAR 3
+#define _NN_CACHED_WIDGET_DROPDOWN 4
+#define _NN_CACHED_WIDGET_FILTER_DROPDOWN 5
+#define _NN_CACHED_WIDGET_SCROLLABLELIST 6
+#define _NN_CACHED_WIDGET_VIRTUALLIST 7
+#define _NN_CACHED_WIDGET_TEXTVIEW 8
+#define _NN_CACHED_WIDGET_PLOT 9
+
+typedef struct
+{
+    int kind;          // One of the _NN_CACHED_WIDGET_* kinds
+    const void *state; // Widget state of that kind
+} _nnCachedRegionWidget;
+
+#define _NN_MAX_CACHED_REGION_WIDGETS 64
+typedef struct
+{
+    unsigned int id;
+    nnRecf rect;
+    unsigned int framebuffer; // Framebuffer object the region is rendered into
+    unsigned int textureID;   // Color attachment of the framebuffer
+    int textureWidth;         // Texture size in window pixels
+    int textureHeight;
+    unsigned int stateHash; // Hash of theme, font, scale and the states of `widgets` when the texture was rendered
+    bool valid;             // Whether the texture holds an up to date rendering of the region
+    bool wasHovered;        // Whether the mouse was inside the region last frame
+    _nnCachedRegionWidget widgets[_NN_MAX_CACHED_REGION_WIDGETS]; // Widget states drawn while the texture was rendered
+    int widgetCount;
+    bool tooManyWidgets; // More widgets were drawn than fit into `widgets`, so the region can not be cached
+} _nnCachedRegionState;
+
+#define _NN_MAX_CACHED_REGION_STATES 32
+static _nnCachedRegionState _nnCachedRegionStates[_NN_MAX_CACHED_REGION_STATES];
+static int _nnCachedRegionStateCount = 0;
+
+// Region currently being recorded or drawn between nnGuiBeginCached and nnGuiEndCached
+static _nnCachedRegionState *_nnActiveCachedRegion = NULL;
+static bool _nnActiveCachedRegionRecording = false;
+
+// Remembers that the region being recorded draws the given widget state. Only the states a region draws can invalidate it.
+static void _nnTrackCachedRegionWidget(int kind, const void *widgetState)
+{
+    _nnCachedRegionState *region = _nnActiveCachedRegion;
+    if (!region || !_nnActiveCachedRegionRecording)
+        return;
+
+    for (int i = 0; i < region->widgetCount; i++)
+    {
+        if (region->widgets[i].state == widgetState)
+            return;
+    }
+    if (region->widgetCount >= _NN_MAX_CACHED_REGION_WIDGETS)
+    {
+        if (!region->tooManyWidgets)
+            printf("Error: Too many widgets in a cached gui region! Increase _NN_MAX_CACHED_REGION_WIDGETS.\n");
+        region->tooManyWidgets = true;
+        return;
+    }
+    region->widgets[region->widgetCount].kind = kind;
+    region->widgets[region->widgetCount].state = widgetState;
+    region->widgetCount++;
+}
+
 static _nnState _nnstate;
 
 #define _NN_Z_INDEX_POPUP 0.1f
@@ -547,2332 +1187,8172 @@ unsigned int _nnGenUID(int x, int y)
     return hash;
 }
 
-// Wrapper display function that calls the function pointer
-static void _nnDisplayCallbackWrapper()
+// Continue a FNV-1a hash with the given bytes.
+static unsigned int _nnHashBytes(unsigned int hash, const void *data, size_t size)
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-    if (_nnstate.displayCallback != NULL)
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++)
     {
-        _nnstate.displayCallback();
+        hash ^= bytes[i];
+        hash *= 16777619u;
     }
+    return hash;
+}
 
-    nnFlushKeys();
-    nnFlushMouse();
-    _nnstate.mouseWheelDelta = 0;
-    _nnstate.mouseMotionDelta.x = 0;
-    _nnstate.mouseMotionDelta.y = 0;
+typedef void (*_nnProc)(void);
 
-    glutSwapBuffers();
-    glutMainLoopEvent();
+// Looks up an OpenGL function. Going through a generic function pointer keeps casts to the actual signature warning free.
+static _nnProc _nnGetProcAddress(const char *name)
+{
+    return (_nnProc)glutGetProcAddress(name);
 }
 
-static void _nnSetupOrthoProjection(int width, int height)
+/*
+ * Framebuffer objects are not part of OpenGL 1.1, so they are loaded at runtime (core names first, then the EXT variants).
+ */
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+
+typedef void(APIENTRY *_nnGenFramebuffersFunc)(GLsizei n, GLuint *framebuffers);
+typedef void(APIENTRY *_nnDeleteFramebuffersFunc)(GLsizei n, const GLuint *framebuffers);
+typedef void(APIENTRY *_nnBindFramebufferFunc)(GLenum target, GLuint framebuffer);
+typedef void(APIENTRY *_nnFramebufferTexture2DFunc)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef GLenum(APIENTRY *_nnCheckFramebufferStatusFunc)(GLenum target);
+typedef void(APIENTRY *_nnBlendFuncSeparateFunc)(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+
+static _nnGenFramebuffersFunc _nnGenFramebuffers = NULL;
+static _nnDeleteFramebuffersFunc _nnDeleteFramebuffers = NULL;
+static _nnBindFramebufferFunc _nnBindFramebuffer = NULL;
+static _nnFramebufferTexture2DFunc _nnFramebufferTexture2D = NULL;
+static _nnCheckFramebufferStatusFunc _nnCheckFramebufferStatus = NULL;
+static _nnBlendFuncSeparateFunc _nnBlendFuncSeparate = NULL; // Needed to render premultiplied alpha into cached gui regions
+
+// Returns `true` if framebuffer objects are supported. The functions are only looked up once.
+static bool _nnLoadFramebufferFuncs()
 {
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(0.0, width, height, 0.0, -1.0, 1.0);
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
+    static bool loaded = false;
+    static bool supported = false;
+    if (loaded)
+        return supported;
+    loaded = true;
+
+    _nnGenFramebuffers = (_nnGenFramebuffersFunc)_nnGetProcAddress("glGenFramebuffers");
+    _nnDeleteFramebuffers = (_nnDeleteFramebuffersFunc)_nnGetProcAddress("glDeleteFramebuffers");
+    _nnBindFramebuffer = (_nnBindFramebufferFunc)_nnGetProcAddress("glBindFramebuffer");
+    _nnFramebufferTexture2D = (_nnFramebufferTexture2DFunc)_nnGetProcAddress("glFramebufferTexture2D");
+    _nnCheckFramebufferStatus = (_nnCheckFramebufferStatusFunc)_nnGetProcAddress("glCheckFramebufferStatus");
+
+    if (!_nnGenFramebuffers || !_nnDeleteFramebuffers || !_nnBindFramebuffer || !_nnFramebufferTexture2D || !_nnCheckFramebufferStatus)
+    {
+        _nnGenFramebuffers = (_nnGenFramebuffersFunc)_nnGetProcAddress("glGenFramebuffersEXT");
+        _nnDeleteFramebuffers = (_nnDeleteFramebuffersFunc)_nnGetProcAddress("glDeleteFramebuffersEXT");
+        _nnBindFramebuffer = (_nnBindFramebufferFunc)_nnGetProcAddress("glBindFramebufferEXT");
+        _nnFramebufferTexture2D = (_nnFramebufferTexture2DFunc)_nnGetProcAddress("glFramebufferTexture2DEXT");
+        _nnCheckFramebufferStatus = (_nnCheckFramebufferStatusFunc)_nnGetProcAddress("glCheckFramebufferStatusEXT");
+    }
+
+    _nnBlendFuncSeparate = (_nnBlendFuncSeparateFunc)_nnGetProcAddress("glBlendFuncSeparate");
+    if (!_nnBlendFuncSeparate)
+        _nnBlendFuncSeparate = (_nnBlendFuncSeparateFunc)_nnGetProcAddress("glBlendFuncSeparateEXT");
+
+    supported = _nnGenFramebuffers && _nnDeleteFramebuffers && _nnBindFramebuffer && _nnFramebufferTexture2D && _nnCheckFramebufferStatus && _nnBlendFuncSeparate;
+    if (!supported)
+    {
+        printf("Framebuffer objects or separate blend functions are not supported, cached gui regions will be drawn directly.\n");
+    }
+    return supported;
 }
 
-static void _nnSetScale(float scaleX, float scaleY)
+// Sets up regular alpha blending. While a cached gui region is recorded the alpha channel is accumulated separately,
+// so the region's texture ends up with premultiplied colors and the coverage of everything drawn into it.
+static void _nnBlendAlpha()
 {
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
-    glScalef(scaleX, scaleY, 1.0f);
+    if (_nnActiveCachedRegionRecording)
+        _nnBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    else
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
-static void _nnUpdateScale(int width, int height, int shouldUpdate)
+/*
+ * Shader functions are not part of OpenGL 1.1 either. They are only used for signed distance field text.
+ */
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS 0x8B82
+#endif
+
+typedef GLuint(APIENTRY *_nnCreateShaderFunc)(GLenum type);
+typedef void(APIENTRY *_nnShaderSourceFunc)(GLuint shader, GLsizei count, const char *const *string, const GLint *length);
+typedef void(APIENTRY *_nnCompileShaderFunc)(GLuint shader);
+typedef void(APIENTRY *_nnGetShaderivFunc)(GLuint shader, GLenum pname, GLint *params);
+typedef GLuint(APIENTRY *_nnCreateProgramFunc)(void);
+typedef void(APIENTRY *_nnAttachShaderFunc)(GLuint program, GLuint shader);
+typedef void(APIENTRY *_nnLinkProgramFunc)(GLuint program);
+typedef void(APIENTRY *_nnGetProgramivFunc)(GLuint program, GLenum pname, GLint *params);
+typedef void(APIENTRY *_nnUseProgramFunc)(GLuint program);
+
+static _nnUseProgramFunc _nnUseProgram = NULL;
+
+// Fragment shader for signed distance field text. The outline is at 0.5 and edges are smoothed over about one screen pixel, whatever the scale.
+static const char *_nnSDFShaderSource =
+    "uniform sampler2D atlas;\n"
+    "void main()\n"
+    "{\n"
+    "    float distance = texture2D(atlas, gl_TexCoord[0].st).a;\n"
+    "    float smoothing = max(fwidth(distance) * 0.7, 0.001);\n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
+    "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);\n"
+    "}\n";
+
+// Returns the program that renders signed distance field text, or 0 if shaders are not supported. It is only built once.
+static GLuint _nnLoadSDFShader()
 {
-    if (shouldUpdate != 0)
+    static bool loaded = false;
+    static GLuint program = 0;
+    if (loaded)
+        return program;
+    loaded = true;
+
+    _nnCreateShaderFunc createShader = (_nnCreateShaderFunc)_nnGetProcAddress("glCreateShader");
+    _nnShaderSourceFunc shaderSource = (_nnShaderSourceFunc)_nnGetProcAddress("glShaderSource");
+    _nnCompileShaderFunc compileShader = (_nnCompileShaderFunc)_nnGetProcAddress("glCompileShader");
+    _nnGetShaderivFunc getShaderiv = (_nnGetShaderivFunc)_nnGetProcAddress("glGetShaderiv");
+    _nnCreateProgramFunc createProgram = (_nnCreateProgramFunc)_nnGetProcAddress("glCreateProgram");
+    _nnAttachShaderFunc attachShader = (_nnAttachShaderFunc)_nnGetProcAddress("glAttachShader");
+    _nnLinkProgramFunc linkProgram = (_nnLinkProgramFunc)_nnGetProcAddress("glLinkProgram");
+    _nnGetProgramivFunc getProgramiv = (_nnGetProgramivFunc)_nnGetProcAddress("glGetProgramiv");
+    _nnUseProgram = (_nnUseProgramFunc)_nnGetProcAddress("glUseProgram");
+
+    if (!createShader || !shaderSource || !compileShader || !getShaderiv || !createProgram || !attachShader || !linkProgram || !getProgramiv || !_nnUseProgram)
     {
-        _nnstate.windowScaleX = (float)width / _nnstate.initialWidth;
-        _nnstate.windowScaleY = (float)height / _nnstate.initialHeight;
-        _nnSetScale(_nnstate.windowScaleX, _nnstate.windowScaleY);
+        printf("Shaders are not supported, signed distance field text will be drawn with alpha testing.\n");
+        return 0;
     }
+
+    GLint status = 0;
+    GLuint shader = createShader(GL_FRAGMENT_SHADER);
+    shaderSource(shader, 1, &_nnSDFShaderSource, NULL);
+    compileShader(shader);
+    getShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status)
+    {
+        program = createProgram();
+        attachShader(program, shader);
+        linkProgram(program);
+        getProgramiv(program, GL_LINK_STATUS, &status);
+    }
+
+    if (!status)
+    {
+        printf("Failed to build the signed distance field shader, text will be drawn with alpha testing.\n");
+        program = 0;
+    }
+    return program;
 }
 
-static void _nnFramebufferSizeCallback(int width, int height)
+// Sets up rendering of signed distance field glyphs: thresholded in the shader, or with the alpha test if there is none
+static void _nnBeginSDFText()
 {
-    _nnstate.windowWidth = width;
-    _nnstate.windowHeight = height;
-    glViewport(0, 0, width, height);
-    _nnSetupOrthoProjection(width, height);
-    _nnUpdateScale(width, height, _nnstate.virtual);
+    GLuint program = _nnLoadSDFShader();
+    if (program)
+    {
+        _nnUseProgram(program);
+        return;
+    }
+
+    glDisable(GL_BLEND);
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GEQUAL, 0.5f);
 }
 
-static void _nnTimerCallback(int value)
+static void _nnEndSDFText()
 {
-    // Parameters for FPS averaging
-#define _NN_FPS_BUFFER_SIZE 20                          // Number of frames to average over
-    static double fpsBuffer[_NN_FPS_BUFFER_SIZE] = {0}; // Circular buffer for FPS values
-    static int fpsIndex = 0;                            // Current index in the buffer
-    static double fpsSum = 0;                           // Sum of all FPS values in the buffer
-    static int fpsCount = 0;                            // Number of frames added to the buffer
+    if (_nnLoadSDFShader())
+    {
+        _nnUseProgram(0);
+        return;
+    }
 
-    // Calculate deltaTime and instantaneous FPS
-    double elapsedTime = glutGet(GLUT_ELAPSED_TIME);
-    double currentTime = elapsedTime / 1000.0; // Get time in seconds
-    _nnstate.deltaTime = currentTime - _nnstate.lastTime;
-    double instantaneousFPS = (_nnstate.deltaTime > 0) ? (1.0 / _nnstate.deltaTime) : 0;
-    _nnstate.lastTime = currentTime;
+    glDisable(GL_ALPHA_TEST);
+}
 
-    // Update the FPS buffer
-    fpsSum -= fpsBuffer[fpsIndex];          // Remove the old value from the sum
-    fpsBuffer[fpsIndex] = instantaneousFPS; // Add the new value to the buffer
-    fpsSum += instantaneousFPS;             // Add the new value to the sum
+/*
+ * Vertex buffer objects came with OpenGL 1.5. Text objects and paths keep their quads in one, or in client memory without them.
+ */
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STATIC_DRAW
+#define GL_STATIC_DRAW 0x88E4
+#endif
+
+typedef void(APIENTRY *_nnGenBuffersFunc)(GLsizei n, GLuint *buffers);
+typedef void(APIENTRY *_nnDeleteBuffersFunc)(GLsizei n, const GLuint *buffers);
+typedef void(APIENTRY *_nnBindBufferFunc)(GLenum target, GLuint buffer);
+typedef void(APIENTRY *_nnBufferDataFunc)(GLenum target, ptrdiff_t size, const void *data, GLenum usage);
+
+static _nnGenBuffersFunc _nnGenBuffers = NULL;
+static _nnDeleteBuffersFunc _nnDeleteBuffers = NULL;
+static _nnBindBufferFunc _nnBindBuffer = NULL;
+static _nnBufferDataFunc _nnBufferData = NULL;
+
+// Returns `true` if vertex buffer objects are supported. The functions are only looked up once.
+static bool _nnLoadBufferFuncs()
+{
+    static bool loaded = false;
+    static bool supported = false;
+    if (loaded)
+        return supported;
+    loaded = true;
+
+    _nnGenBuffers = (_nnGenBuffersFunc)_nnGetProcAddress("glGenBuffers");
+    _nnDeleteBuffers = (_nnDeleteBuffersFunc)_nnGetProcAddress("glDeleteBuffers");
+    _nnBindBuffer = (_nnBindBufferFunc)_nnGetProcAddress("glBindBuffer");
+    _nnBufferData = (_nnBufferDataFunc)_nnGetProcAddress("glBufferData");
+
+    if (!_nnGenBuffers || !_nnDeleteBuffers || !_nnBindBuffer || !_nnBufferData)
+    {
+        _nnGenBuffers = (_nnGenBuffersFunc)_nnGetProcAddress("glGenBuffersARB");
+        _nnDeleteBuffers = (_nnDeleteBuffersFunc)_nnGetProcAddress("glDeleteBuffersARB");
+        _nnBindBuffer = (_nnBindBufferFunc)_nnGetProcAddress("glBindBufferARB");
+        _nnBufferData = (_nnBufferDataFunc)_nnGetProcAddress("glBufferDataARB");
+    }
 
-    fpsIndex = (fpsIndex + 1) % _NN_FPS_BUFFER_SIZE; // Move to the next index
-    if (fpsCount < _NN_FPS_BUFFER_SIZE)
+    supported = _nnGenBuffers && _nnDeleteBuffers && _nnBindBuffer && _nnBufferData;
+    if (!supported)
     {
-        fpsCount++; // Increase the count until the buffer is full
+        printf("Vertex buffer objects are not supported, text objects and paths will be drawn from client memory.\n");
     }
+    return supported;
+}
 
-    // Calculate the average FPS
-    _nnstate.currentFPS = fpsSum / fpsCount;
-
-    // Update global variables
-    nnFPS = _nnstate.currentFPS;
-    nnDT = _nnstate.deltaTime;
-    nnMS = (unsigned int)elapsedTime;
-
-    // Trigger display refresh
-    glutPostRedisplay();
+// Sets the scissor rectangle in screen coordinates, respecting the window scale and an active cached gui region.
+static void _nnScissor(int x, int y, int width, int height)
+{
+    if (_nnActiveCachedRegion && _nnActiveCachedRegionRecording)
+    {
+        _nnCachedRegionState *region = _nnActiveCachedRegion;
+        float sx = region->textureWidth / region->rect.width;
+        float sy = region->textureHeight / region->rect.height;
+        glScissor((int)((x - region->rect.x) * sx), (int)(region->textureHeight - (y + height - region->rect.y) * sy), (int)(width * sx), (int)(height * sy));
+        return;
+    }
 
-    // Re-register the timer callback to get targetFPS
-    glutTimerFunc(1000 / _nnstate.targetFPS, _nnTimerCallback, 0);
+    glScissor((int)(x * _nnstate.windowScaleX), (int)(_nnstate.windowHeight - (y + height) * _nnstate.windowScaleY), (int)(width * _nnstate.windowScaleX), (int)(height * _nnstate.windowScaleY));
 }
 
-static void _nnKeyDownCallback(unsigned char key, int x, int y)
+// Creates a texture from RGBA pixels using the filtering of the window.
+static unsigned int _nnCreateImageTexture(const unsigned char *pixels, int width, int height)
 {
-    if (!_nnstate.keys[key]) // Normal keys (0-255)
+    unsigned int textureID;
+    glGenTextures(1, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    if (_nnstate.filtered)
     {
-        _nnstate.keysPressed[key] = true;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     }
-    _nnstate.keys[key] = true;
+    else
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    return textureID;
 }
 
-static void _nnKeyUpCallback(unsigned char key, int x, int y)
+// Sources of the memory of an nnFileView
+#define _NN_VIEW_BORROWED 0 // Owned by someone else, e.g. an archive
+#define _NN_VIEW_MAPPED 1   // Memory mapped file
+#define _NN_VIEW_BUFFERED 2 // Heap buffer
+
+// Returns the size of an open file and rewinds it, -1 on failure. ftell returns a long, which is 32 bit on Windows, and fails on files too large for it elsewhere.
+static long long _nnFileSize(FILE *file)
 {
-    _nnstate.keys[key] = false;
-    _nnstate.keysReleased[key] = true;
+#ifdef _WIN32
+    long long size = _fseeki64(file, 0, SEEK_END) == 0 ? _ftelli64(file) : -1;
+#else
+    long long size = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+#endif
+    fseek(file, 0, SEEK_SET);
+    return size;
 }
 
-static void _nnSpecialKeyCallback(int key, int x, int y)
+// Reads the whole file into a heap buffer, used if the file can't be mapped.
+static bool _nnReadFileView(const char *filepath, nnFileView *view)
 {
-    if (!_nnstate.skeys[key]) // Special keys (e.g., GLUT keys)
+    FILE *file = fopen(filepath, "rb");
+    if (!file)
+        return false;
+
+    // Files that don't fit into memory are rejected
+    long long size = _nnFileSize(file);
+    unsigned char *buffer = (size >= 0 && (unsigned long long)size <= SIZE_MAX) ? malloc(size > 0 ? (size_t)size : 1) : NULL;
+    if (!buffer || fread(buffer, 1, size, file) != (size_t)size)
     {
-        _nnstate.skeysPressed[key] = true;
+        free(buffer);
+        fclose(file);
+        return false;
     }
-    _nnstate.skeys[key] = true;
-}
+    fclose(file);
 
-static void _nnSpecialKeyUpCallback(int key, int x, int y)
-{
-    _nnstate.skeys[key] = false;
-    _nnstate.skeysReleased[key] = true;
+    view->data = buffer;
+    view->size = size;
+    view->source = _NN_VIEW_BUFFERED;
+    return true;
 }
 
-static void _nnMouseButtonCallback(int button, int state, int x, int y)
+// Maps the whole file read-only into memory. Falls back to reading it into a heap buffer.
+static bool _nnMapFile(const char *filepath, nnFileView *view)
 {
-    if (button < _NN_MAX_MOUSE_BUTTONS)
+    memset(view, 0, sizeof(*view));
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping)
     {
-        if (state == GLUT_DOWN)
-        {
-            if (!_nnstate.mouseButtons[button])
-            {
-                _nnstate.mouseButtonsPressed[button] = true;
-            }
-            _nnstate.mouseButtons[button] = true;
-        }
-        else if (state == GLUT_UP)
+        view->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        view->size = (size_t)size.QuadPart;
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+#else
+    int file = open(filepath, O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(file, &info) == 0 && info.st_size > 0)
+    {
+        void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data != MAP_FAILED)
         {
-            _nnstate.mouseButtons[button] = false;
-            _nnstate.mouseButtonsReleased[button] = true;
+            view->data = data;
+            view->size = info.st_size;
         }
     }
+    close(file);
+#endif
+    if (view->data)
+    {
+        view->source = _NN_VIEW_MAPPED;
+        return true;
+    }
+    return _nnReadFileView(filepath, view);
 }
 
-static void _nnMouseWheelFunc(int wheel, int direction, int x, int y)
+static void _nnUnmapFile(nnFileView *view)
 {
-    _nnstate.mouseWheelDelta = direction; // +1 for up, -1 for down
+    if (!view->data)
+        return;
+
+    if (view->source == _NN_VIEW_MAPPED)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(view->data);
+#else
+        munmap((void *)view->data, view->size);
+#endif
+    }
+    else if (view->source == _NN_VIEW_BUFFERED)
+    {
+        free((void *)view->data);
+    }
+    memset(view, 0, sizeof(*view));
 }
 
-static void _nnMouseMotionFunc(int x, int y)
+/*
+ * .nntex files (see tools/img2nntex.c) hold RGBA8 pixels, optionally with a mip chain, ready to be handed to glTexImage2D.
+ */
+
+#define _NN_TEX_HEADER_SIZE 32
+#define _NN_TEX_FORMAT_RGBA8 1
+
+typedef struct
 {
-    // Motion delta
-    nnPos newMousePosition = {(float)x / _nnstate.windowScaleX, (float)y / _nnstate.windowScaleY};
-    _nnstate.mouseMotionDelta.x = newMousePosition.x - _nnstate.mousePosition.x;
-    _nnstate.mouseMotionDelta.y = newMousePosition.y - _nnstate.mousePosition.y;
-    _nnstate.mousePosition = newMousePosition;
+    int width;
+    int height;
+    int mipLevels;
+    const unsigned char *pixels; // First mip level, the others follow tightly packed
+} _nnTexInfo;
+
+static unsigned int _nnReadUint32(const unsigned char *bytes)
+{
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
 }
 
-static nnFont *_nnLoadFont(const unsigned char *fontBuffer, size_t bufferSize, float fontSize)
+// Validates the header and the payload size of a .nntex file.
+static bool _nnParseTex(const unsigned char *data, size_t size, _nnTexInfo *info)
 {
-    nnFont *font = malloc(sizeof(nnFont));
-    if (!font)
+    if (size < _NN_TEX_HEADER_SIZE || memcmp(data, "NNTX", 4) != 0 || _nnReadUint32(data + 4) != 1 || _nnReadUint32(data + 16) != _NN_TEX_FORMAT_RGBA8)
+        return false;
+
+    unsigned int width = _nnReadUint32(data + 8);
+    unsigned int height = _nnReadUint32(data + 12);
+    unsigned int mipLevels = _nnReadUint32(data + 20);
+    unsigned int dataOffset = _nnReadUint32(data + 24);
+    if (width == 0 || height == 0 || width > 65536 || height > 65536 || mipLevels == 0 || mipLevels > 17 || dataOffset < _NN_TEX_HEADER_SIZE)
+        return false;
+
+    size_t payload = 0;
+    for (unsigned int level = 0; level < mipLevels; level++)
     {
-        printf("Failed to allocate memory for font.\n");
-        return NULL;
+        size_t levelWidth = (width >> level) > 0 ? (width >> level) : 1;
+        size_t levelHeight = (height >> level) > 0 ? (height >> level) : 1;
+        payload += levelWidth * levelHeight * 4;
     }
+    if (dataOffset > size || payload > size - dataOffset)
+        return false;
+
+    info->width = width;
+    info->height = height;
+    info->mipLevels = mipLevels;
+    info->pixels = data + dataOffset;
+    return true;
+}
+
+// Creates a texture from a parsed .nntex file, straight from the (mapped) file data.
+static unsigned int _nnCreateTexTexture(const _nnTexInfo *info)
+{
+    unsigned int textureID = _nnCreateImageTexture(info->pixels, info->width, info->height);
 
-    // Allocate and copy the font data into font buffer
-    font->fontBuffer = malloc(bufferSize);
-    if (!font->fontBuffer)
+    // A mip chain is only used if it is complete down to 1x1
+    int fullChain = 1;
+    for (int size = info->width > info->height ? info->width : info->height; size > 1; size /= 2)
+        fullChain++;
+    if (info->mipLevels != fullChain)
+        return textureID;
+
+    const unsigned char *pixels = info->pixels;
+    for (int level = 1; level < info->mipLevels; level++)
     {
-        printf("Failed to allocate memory for font buffer.\n");
-        free(font);
-        return NULL;
+        pixels += (size_t)(info->width >> (level - 1) > 0 ? info->width >> (level - 1) : 1) * (info->height >> (level - 1) > 0 ? info->height >> (level - 1) : 1) * 4;
+        int levelWidth = info->width >> level > 0 ? info->width >> level : 1;
+        int levelHeight = info->height >> level > 0 ? info->height >> level : 1;
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, levelWidth, levelHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
     }
-    memcpy(font->fontBuffer, fontBuffer, bufferSize);
-
-    // Initialize font info
-    if (!stbtt_InitFont(&font->fontInfo, font->fontBuffer, 0))
+    if (_nnstate.filtered)
     {
-        printf("Failed to initialize font.\n");
-        free(font->fontBuffer);
-        free(font);
-        return NULL;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     }
+    return textureID;
+}
 
-    // Calculate font scale
-    font->scale = stbtt_ScaleForPixelHeight(&font->fontInfo, fontSize);
-
-    // Calculate height from actual glyphs (averaging between capital and lowercase letters)
-    int minYCap, maxYCap, minYLower, maxYLower;
-
-    // Get bounding box for a capital letter (e.g., 'A')
-    stbtt_GetCodepointBox(&font->fontInfo, 'A', NULL, &minYCap, NULL, &maxYCap);
+/*
+ * Asynchronous image loading: worker threads take jobs from a mutex protected queue, decode them and push the results onto a
+ * lock-free stack. The GL thread takes the whole stack at the start of every frame and uploads as many images as the budget allows.
+ */
 
-    // Get bounding box for a lowercase letter (e.g., 'x')
-    stbtt_GetCodepointBox(&font->fontInfo, 'x', NULL, &minYLower, NULL, &maxYLower);
+#define _NN_IMAGE_LOADER_THREADS 4
 
-    // Scale and average the heights
-    float capHeight = font->scale * (maxYCap - minYCap);
-    float lowerHeight = font->scale * (maxYLower - minYLower);
-    font->glyphHeight = (capHeight + lowerHeight) / 2.0f;
+#define _NN_ASYNC_IMAGE_LOADING 0
+#define _NN_ASYNC_IMAGE_READY 1
+#define _NN_ASYNC_IMAGE_FAILED 2
 
-    // Create the font atlas
-    font->atlasWidth = 512;
-    font->atlasHeight = 512;
+struct _nnAsyncImage
+{
+    char *filepath;
+    unsigned char *pixels; // Decoded pixels, NULL if decoding failed
+    int width;
+    int height;
+    bool isTex;            // Mapped .nntex file instead of decoded pixels
+    nnFileView view;
+    _nnTexInfo tex;
+    int status;         // Only changed on the GL thread
+    bool freed;         // Freed by the user while still loading
+    nnImage image;
+    struct _nnAsyncImage *next; // Link in the job queue, the decoded stack or the upload list
+};
 
-    unsigned char *bitmap = calloc(1, font->atlasWidth * font->atlasHeight);
-    if (!bitmap)
+#ifdef _WIN32
+static HANDLE _nnImageWorkers[_NN_IMAGE_LOADER_THREADS];
+static CRITICAL_SECTION _nnImageJobMutex;
+static HANDLE _nnImageJobSignal; // Semaphore counting the queued jobs
+#else
+static pthread_t _nnImageWorkers[_NN_IMAGE_LOADER_THREADS];
+static pthread_mutex_t _nnImageJobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t _nnImageJobSignal = PTHREAD_COND_INITIALIZER;
+#endif
+static bool _nnImageWorkersRunning = false;
+static volatile bool _nnImageWorkersQuit = false;
+
+static nnAsyncImage *_nnImageJobHead = NULL; // Guarded by _nnImageJobMutex
+static nnAsyncImage *_nnImageJobTail = NULL;
+static nnAsyncImage *volatile _nnDecodedImages = NULL; // Lock-free stack, newest first
+static nnAsyncImage *_nnUploadHead = NULL;            // Only used on the GL thread, oldest first
+static nnAsyncImage *_nnUploadTail = NULL;
+
+static int _nnAsyncImagesQueued = 0;
+static int _nnAsyncImagesCompleted = 0;
+static int _nnImageUploadBytesPerFrame = 16 * 1024 * 1024;
+static int _nnImageUploadMilliseconds = 4;
+
+static void _nnImageWorkerLoop()
+{
+    for (;;)
     {
-        printf("Failed to allocate memory for font atlas.\n");
-        free(font->fontBuffer);
-        free(font);
-        return NULL;
+        nnAsyncImage *job = NULL;
+#ifdef _WIN32
+        WaitForSingleObject(_nnImageJobSignal, INFINITE);
+        EnterCriticalSection(&_nnImageJobMutex);
+#else
+        pthread_mutex_lock(&_nnImageJobMutex);
+        while (!_nnImageJobHead && !_nnImageWorkersQuit)
+            pthread_cond_wait(&_nnImageJobSignal, &_nnImageJobMutex);
+#endif
+        if (!_nnImageWorkersQuit && _nnImageJobHead)
+        {
+            job = _nnImageJobHead;
+            _nnImageJobHead = job->next;
+            if (!_nnImageJobHead)
+                _nnImageJobTail = NULL;
+        }
+#ifdef _WIN32
+        LeaveCriticalSection(&_nnImageJobMutex);
+#else
+        pthread_mutex_unlock(&_nnImageJobMutex);
+#endif
+        if (!job)
+            return;
+
+        // .nntex files stay mapped until the GL thread uploads them, everything else is decoded here
+        if (_nnMapFile(job->filepath, &job->view))
+        {
+            job->isTex = _nnParseTex(job->view.data, job->view.size, &job->tex);
+            if (!job->isTex)
+            {
+                if (job->view.size <= 0x7fffffff)
+                    job->pixels = stbi_load_from_memory(job->view.data, (int)job->view.size, &job->width, &job->height, 0, 4);
+                _nnUnmapFile(&job->view);
+            }
+        }
+
+        // Push onto the decoded stack
+        nnAsyncImage *head;
+        do
+        {
+            head = _nnDecodedImages;
+            job->next = head;
+        } while (!__sync_bool_compare_and_swap(&_nnDecodedImages, head, job));
     }
+}
 
-    // Bake the font
-    stbtt_BakeFontBitmap(font->fontBuffer, 0, fontSize, bitmap, font->atlasWidth, font->atlasHeight, 32, 96, font->charData);
+#ifdef _WIN32
+static DWORD WINAPI _nnImageWorker(LPVOID arg)
+{
+    (void)arg;
+    _nnImageWorkerLoop();
+    return 0;
+}
+#else
+static void *_nnImageWorker(void *arg)
+{
+    (void)arg;
+    _nnImageWorkerLoop();
+    return NULL;
+}
+#endif
 
-    // Upload the atlas to OpenGL
-    glGenTextures(1, &font->textureID);
-    glBindTexture(GL_TEXTURE_2D, font->textureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, font->atlasWidth, font->atlasHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, bitmap);
+// Makes the first `count` image loader threads quit, waits for them and releases what they share
+static void _nnJoinImageWorkers(int count)
+{
+#ifdef _WIN32
+    EnterCriticalSection(&_nnImageJobMutex);
+    _nnImageWorkersQuit = true;
+    LeaveCriticalSection(&_nnImageJobMutex);
+    if (count > 0)
+    {
+        ReleaseSemaphore(_nnImageJobSignal, count, NULL);
+        WaitForMultipleObjects(count, _nnImageWorkers, TRUE, INFINITE);
+    }
+    for (int i = 0; i < count; i++)
+        CloseHandle(_nnImageWorkers[i]);
+    CloseHandle(_nnImageJobSignal);
+    DeleteCriticalSection(&_nnImageJobMutex);
+#else
+    pthread_mutex_lock(&_nnImageJobMutex);
+    _nnImageWorkersQuit = true;
+    pthread_cond_broadcast(&_nnImageJobSignal);
+    pthread_mutex_unlock(&_nnImageJobMutex);
+    for (int i = 0; i < count; i++)
+        pthread_join(_nnImageWorkers[i], NULL);
+#endif
+}
 
-    if (!_nnstate.filtered)
+static bool _nnStartImageWorkers()
+{
+    if (_nnImageWorkersRunning)
+        return true;
+
+    _nnImageWorkersQuit = false;
+#ifdef _WIN32
+    InitializeCriticalSection(&_nnImageJobMutex);
+    _nnImageJobSignal = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+    for (int i = 0; i < _NN_IMAGE_LOADER_THREADS; i++)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        _nnImageWorkers[i] = CreateThread(NULL, 0, _nnImageWorker, NULL, 0, NULL);
+        if (!_nnImageWorkers[i])
+        {
+            printf("Failed to create image loader thread.\n");
+            _nnJoinImageWorkers(i);
+            return false;
+        }
     }
-    else
+#else
+    for (int i = 0; i < _NN_IMAGE_LOADER_THREADS; i++)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        if (pthread_create(&_nnImageWorkers[i], NULL, _nnImageWorker, NULL) != 0)
+        {
+            printf("Failed to create image loader thread.\n");
+            _nnJoinImageWorkers(i);
+            return false;
+        }
     }
+#endif
+    _nnImageWorkersRunning = true;
+    return true;
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+static void _nnStopImageWorkers()
+{
+    if (!_nnImageWorkersRunning)
+        return;
 
-    free(bitmap);
+    _nnJoinImageWorkers(_NN_IMAGE_LOADER_THREADS);
+    _nnImageWorkersRunning = false;
+}
 
-    return font;
+static void _nnQueueImageJob(nnAsyncImage *job)
+{
+    job->next = NULL;
+#ifdef _WIN32
+    EnterCriticalSection(&_nnImageJobMutex);
+#else
+    pthread_mutex_lock(&_nnImageJobMutex);
+#endif
+    if (_nnImageJobTail)
+        _nnImageJobTail->next = job;
+    else
+        _nnImageJobHead = job;
+    _nnImageJobTail = job;
+#ifdef _WIN32
+    LeaveCriticalSection(&_nnImageJobMutex);
+    ReleaseSemaphore(_nnImageJobSignal, 1, NULL);
+#else
+    pthread_cond_signal(&_nnImageJobSignal);
+    pthread_mutex_unlock(&_nnImageJobMutex);
+#endif
 }
 
-static void _nnDrawTextVA(const char *format, int x, int y, float zIndex, va_list args)
+// Uploads decoded images to the GPU until the per frame budget is used up. At least one image is uploaded every frame.
+static void _nnUploadDecodedImages()
 {
-    if (!format)
-        return;
+    // Take the whole decoded stack and append it oldest first to the upload list
+    nnAsyncImage *decoded = __sync_lock_test_and_set(&_nnDecodedImages, NULL);
+    nnAsyncImage *reversed = NULL;
+    while (decoded)
+    {
+        nnAsyncImage *next = decoded->next;
+        decoded->next = reversed;
+        reversed = decoded;
+        decoded = next;
+    }
+    if (reversed)
+    {
+        if (_nnUploadTail)
+            _nnUploadTail->next = reversed;
+        else
+            _nnUploadHead = reversed;
+        while (reversed->next)
+            reversed = reversed->next;
+        _nnUploadTail = reversed;
+    }
 
-    char buffer[1024];
-    vsnprintf(buffer, sizeof(buffer), format, args);
+    int startTime = glutGet(GLUT_ELAPSED_TIME);
+    int uploadedBytes = 0;
+    int uploadedImages = 0;
+    while (_nnUploadHead)
+    {
+        if (uploadedImages > 0 && (uploadedBytes >= _nnImageUploadBytesPerFrame || glutGet(GLUT_ELAPSED_TIME) - startTime >= _nnImageUploadMilliseconds))
+            break;
 
-    nnFont *font = _nnstate.font;
-    if (!font)
-        return;
+        nnAsyncImage *image = _nnUploadHead;
+        _nnUploadHead = image->next;
+        if (!_nnUploadHead)
+            _nnUploadTail = NULL;
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, font->textureID);
+        if (image->isTex && !image->freed)
+        {
+            image->image.textureID = _nnCreateTexTexture(&image->tex);
+            image->image.width = image->tex.width;
+            image->image.height = image->tex.height;
+            image->status = _NN_ASYNC_IMAGE_READY;
+            uploadedBytes += image->tex.width * image->tex.height * 4;
+            uploadedImages++;
+        }
+        else if (image->pixels && !image->freed)
+        {
+            image->image.textureID = _nnCreateImageTexture(image->pixels, image->width, image->height);
+            image->image.width = image->width;
+            image->image.height = image->height;
+            image->status = _NN_ASYNC_IMAGE_READY;
+            uploadedBytes += image->width * image->height * 4;
+            uploadedImages++;
+        }
+        else if (!image->freed)
+        {
+            printf("Failed to load image:\n%s\n", image->filepath);
+            image->status = _NN_ASYNC_IMAGE_FAILED;
+        }
+        stbi_image_free(image->pixels);
+        image->pixels = NULL;
+        _nnUnmapFile(&image->view);
+        _nnAsyncImagesCompleted++;
 
-    glBegin(GL_QUADS);
+        if (image->freed)
+        {
+            free(image->filepath);
+            free(image);
+        }
+    }
+}
 
-    float cursorX = (float)x;
-    float cursorY = (float)(y + font->glyphHeight); // Adjust for font height
+/*
+ * Image cache: an open addressing hash table keyed by the FNV-1a hash of the path (or of the memory for images loaded from memory).
+ */
 
-    for (char *c = buffer; *c != '\0'; c++)
+typedef struct
+{
+    bool used;
+    unsigned int hash;      // Hash of the path or the memory
+    char *path;             // NULL for images loaded from memory
+    unsigned char *data;    // Copy of the memory, compared on a hash match. NULL for paths
+    size_t size;            // Size of the memory
+    nnImage image;
+    int refCount;
+    size_t bytes;           // Texture memory of the image plus the copy of the memory, counted against the budget
+    unsigned int lastUsed;  // Tick of the last load or release
+} _nnImageCacheEntry;
+
+static _nnImageCacheEntry *_nnImageCache = NULL;
+static int _nnImageCacheCapacity = 0; // Power of two
+static int _nnImageCacheCount = 0;
+static size_t _nnImageCacheBytes = 0;
+static size_t _nnImageCacheBudget = 256 * 1024 * 1024;
+static unsigned int _nnImageCacheTick = 0;
+static unsigned int _nnImageCacheHits = 0;
+static unsigned int _nnImageCacheMisses = 0;
+
+// Returns the slot of the matching entry or the empty slot where it belongs.
+static int _nnFindImageCacheSlot(unsigned int hash, const char *path, const unsigned char *data, size_t size)
+{
+    int mask = _nnImageCacheCapacity - 1;
+    int slot = hash & mask;
+    while (_nnImageCache[slot].used)
     {
-        if (*c < 32 || *c >= 128)
-            continue;
+        _nnImageCacheEntry *entry = &_nnImageCache[slot];
+        if (entry->hash == hash && (path ? (entry->path && strcmp(entry->path, path) == 0)
+                                         : (entry->data && entry->size == size && memcmp(entry->data, data, size) == 0)))
+            return slot;
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
 
-        stbtt_aligned_quad quad;
-        stbtt_GetBakedQuad(font->charData, font->atlasWidth, font->atlasHeight, *c - 32, &cursorX, &cursorY, &quad, 1);
+static bool _nnGrowImageCache()
+{
+    int capacity = _nnImageCacheCapacity ? _nnImageCacheCapacity * 2 : 64;
+    _nnImageCacheEntry *entries = calloc(capacity, sizeof(_nnImageCacheEntry));
+    if (!entries)
+    {
+        printf("Failed to allocate memory for image cache.\n");
+        return false;
+    }
 
-        glTexCoord2f(quad.s0, quad.t1);
-        glVertex3f(quad.x0, quad.y1, zIndex);
-        glTexCoord2f(quad.s1, quad.t1);
-        glVertex3f(quad.x1, quad.y1, zIndex);
-        glTexCoord2f(quad.s1, quad.t0);
-        glVertex3f(quad.x1, quad.y0, zIndex);
-        glTexCoord2f(quad.s0, quad.t0);
-        glVertex3f(quad.x0, quad.y0, zIndex);
+    _nnImageCacheEntry *oldEntries = _nnImageCache;
+    int oldCapacity = _nnImageCacheCapacity;
+    _nnImageCache = entries;
+    _nnImageCacheCapacity = capacity;
+    for (int i = 0; i < oldCapacity; i++)
+    {
+        if (oldEntries[i].used)
+            _nnImageCache[_nnFindImageCacheSlot(oldEntries[i].hash, oldEntries[i].path, oldEntries[i].data, oldEntries[i].size)] = oldEntries[i];
     }
+    free(oldEntries);
+    return true;
+}
 
-    glEnd();
+// Deletes the texture of the entry in the given slot and closes the gap in the probe sequence.
+static void _nnRemoveImageCacheEntry(int slot)
+{
+    _nnImageCacheEntry *entry = &_nnImageCache[slot];
+    glDeleteTextures(1, &entry->image.textureID);
+    _nnImageCacheBytes -= entry->bytes;
+    _nnImageCacheCount--;
+    free(entry->path);
+    free(entry->data);
+    memset(entry, 0, sizeof(*entry));
+
+    // Move following entries back if their home slot is at or before the gap
+    int mask = _nnImageCacheCapacity - 1;
+    int gap = slot;
+    for (int next = (gap + 1) & mask; _nnImageCache[next].used; next = (next + 1) & mask)
+    {
+        int home = _nnImageCache[next].hash & mask;
+        bool movable = (gap <= next) ? (home <= gap || home > next) : (home <= gap && home > next);
+        if (movable)
+        {
+            _nnImageCache[gap] = _nnImageCache[next];
+            memset(&_nnImageCache[next], 0, sizeof(_nnImageCacheEntry));
+            gap = next;
+        }
+    }
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
+// Evicts the least recently used unreferenced images until the cache fits into its budget.
+static void _nnEvictImageCache()
+{
+    while (_nnImageCacheBytes > _nnImageCacheBudget)
+    {
+        int oldest = -1;
+        for (int i = 0; i < _nnImageCacheCapacity; i++)
+        {
+            _nnImageCacheEntry *entry = &_nnImageCache[i];
+            if (entry->used && entry->refCount == 0 && (oldest < 0 || entry->lastUsed < _nnImageCache[oldest].lastUsed))
+                oldest = i;
+        }
+        if (oldest < 0)
+            return;
+        _nnRemoveImageCacheEntry(oldest);
+    }
 }
 
-// static const char *_nnFetchTextInput()
-// {
-//     static char typedText[1024];
-//     int index = 0;
+// Looks up an image in the cache or loads and caches it. Exactly one of `path` and `data` is set.
+static nnImage _nnLoadImageCached(const char *path, const unsigned char *data, int size)
+{
+    unsigned int hash = path ? _nnHashBytes(2166136261u, path, strlen(path)) : _nnHashBytes(2166136261u, data, size);
 
-//     // Clear the buffer before starting
-//     typedText[0] = '\0';
+    if (_nnImageCacheCount * 2 >= _nnImageCacheCapacity && !_nnGrowImageCache())
+        return path ? nnLoadImage(path) : nnLoadImageMem(data, size);
 
-//     // Iterate over printable ASCII characters (32-126)
-//     for (int key = 32; key <= 126; key++)
-//     {
-//         bool pressed = _nnstate.keysPressed[key];
-//         if (pressed) // Check if the key is pressed
-//         {
-//             typedText[index++] = (char)key; // Add the character to the buffer
-//         }
-//     }
+    int slot = _nnFindImageCacheSlot(hash, path, data, path ? 0 : (size_t)size);
+    _nnImageCacheEntry *entry = &_nnImageCache[slot];
+    if (entry->used)
+    {
+        entry->refCount++;
+        entry->lastUsed = ++_nnImageCacheTick;
+        _nnImageCacheHits++;
+        return entry->image;
+    }
 
-//     // Handle backspace
-//     // if (nnKeyHit(8)) // Backspace key code
-//     // {
-//     //     typedText[index++] = '\b'; // Add backspace marker
-//     // }
+    _nnImageCacheMisses++;
+    nnImage image = path ? nnLoadImage(path) : nnLoadImageMem(data, size);
+    if (image.textureID == 0)
+        return image;
 
-//     // Handle enter (if needed for a text input)
-//     // if (nnKeyHit(13)) // Enter key code
-//     // {
-//     //     typedText[index++] = '\n'; // Add newline marker
-//     // }
-
-//     // Null-terminate the string
-//     typedText[index] = '\0';
-
-//     return typedText;
-// }
-
-static const char *_nnFetchTextInput()
-{
-    static char typedText[1024];
-    int index = 0;
-
-    // Clear the buffer before starting
-    typedText[0] = '\0';
-
-    // Iterate over printable ASCII characters (32-126)
-    for (int key = 32; key <= 126; key++)
+    if (path)
     {
-        if (_nnstate.keysPressed[key]) // Check only normal keys
+        entry->path = malloc(strlen(path) + 1);
+        if (!entry->path)
         {
-            typedText[index++] = (char)key; // Add the character to the buffer
+            printf("Failed to allocate memory for image cache.\n");
+            return image;
         }
+        strcpy(entry->path, path);
     }
-
-    // Null-terminate the string
-    typedText[index] = '\0';
-
-    return typedText;
+    else
+    {
+        entry->data = malloc(size);
+        if (!entry->data)
+        {
+            printf("Failed to allocate memory for image cache.\n");
+            return image;
+        }
+        memcpy(entry->data, data, size);
+    }
+    entry->used = true;
+    entry->hash = hash;
+    entry->size = path ? 0 : (size_t)size;
+    entry->image = image;
+    entry->refCount = 1;
+    entry->bytes = (size_t)image.width * image.height * 4 + entry->size;
+    entry->lastUsed = ++_nnImageCacheTick;
+    _nnImageCacheCount++;
+    _nnImageCacheBytes += entry->bytes;
+
+    _nnEvictImageCache();
+    return image;
 }
 
-/*******************************************************************************************************/
-/*******************************************************************************************************/
-
-// Public Interface implementations
-
-/*******************************************************************************************************/
-/*******************************************************************************************************/
+static void _nnSetupOrthoProjection(int width, int height)
+{
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0.0, width, height, 0.0, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+}
 
-/*
- * Window Management
- */
-bool nnCreateWindow(char *title, int width, int height, bool virtual, bool filtered)
+static void _nnSetScale(float scaleX, float scaleY)
 {
-    _nnstate.displayCallback = NULL;
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glScalef(scaleX, scaleY, 1.0f);
+}
 
-    _nnstate.virtual = virtual;
-    _nnstate.filtered = filtered;
+static void _nnUpdateScale(int width, int height, int shouldUpdate)
+{
+    if (shouldUpdate != 0)
+    {
+        _nnstate.windowScaleX = (float)width / _nnstate.initialWidth;
+        _nnstate.windowScaleY = (float)height / _nnstate.initialHeight;
+        _nnSetScale(_nnstate.windowScaleX, _nnstate.windowScaleY);
+    }
+}
 
-    _nnstate.title = title;
-    _nnstate.initialWidth = width;
-    _nnstate.initialHeight = height;
+static void _nnFramebufferSizeCallback(int width, int height)
+{
     _nnstate.windowWidth = width;
     _nnstate.windowHeight = height;
-    _nnstate.windowScaleX = 1.0f;
-    _nnstate.windowScaleY = 1.0f;
+    glViewport(0, 0, width, height);
+    _nnSetupOrthoProjection(width, height);
+    _nnUpdateScale(width, height, _nnstate.virtual);
+}
 
-    _nnstate.deltaTime = 0.0f;
-    _nnstate.lastTime = glutGet(GLUT_ELAPSED_TIME) / 1000.0;
-    _nnstate.currentFPS = 0;
+static void _nnTimerCallback(int value)
+{
+    // Parameters for FPS averaging
+#define _NN_FPS_BUFFER_SIZE 20                          // Number of frames to average over
+    static double fpsBuffer[_NN_FPS_BUFFER_SIZE] = {0}; // Circular buffer for FPS values
+    static int fpsIndex = 0;                            // Current index in the buffer
+    static double fpsSum = 0;                           // Sum of all FPS values in the buffer
+    static int fpsCount = 0;                            // Number of frames added to the buffer
 
-    _nnstate.isAnyPopupOpen = false;
+    // Calculate deltaTime and instantaneous FPS
+    double elapsedTime = glutGet(GLUT_ELAPSED_TIME);
+    double currentTime = elapsedTime / 1000.0; // Get time in seconds
+    _nnstate.deltaTime = currentTime - _nnstate.lastTime;
+    double instantaneousFPS = (_nnstate.deltaTime > 0) ? (1.0 / _nnstate.deltaTime) : 0;
+    _nnstate.lastTime = currentTime;
 
-    // Set default FPS if not already set
-    if (_nnstate.targetFPS <= 0)
+    // Update the FPS buffer
+    fpsSum -= fpsBuffer[fpsIndex];          // Remove the old value from the sum
+    fpsBuffer[fpsIndex] = instantaneousFPS; // Add the new value to the buffer
+    fpsSum += instantaneousFPS;             // Add the new value to the sum
+
+    fpsIndex = (fpsIndex + 1) % _NN_FPS_BUFFER_SIZE; // Move to the next index
+    if (fpsCount < _NN_FPS_BUFFER_SIZE)
     {
-        _nnstate.targetFPS = 60;
+        fpsCount++; // Increase the count until the buffer is full
     }
 
-    nnFPS = 0;
-    nnDT = 0.0f;
-    nnMS = 0.0f;
-
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-
-    int argc = 1;
-    char *argv[1] = {(char *)"Something"};
-    glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE);
-    glutInitWindowSize(width, height);
-    _nnstate.window = glutCreateWindow(title);
-
-    // Load a default font
-    _nnstate.font = _nnLoadFont(_nnRoboto_Regular_ttf_arr, _nnRoboto_Regular_ttf_arr_len, 24);
-
-    /* Set the callbacks */
-    glutKeyboardFunc(_nnKeyDownCallback);
-    glutKeyboardUpFunc(_nnKeyUpCallback);
-    glutSpecialFunc(_nnSpecialKeyCallback);
-    glutSpecialUpFunc(_nnSpecialKeyUpCallback);
-    glutMouseFunc(_nnMouseButtonCallback);
-    glutMouseWheelFunc(_nnMouseWheelFunc);
-    glutMotionFunc(_nnMouseMotionFunc);
-    glutPassiveMotionFunc(_nnMouseMotionFunc);
-    glutReshapeFunc(_nnFramebufferSizeCallback);
+    // Calculate the average FPS
+    _nnstate.currentFPS = fpsSum / fpsCount;
 
-    /* Set up the orthographic projection */
-    _nnSetupOrthoProjection(_nnstate.windowWidth, _nnstate.windowHeight);
-    _nnUpdateScale(_nnstate.windowWidth, _nnstate.windowHeight, _nnstate.virtual);
+    // Update global variables
+    nnFPS = _nnstate.currentFPS;
+    nnDT = _nnstate.deltaTime;
+    nnMS = (unsigned int)elapsedTime;
 
-    /* Set initial scale */
-    _nnSetScale(_nnstate.windowScaleX, _nnstate.windowScaleY);
+    // Trigger display refresh
+    glutPostRedisplay();
 
-    /* Start the timer for limiting FPS */
+    // Re-register the timer callback to get targetFPS
     glutTimerFunc(1000 / _nnstate.targetFPS, _nnTimerCallback, 0);
-
-    nnResetColor();
-
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LEQUAL);
-
-    return true;
 }
 
-void nnSetRenderFunc(void (*callback)(void))
+static void _nnKeyDownCallback(unsigned char key, int x, int y)
 {
-    _nnstate.displayCallback = callback;
-    glutDisplayFunc(_nnDisplayCallbackWrapper);
+    _nnstate.anyKeyEvent = true;
+    if (!_nnstate.keys[key]) // Normal keys (0-255)
+    {
+        _nnstate.keysPressed[key] = true;
+    }
+    _nnstate.keys[key] = true;
 }
 
-void nnDestroyWindow()
+static void _nnKeyUpCallback(unsigned char key, int x, int y)
 {
-    glDisable(GL_DEPTH_TEST);
-    glutDestroyWindow(_nnstate.window);
+    _nnstate.anyKeyEvent = true;
+    _nnstate.keys[key] = false;
+    _nnstate.keysReleased[key] = true;
 }
 
-void nnSetTargetFPS(int fps)
+static void _nnSpecialKeyCallback(int key, int x, int y)
 {
-    if (fps <= 0)
+    _nnstate.anyKeyEvent = true;
+    if (!_nnstate.skeys[key]) // Special keys (e.g., GLUT keys)
     {
-        printf("Invalid FPS value. FPS must be greater than 0.\n");
-        return;
+        _nnstate.skeysPressed[key] = true;
     }
-    _nnstate.targetFPS = fps;
+    _nnstate.skeys[key] = true;
 }
 
-void nnSetWindowTitle(const char *format, ...)
+static void _nnSpecialKeyUpCallback(int key, int x, int y)
 {
-    char buffer[256] = {0};
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
-
-    glutSetWindowTitle(buffer);
+    _nnstate.anyKeyEvent = true;
+    _nnstate.skeys[key] = false;
+    _nnstate.skeysReleased[key] = true;
 }
 
-void nnSetClearColor(nnColorf color)
+static void _nnMouseButtonCallback(int button, int state, int x, int y)
 {
-    glClearColor(color.r, color.g, color.b, color.a);
+    if (button < _NN_MAX_MOUSE_BUTTONS)
+    {
+        if (state == GLUT_DOWN)
+        {
+            if (!_nnstate.mouseButtons[button])
+            {
+                _nnstate.mouseButtonsPressed[button] = true;
+            }
+            _nnstate.mouseButtons[button] = true;
+        }
+        else if (state == GLUT_UP)
+        {
+            _nnstate.mouseButtons[button] = false;
+            _nnstate.mouseButtonsReleased[button] = true;
+        }
+    }
 }
 
-void nnSetColor(nnColorf color)
+static void _nnMouseWheelFunc(int wheel, int direction, int x, int y)
 {
-    _nnstate.currentDrawColor = color;
-    glColor4f(color.r, color.g, color.b, color.a);
+    _nnstate.mouseWheelDelta = direction; // +1 for up, -1 for down
 }
 
-nnColorf nnGetColor()
+static void _nnMouseMotionFunc(int x, int y)
 {
-    return _nnstate.currentDrawColor;
+    // Motion delta
+    nnPos newMousePosition = {(float)x / _nnstate.windowScaleX, (float)y / _nnstate.windowScaleY};
+    _nnstate.mouseMotionDelta.x = newMousePosition.x - _nnstate.mousePosition.x;
+    _nnstate.mouseMotionDelta.y = newMousePosition.y - _nnstate.mousePosition.y;
+    _nnstate.mousePosition = newMousePosition;
 }
 
-void nnResetColor()
-{
-    _nnstate.currentDrawColor = (nnColorf){1.0f, 1.0f, 1.0f, 1.0f};
-    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-}
+#define _NN_FONT_ATLAS_MIN_PAGE_SIZE 256  // Pages start at the smallest power of two that fits, but at least this size
+#define _NN_FONT_ATLAS_MAX_PAGE_SIZE 1024 // Pages are grown up to this size before a new page is created
+#define _NN_MAX_FONT_ATLAS_PAGES 16
+#define _NN_MAX_FONT_ATLAS_SHELVES 64
+#define _NN_MAX_GLYPH_ATLAS_PAGES 4 // Pages for glyphs rasterized on demand, once they are full the least recently used shelf is evicted
+#define _NN_SDF_FONT_SIZE 48         // Pixel size signed distance field glyphs are generated at
+#define _NN_SDF_PADDING 6            // Distance in pixels the field extends beyond the glyph outline
 
-void nnRun()
+// A row of the shelf packer. Rectangles are placed left to right on the shelf that wastes the least height.
+typedef struct
 {
-    if (_nnstate.displayCallback == NULL)
-    {
-        printf("DisplayCallback not set, shutting down...");
-        exit(-1);
-    }
-    glutMainLoop();
-}
+    int y;                   // Top of the shelf
+    int height;              // Height of the shelf
+    int x;                   // Left edge of the free space on the shelf
+    unsigned int lastUsed;   // Frame a glyph on the shelf was last drawn in
+    unsigned int generation; // Changes whenever the shelf is emptied, glyphs placed before that are gone
+    bool pinned;             // Holds baked blocks, atlas images or the white pixel, so it is never evicted
+} _nnAtlasShelf;
+
+// An alpha texture that glyphs of all fonts are packed into, or an RGBA texture in UI atlas mode
+typedef struct
+{
+    unsigned int textureID;
+    int width;
+    int height;
+    _nnAtlasShelf shelves[_NN_MAX_FONT_ATLAS_SHELVES];
+    int shelfCount;
+    int nextY;               // Top of the space below the last shelf
+    int allocations;         // Number of live rectangles, the page is cleared once it drops to 0
+    bool glyphs;             // Holds glyphs rasterized on demand instead of baked blocks
+    bool sdf;                // Holds signed distance field glyphs, which are always filtered linearly
+    bool rgba;               // UI atlas page shared by glyphs, blocks, atlas images and the white pixel
+    unsigned int generation; // Last generation handed to a shelf of this page
+} _nnAtlasPage;
+
+// Kerning of a pair outside ASCII, cached in the face's pair table the first time it is looked up
+struct _nnKernPair
+{
+    int first;     // 0 marks an empty slot
+    int second;
+    short kerning; // Kerning in font units
+};
 
-int nnWindowWidth()
+// A glyph outside ASCII, rasterized into a glyph page the first time it is drawn
+struct _nnGlyph
 {
-    return _nnstate.windowWidth;
-}
+    int codepoint;           // 0 marks an empty slot
+    int page;                // Atlas page, -1 for glyphs without pixels (e.g. spaces)
+    int shelf;               // Shelf of the page the glyph is on
+    unsigned int generation; // Generation of the shelf when the glyph was placed
+    stbtt_packedchar quad;   // Position in the page and metrics
+};
 
-int nnWindowHeight()
+static _nnAtlasPage _nnAtlasPages[_NN_MAX_FONT_ATLAS_PAGES];
+static int _nnAtlasPageCount = 0;
+static int _nnFontOversampling = 1;
+static bool _nnFontKerning = false;
+static bool _nnUIAtlas = false;    // Glyphs, solid fills and atlas images share RGBA pages, see nnSetUIAtlas
+static int _nnWhitePixelPage = -1; // UI atlas page holding the white pixel solid fills are drawn with
+static int _nnWhitePixelX = 0;     // Center of the white pixel block on its page
+static int _nnWhitePixelY = 0;
+static unsigned int _nnAtlasGeneration = 0; // Changes whenever glyphs are moved or removed, text objects laid out before that are laid out again
+
+struct _nnFontFace
 {
-    return _nnstate.windowHeight;
-}
+    stbtt_fontinfo fontInfo;
+    unsigned char *fontBuffer;     // Font data, used in place
+    size_t fontBufferSize;         // Size of the font data, faces loaded from memory are looked up by buffer and size
+    nnFileView fontFile;           // Mapped font file released with the face (empty if the font data is borrowed)
+    char *path;                    // File the face was loaded from (NULL if it was loaded from memory)
+    int refCount;                  // Number of references taken on sizes of this face, see nnFont.refCount
+    nnFont *sizes;                 // Cached sizes
+    nnFont *sdfGlyphs;             // Size at _NN_SDF_FONT_SIZE holding the signed distance field glyphs of all SDF sizes
+    short *kerning;                // Kerning of all ASCII pairs in font units, NULL if the face is not kerned
+    struct _nnKernPair *kernPairs; // Hash table of the kerning of other pairs, filled as they are used
+    int kernPairCapacity;          // Number of slots in the pair table (a power of two)
+    int kernPairCount;             // Number of used slots in the pair table
+    nnFontFace *next;
+};
 
-int nnScreenWidth()
+static nnFontFace *_nnFontFaces = NULL;
+
+// A vertex of a text object, relative to the position it is drawn at
+typedef struct
 {
-    if (_nnstate.virtual)
-    {
-        return _nnstate.initialWidth;
-    }
-    return _nnstate.windowWidth;
-}
+    float x, y;
+    float s, t;
+} _nnTextVertex;
 
-int nnScreenHeight()
+// The quads of a text object on one atlas page
+typedef struct
 {
-    if (_nnstate.virtual)
-    {
-        return _nnstate.initialHeight;
-    }
-    return _nnstate.windowHeight;
-}
+    int page;
+    int first; // First vertex
+    int count; // Number of vertices
+} _nnTextRun;
 
-/*
- * Image Loading and Drawing
- */
+// A glyph shelf a text object uses, marked as used whenever the text is drawn so it is not evicted
+typedef struct
+{
+    int page;
+    int shelf;
+} _nnTextShelf;
 
-nnImage nnLoadImage(const char *filepath)
+struct _nnText
 {
-    nnImage image;
-    image.isFlippedX = false;
-    image.isFlippedY = false;
-    image.scaleX = 1.0f;
-    image.scaleY = 1.0f;
-    image.angle = 0.0f;
+    nnFont *font;
+    char *text;                   // Copy of the text, laid out again when the atlas changes
+    size_t length;
+    float width;                  // Advance of the whole text
+    _nnTextVertex *vertices;      // Quads grouped by page, freed once they are in the vertex buffer
+    int vertexCount;
+    _nnTextRun runs[_NN_MAX_FONT_ATLAS_PAGES];
+    int runCount;
+    _nnTextShelf *shelves;
+    int shelfCount;
+    unsigned int buffer;          // Vertex buffer holding the quads, 0 without vertex buffer support
+    unsigned int atlasGeneration; // _nnAtlasGeneration the quads were laid out at
+};
 
-    // stbi_set_flip_vertically_on_load(1);
-    unsigned char *imageData = stbi_load(filepath, &image.width, &image.height, 0, 4);
-    if (!imageData)
-    {
-        printf("Failed to load image:\n%s\n", filepath);
-        image.textureID = 0;
-        return image;
-    }
+#define _NN_MAX_BATCH_QUADS 2048
 
-    glGenTextures(1, &image.textureID);
-    glBindTexture(GL_TEXTURE_2D, image.textureID);
+// A vertex of the quad batch
+typedef struct
+{
+    float x, y, z;
+    float s, t;
+    unsigned char color[4];
+} _nnBatchVertex;
+
+// Quads of text, gui elements, atlas images and screen primitives are queued and drawn with one glDrawArrays call per texture.
+// Batched drawing calls draw the batch when they end. Screen primitives leave it open, so thousands of them take a few draw calls;
+// everything that draws with OpenGL directly draws the batch first, and so does the end of the frame.
+static _nnBatchVertex _nnBatchVertices[_NN_MAX_BATCH_QUADS * 4];
+static int _nnBatchVertexCount = 0;
+static unsigned int _nnBatchTexture = 0; // Texture of the queued quads, 0 if they are untextured
+static bool _nnBatchSDF = false;         // The queued quads are signed distance field glyphs
+static int _nnBatchDepth = 0;            // Number of batched drawing calls in progress, the batch is drawn when the outermost ends
+
+// Draws the queued quads
+static void _nnFlushBatch()
+{
+    if (_nnBatchVertexCount == 0)
+        return;
 
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width, image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, imageData);
+    // The color array leaves the current color undefined, it is restored afterwards
+    float color[4];
+    glGetFloatv(GL_CURRENT_COLOR, color);
 
-    if (!_nnstate.filtered)
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+    if (_nnBatchTexture)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, _nnBatchTexture);
     }
-    else
+    if (_nnBatchSDF)
+        _nnBeginSDFText();
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(_nnBatchVertex), &_nnBatchVertices[0].x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(_nnBatchVertex), &_nnBatchVertices[0].s);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(_nnBatchVertex), _nnBatchVertices[0].color);
+    glDrawArrays(GL_QUADS, 0, _nnBatchVertexCount);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    if (_nnBatchSDF)
+        _nnEndSDFText();
+    if (_nnBatchTexture)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glDisable(GL_TEXTURE_2D);
     }
+    glDisable(GL_BLEND);
+    glColor4fv(color);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    _nnBatchVertexCount = 0;
+}
 
-    stbi_image_free(imageData);
+// Reserves the four vertices of a quad, drawing the batch first if it is full or uses another texture
+static _nnBatchVertex *_nnBatchAlloc(unsigned int texture, bool sdf)
+{
+    if (_nnBatchVertexCount > 0 && (texture != _nnBatchTexture || sdf != _nnBatchSDF || _nnBatchVertexCount + 4 > _NN_MAX_BATCH_QUADS * 4))
+        _nnFlushBatch();
+    _nnBatchTexture = texture;
+    _nnBatchSDF = sdf;
+
+    _nnBatchVertex *vertex = &_nnBatchVertices[_nnBatchVertexCount];
+    _nnBatchVertexCount += 4;
+    return vertex;
+}
 
-    return image;
+// Queues a quad, drawing the batch first if it is full or uses another texture
+static void _nnBatchQuad(unsigned int texture, bool sdf, float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1, float z, const float color[4])
+{
+    unsigned char r = (unsigned char)(color[0] * 255.0f + 0.5f);
+    unsigned char g = (unsigned char)(color[1] * 255.0f + 0.5f);
+    unsigned char b = (unsigned char)(color[2] * 255.0f + 0.5f);
+    unsigned char a = (unsigned char)(color[3] * 255.0f + 0.5f);
+    _nnBatchVertex *vertex = _nnBatchAlloc(texture, sdf);
+    vertex[0] = (_nnBatchVertex){x0, y1, z, s0, t1, {r, g, b, a}};
+    vertex[1] = (_nnBatchVertex){x1, y1, z, s1, t1, {r, g, b, a}};
+    vertex[2] = (_nnBatchVertex){x1, y0, z, s1, t0, {r, g, b, a}};
+    vertex[3] = (_nnBatchVertex){x0, y0, z, s0, t0, {r, g, b, a}};
 }
 
-nnImage nnLoadImageMem(const unsigned char *data, int size)
+// Starts a drawing call that queues its quads, nested calls (e.g. the text of a button) join its batch
+static void _nnBeginBatchedDraw()
 {
-    nnImage image;
-    image.isFlippedX = false;
-    image.isFlippedX = false;
-    image.scaleX = 1.0f;
-    image.scaleY = 1.0f;
-    image.angle = 0.0f;
+    _nnBatchDepth++;
+}
 
-    unsigned char *imageData = stbi_load_from_memory(data, size, &image.width, &image.height, 0, 4);
-    if (!imageData)
+// Ends a drawing call started with _nnBeginBatchedDraw and draws the batch if it was the outermost one
+static void _nnEndBatchedDraw()
+{
+    if (--_nnBatchDepth == 0)
+        _nnFlushBatch();
+}
+
+// Queues a solid rectangle. In UI atlas mode it samples the white pixel, so it shares the texture (and the batch) of text.
+static void _nnBatchRect(float x, float y, float width, float height, nnColorf color)
+{
+    const float rgba[4] = {color.r, color.g, color.b, color.a};
+    if (_nnWhitePixelPage < 0)
     {
-        printf("Failed to load image from memory\n");
-        image.textureID = 0;
-        return image;
+        _nnBatchQuad(0, false, x, y, x + width, y + height, 0, 0, 0, 0, 0, rgba);
+        return;
     }
 
-    glGenTextures(1, &image.textureID);
-    glBindTexture(GL_TEXTURE_2D, image.textureID);
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width, image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, imageData);
+    _nnAtlasPage *page = &_nnAtlasPages[_nnWhitePixelPage];
+    float s = (_nnWhitePixelX + 0.5f) / page->width;
+    float t = (_nnWhitePixelY + 0.5f) / page->height;
+    _nnBatchQuad(page->textureID, false, x, y, x + width, y + height, s, t, s, t, 0, rgba);
+}
 
-    if (_nnstate.filtered)
+// Queues a solid quad with arbitrary corners, given in order around it. Like _nnBatchRect it samples the white pixel in UI atlas mode.
+static void _nnBatchSolidQuad(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3, const float color[4])
+{
+    unsigned int texture = 0;
+    float s = 0.0f, t = 0.0f;
+    if (_nnWhitePixelPage >= 0)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        _nnAtlasPage *page = &_nnAtlasPages[_nnWhitePixelPage];
+        texture = page->textureID;
+        s = (_nnWhitePixelX + 0.5f) / page->width;
+        t = (_nnWhitePixelY + 0.5f) / page->height;
     }
-    else
+
+    unsigned char r = (unsigned char)(color[0] * 255.0f + 0.5f);
+    unsigned char g = (unsigned char)(color[1] * 255.0f + 0.5f);
+    unsigned char b = (unsigned char)(color[2] * 255.0f + 0.5f);
+    unsigned char a = (unsigned char)(color[3] * 255.0f + 0.5f);
+    _nnBatchVertex *vertex = _nnBatchAlloc(texture, false);
+    vertex[0] = (_nnBatchVertex){x0, y0, 0.0f, s, t, {r, g, b, a}};
+    vertex[1] = (_nnBatchVertex){x1, y1, 0.0f, s, t, {r, g, b, a}};
+    vertex[2] = (_nnBatchVertex){x2, y2, 0.0f, s, t, {r, g, b, a}};
+    vertex[3] = (_nnBatchVertex){x3, y3, 0.0f, s, t, {r, g, b, a}};
+}
+
+// Queues a solid triangle, as a quad whose last corner repeats the third
+static void _nnBatchTriangle(float x0, float y0, float x1, float y1, float x2, float y2, const float color[4])
+{
+    _nnBatchSolidQuad(x0, y0, x1, y1, x2, y2, x2, y2, color);
+}
+
+// Queues a one pixel border along the inside of a rectangle
+static void _nnBatchRectOutline(float x, float y, float width, float height, nnColorf color)
+{
+    _nnBatchRect(x, y, width, 1, color);
+    _nnBatchRect(x, y + height - 1, width, 1, color);
+    _nnBatchRect(x, y + 1, 1, height - 2, color);
+    _nnBatchRect(x + width - 1, y + 1, 1, height - 2, color);
+}
+
+#define _NN_MAX_DEBUG_LINES 128
+#define _NN_DEBUG_TEXT_BUFFER_SIZE 8192
+#define _NN_DEBUG_FONT_TEXTURE_SIZE 128
+#define _NN_DEBUG_FONT_COLUMNS (_NN_DEBUG_FONT_TEXTURE_SIZE / _NN_DEBUG_FONT_WIDTH)
+
+// A line of debug text queued during the frame
+typedef struct
+{
+    int x, y; // Position of the baseline
+    float color[4];
+    int offset; // Offset of the text in _nnDebugTextBuffer
+    int length;
+} _nnDebugLine;
+
+// Debug text is queued by nnDrawDebugText and drawn on top of the frame in one batch after the render function returned
+static _nnDebugLine _nnDebugLines[_NN_MAX_DEBUG_LINES];
+static int _nnDebugLineCount = 0;
+static char _nnDebugTextBuffer[_NN_DEBUG_TEXT_BUFFER_SIZE];
+static int _nnDebugTextLength = 0;
+static unsigned int _nnDebugFontTexture = 0; // Created on first use from _nnDebugFont
+
+// Uploads the embedded debug font as an alpha texture with the glyphs in a grid of _NN_DEBUG_FONT_COLUMNS columns
+static bool _nnLoadDebugFont()
+{
+    unsigned char *pixels = calloc(1, _NN_DEBUG_FONT_TEXTURE_SIZE * _NN_DEBUG_FONT_TEXTURE_SIZE);
+    if (!pixels)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        printf("Failed to allocate memory for the debug font.\n");
+        return false;
     }
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    for (int i = 0; i < _NN_DEBUG_FONT_CHAR_COUNT; i++)
+    {
+        int cellX = i % _NN_DEBUG_FONT_COLUMNS * _NN_DEBUG_FONT_WIDTH;
+        int cellY = i / _NN_DEBUG_FONT_COLUMNS * _NN_DEBUG_FONT_HEIGHT;
+        for (int row = 0; row < _NN_DEBUG_FONT_HEIGHT; row++)
+        {
+            unsigned char *dst = pixels + (cellY + row) * _NN_DEBUG_FONT_TEXTURE_SIZE + cellX;
+            for (int bit = 0; bit < _NN_DEBUG_FONT_WIDTH; bit++)
+            {
+                dst[bit] = (_nnDebugFont[i][row] & (0x80 >> bit)) ? 255 : 0;
+            }
+        }
+    }
 
-    stbi_image_free(imageData);
+    glGenTextures(1, &_nnDebugFontTexture);
+    glBindTexture(GL_TEXTURE_2D, _nnDebugFontTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, _NN_DEBUG_FONT_TEXTURE_SIZE, _NN_DEBUG_FONT_TEXTURE_SIZE, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
 
-    return image;
+    free(pixels);
+    return true;
 }
 
-void nnDrawImage(nnImage image, int x, int y)
+// Draws the debug text queued during the frame on top of everything and empties the queue
+static void _nnDrawDebugText()
 {
-    if (image.textureID == 0)
+    if (_nnDebugLineCount == 0)
+        return;
+
+    if (_nnDebugFontTexture == 0 && !_nnLoadDebugFont())
     {
-        printf("Failed to draw image\n");
+        _nnDebugLineCount = 0;
+        _nnDebugTextLength = 0;
         return;
     }
 
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, image.textureID);
+    bool depthTest = glIsEnabled(GL_DEPTH_TEST);
+    glDisable(GL_DEPTH_TEST);
 
-    // Enable alpha blending
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    const float cellWidth = (float)_NN_DEBUG_FONT_WIDTH / _NN_DEBUG_FONT_TEXTURE_SIZE;
+    const float cellHeight = (float)_NN_DEBUG_FONT_HEIGHT / _NN_DEBUG_FONT_TEXTURE_SIZE;
 
-    glPushMatrix();
+    _nnBeginBatchedDraw();
+    for (int i = 0; i < _nnDebugLineCount; i++)
+    {
+        _nnDebugLine *line = &_nnDebugLines[i];
+        const char *text = _nnDebugTextBuffer + line->offset;
+        float x = (float)line->x;
+        float y = (float)(line->y - _NN_DEBUG_FONT_ASCENT);
+        for (int j = 0; j < line->length; j++)
+        {
+            if (text[j] == '\n')
+            {
+                x = (float)line->x;
+                y += _NN_DEBUG_FONT_HEIGHT;
+                continue;
+            }
 
-    // Translate to position
-    glTranslatef(x + image.width / 2.0f, y + image.height / 2.0f, 0);
+            // Anything outside printable ASCII, including every byte of a multi-byte UTF-8 character, is shown as '?'
+            int glyph = (unsigned char)text[j] - _NN_DEBUG_FONT_FIRST_CHAR;
+            if (glyph < 0 || glyph >= _NN_DEBUG_FONT_CHAR_COUNT)
+                glyph = '?' - _NN_DEBUG_FONT_FIRST_CHAR;
 
-    // Apply rotation if any
-    if (image.angle != 0.0f)
+            if (glyph != 0) // Spaces need no quad
+            {
+                float s = glyph % _NN_DEBUG_FONT_COLUMNS * cellWidth;
+                float t = glyph / _NN_DEBUG_FONT_COLUMNS * cellHeight;
+                _nnBatchQuad(_nnDebugFontTexture, false, x, y, x + _NN_DEBUG_FONT_WIDTH, y + _NN_DEBUG_FONT_HEIGHT, s, t, s + cellWidth, t + cellHeight, 0.0f, line->color);
+            }
+            x += _NN_DEBUG_FONT_WIDTH;
+        }
+    }
+    _nnEndBatchedDraw();
+
+    if (depthTest)
+        glEnable(GL_DEPTH_TEST);
+
+    _nnDebugLineCount = 0;
+    _nnDebugTextLength = 0;
+}
+
+// Wrapper display function that calls the function pointer
+static void _nnDisplayCallbackWrapper()
+{
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    if (_nnImageWorkersRunning)
     {
-        glRotatef(image.angle, 0, 0, 1);
+        _nnUploadDecodedImages();
     }
 
-    // Apply flipping
-    float flipX = image.isFlippedX ? -1.0f : 1.0f;
-    float flipY = image.isFlippedY ? -1.0f : 1.0f;
+    if (_nnstate.displayCallback != NULL)
+    {
+        _nnstate.displayCallback();
+    }
 
-    // Apply scaling
-    glScalef(image.scaleX * flipX, image.scaleY * flipY, 1.0f);
+    _nnFlushBatch();
+    _nnDrawDebugText();
 
-    // Render the quad centered at the origin
-    glBegin(GL_QUADS);
-    glTexCoord2f(0.0f, 0.0f);
-    glVertex2f(-image.width / 2.0f, -image.height / 2.0f);
-    glTexCoord2f(1.0f, 0.0f);
-    glVertex2f(image.width / 2.0f, -image.height / 2.0f);
-    glTexCoord2f(1.0f, 1.0f);
-    glVertex2f(image.width / 2.0f, image.height / 2.0f);
-    glTexCoord2f(0.0f, 1.0f);
-    glVertex2f(-image.width / 2.0f, image.height / 2.0f);
-    glEnd();
+    _nnstate.frameCount++;
+    _nnstate.anyKeyEvent = false;
 
-    glPopMatrix();
+    nnFlushKeys();
+    nnFlushMouse();
+    _nnstate.mouseWheelDelta = 0;
+    _nnstate.mouseMotionDelta.x = 0;
+    _nnstate.mouseMotionDelta.y = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
+    glutSwapBuffers();
+    glutMainLoopEvent();
 }
 
-void nnDrawImagePortion(nnImage image, int x, int y, nnRecf srcRec)
+// Bytes per pixel of an atlas page
+static int _nnAtlasPixelSize(_nnAtlasPage *page)
 {
-    if (image.textureID == 0)
-    {
-        printf("Failed to draw image portion\n");
-        return;
-    }
+    return page->rgba ? 4 : 1;
+}
 
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, image.textureID);
+// Fills an atlas page with transparent pixels
+static void _nnClearAtlasPage(_nnAtlasPage *page)
+{
+    // Queued quads may show glyphs of the page
+    _nnFlushBatch();
+    _nnAtlasGeneration++;
 
-    // Enable alpha blending
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLenum format = page->rgba ? GL_RGBA : GL_ALPHA;
+    unsigned char *zeros = calloc(1, (size_t)page->width * page->height * _nnAtlasPixelSize(page));
+    if (!zeros)
+        return;
 
-    glPushMatrix();
+    glBindTexture(GL_TEXTURE_2D, page->textureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, page->width, page->height, 0, format, GL_UNSIGNED_BYTE, zeros);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(zeros);
 
-    // Translate to position
-    glTranslatef(x + srcRec.width / 2.0f, y + srcRec.height / 2.0f, 0);
+    page->shelfCount = 0;
+    page->nextY = 0;
+    page->generation++;
+}
 
-    // Apply rotation if any
-    if (image.angle != 0.0f)
+// Reserves a `width` x `height` rectangle on a shelf of the given page, pinning the shelf if `pinned` is set. Returns the shelf index or -1 if it does not fit.
+static int _nnAtlasPageAlloc(_nnAtlasPage *page, int width, int height, bool pinned, int *x, int *y)
+{
+    _nnAtlasShelf *best = NULL;
+    for (int i = 0; i < page->shelfCount; i++)
     {
-        glRotatef(image.angle, 0, 0, 1);
+        _nnAtlasShelf *shelf = &page->shelves[i];
+        if (shelf->height >= height && page->width - shelf->x >= width && (!best || shelf->height < best->height))
+            best = shelf;
     }
 
-    // Scale for flipping
-    float scaleX = image.isFlippedX ? -1.0f : 1.0f;
-    float scaleY = image.isFlippedY ? -1.0f : 1.0f;
-    glScalef(scaleX, scaleY, 1.0f);
-
-    // Adjust texture coordinates for the specified portion
-    float texLeft = srcRec.x / image.width;
-    float texRight = (srcRec.x + srcRec.width) / image.width;
-    float texTop = srcRec.y / image.height;
-    float texBottom = (srcRec.y + srcRec.height) / image.height;
+    // Open a new shelf if the best one wastes more than a third of its height
+    if ((!best || best->height * 2 > height * 3) && page->nextY + height <= page->height && page->shelfCount < _NN_MAX_FONT_ATLAS_SHELVES && width <= page->width)
+    {
+        best = &page->shelves[page->shelfCount++];
+        best->y = page->nextY;
+        best->height = height;
+        best->x = 0;
+        best->lastUsed = _nnstate.frameCount;
+        best->generation = page->generation;
+        best->pinned = false;
+        page->nextY += height;
+    }
 
-    // Render the portion centered at the origin
-    glBegin(GL_QUADS);
-    glTexCoord2f(texLeft, texTop);
-    glVertex2f(-srcRec.width / 2.0f, -srcRec.height / 2.0f);
-    glTexCoord2f(texRight, texTop);
-    glVertex2f(srcRec.width / 2.0f, -srcRec.height / 2.0f);
-    glTexCoord2f(texRight, texBottom);
-    glVertex2f(srcRec.width / 2.0f, srcRec.height / 2.0f);
-    glTexCoord2f(texLeft, texBottom);
-    glVertex2f(-srcRec.width / 2.0f, srcRec.height / 2.0f);
-    glEnd();
+    if (!best)
+        return -1;
 
-    glPopMatrix();
+    *x = best->x;
+    *y = best->y;
+    best->x += width;
+    best->pinned |= pinned;
+    page->allocations++;
+    return (int)(best - page->shelves);
+}
 
+// Uploads tightly packed RGBA pixels into a UI atlas page
+static void _nnAtlasUploadRGBA(int pageIndex, int x, int y, int width, int height, const unsigned char *pixels)
+{
+    glBindTexture(GL_TEXTURE_2D, _nnAtlasPages[pageIndex].textureID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
     glBindTexture(GL_TEXTURE_2D, 0);
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
 }
 
-void nnFlipImage(nnImage *image, bool flipX, bool flipY)
+// Uploads a tightly packed alpha bitmap into an atlas page. UI atlas pages get white pixels with the bitmap as alpha.
+static void _nnAtlasUpload(int pageIndex, int x, int y, int width, int height, const unsigned char *pixels)
 {
-    if (image->textureID == 0)
+    if (_nnAtlasPages[pageIndex].rgba)
     {
-        printf("Failed to flip image\n");
+        unsigned char *rgba = malloc((size_t)width * height * 4);
+        if (!rgba)
+            return;
+        for (size_t i = 0; i < (size_t)width * height; i++)
+        {
+            rgba[i * 4 + 0] = 255;
+            rgba[i * 4 + 1] = 255;
+            rgba[i * 4 + 2] = 255;
+            rgba[i * 4 + 3] = pixels[i];
+        }
+        _nnAtlasUploadRGBA(pageIndex, x, y, width, height, rgba);
+        free(rgba);
         return;
     }
-    if (flipX)
-        image->isFlippedX = !image->isFlippedX;
 
-    if (flipY)
-        image->isFlippedX = !image->isFlippedY;
+    glBindTexture(GL_TEXTURE_2D, _nnAtlasPages[pageIndex].textureID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-void nnRotateImage(nnImage *image, float angle)
+// Creates an empty atlas page large enough for a `width` x `height` rectangle. Returns the page index or -1.
+static int _nnCreateAtlasPage(int width, int height, bool glyphs, bool sdf)
 {
-    if (image->textureID == 0)
+    if (_nnAtlasPageCount >= _NN_MAX_FONT_ATLAS_PAGES)
     {
-        printf("Failed to rotate image\n");
-        return;
+        printf("Error: Too many font atlas pages! Increase _NN_MAX_FONT_ATLAS_PAGES.\n");
+        return -1;
     }
 
-    image->angle = fmod(angle, 360.0f);
-    if (image->angle < 0.0f)
+    // Pages are square powers of two, large enough for the rectangle
+    _nnAtlasPage *page = &_nnAtlasPages[_nnAtlasPageCount];
+    memset(page, 0, sizeof(_nnAtlasPage));
+    page->glyphs = glyphs;
+    page->sdf = sdf;
+    page->rgba = _nnUIAtlas && !sdf;
+    page->width = _NN_FONT_ATLAS_MIN_PAGE_SIZE;
+    while (page->width < width || page->width < height)
+        page->width *= 2;
+    page->height = page->width;
+
+    glGenTextures(1, &page->textureID);
+    _nnClearAtlasPage(page);
+
+    glBindTexture(GL_TEXTURE_2D, page->textureID);
+    if (!_nnstate.filtered && !sdf)
     {
-        image->angle += 360.0f;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
-}
+    else
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
 
-void nnScaleImage(nnImage *image, float scaleX, float scaleY)
-{
-    if (image->textureID == 0)
+    // The first UI atlas page gets a white 3x3 block, its center is sampled for solid fills without bleeding under filtering
+    if (page->rgba && _nnWhitePixelPage < 0)
     {
-        printf("Failed to scale image\n");
-        return;
+        unsigned char white[3 * 3 * 4];
+        memset(white, 255, sizeof(white));
+        int x, y;
+        _nnAtlasPageAlloc(page, 3, 3, true, &x, &y);
+        _nnAtlasUploadRGBA(_nnAtlasPageCount, x, y, 3, 3, white);
+        _nnWhitePixelPage = _nnAtlasPageCount;
+        _nnWhitePixelX = x + 1;
+        _nnWhitePixelY = y + 1;
     }
 
-    image->scaleX = scaleX;
-    image->scaleY = scaleY;
+    return _nnAtlasPageCount++;
 }
 
-void nnFreeImage(nnImage image)
+// Doubles the size of an atlas page, keeping its contents. Returns false once the page has reached _NN_FONT_ATLAS_MAX_PAGE_SIZE.
+static bool _nnGrowAtlasPage(int pageIndex)
 {
-    if (!image.textureID == 0)
-        return;
+    _nnAtlasPage *page = &_nnAtlasPages[pageIndex];
+    if (page->width >= _NN_FONT_ATLAS_MAX_PAGE_SIZE)
+        return false;
+
+    // Queued quads have texture coordinates for the old size
+    _nnFlushBatch();
+    _nnAtlasGeneration++;
+
+    int width = page->width * 2;
+    int height = page->height * 2;
+    int pixelSize = _nnAtlasPixelSize(page);
+    GLenum format = page->rgba ? GL_RGBA : GL_ALPHA;
+    unsigned char *oldPixels = malloc((size_t)page->width * page->height * pixelSize);
+    unsigned char *pixels = calloc(1, (size_t)width * height * pixelSize);
+    if (!oldPixels || !pixels)
+    {
+        free(oldPixels);
+        free(pixels);
+        return false;
+    }
 
-    glDeleteTextures(1, &image.textureID);
-}
+    glBindTexture(GL_TEXTURE_2D, page->textureID);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTexImage(GL_TEXTURE_2D, 0, format, GL_UNSIGNED_BYTE, oldPixels);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    for (int row = 0; row < page->height; row++)
+        memcpy(pixels + (size_t)row * width * pixelSize, oldPixels + (size_t)row * page->width * pixelSize, (size_t)page->width * pixelSize);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(oldPixels);
+    free(pixels);
 
-/*
- * Pixmap Management and Drawing
- */
-
-nnPixmap *nnCreatePixmap(int width, int height)
-{
-    nnPixmap *pixmap = malloc(sizeof(nnPixmap));
-    pixmap->isFlippedX = false;
-    pixmap->isFlippedY = false;
-    pixmap->scaleX = 1.0f;
-    pixmap->scaleY = 1.0f;
-    pixmap->angle = 0.0f;
+    page->width = width;
+    page->height = height;
 
-    if (!pixmap)
+    // Texture coordinates of glyphs are computed from the page size when drawing, only the copies in the fonts need an update
+    for (nnFontFace *face = _nnFontFaces; face; face = face->next)
     {
-        printf("Failed to create pixmap");
-        return NULL;
+        for (nnFont *font = face->sizes; font; font = font->nextSize)
+        {
+            if (font->atlasPage == pageIndex)
+            {
+                font->atlasWidth = width;
+                font->atlasHeight = height;
+            }
+        }
     }
 
-    pixmap->width = width;
-    pixmap->height = height;
+    return true;
+}
 
-    // Allocate pixel memory
-    pixmap->pixels = calloc(width * height, sizeof(nnColorf));
-    if (!pixmap->pixels)
-    {
-        printf("Failed to create pixmap pixel buffer");
-        free(pixmap);
-        return NULL;
-    }
+// Returns `true` if baked blocks can be placed on the page. UI atlas pages hold everything but signed distance fields.
+static bool _nnAtlasPageHoldsBlocks(_nnAtlasPage *page)
+{
+    return page->rgba || !page->glyphs;
+}
 
-    // Create OpenGL texture
-    glGenTextures(1, &pixmap->textureID);
-    glBindTexture(GL_TEXTURE_2D, pixmap->textureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_FLOAT, pixmap->pixels);
+// Returns `true` if glyphs of the given kind can be placed on the page
+static bool _nnAtlasPageHoldsGlyphs(_nnAtlasPage *page, bool sdf)
+{
+    return page->sdf == sdf && (page->rgba || page->glyphs);
+}
 
-    // Set texture parameters
-    if (!_nnstate.filtered)
+// Reserves a rectangle for a baked block or atlas image, growing a page or creating a new one if none has room. Returns the page index or -1.
+static int _nnAtlasAlloc(int width, int height, int *x, int *y)
+{
+    for (int i = 0; i < _nnAtlasPageCount; i++)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        if (_nnAtlasPageHoldsBlocks(&_nnAtlasPages[i]) && _nnAtlasPageAlloc(&_nnAtlasPages[i], width, height, true, x, y) >= 0)
+            return i;
     }
-    else
+
+    for (int i = 0; i < _nnAtlasPageCount; i++)
     {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        while (_nnAtlasPageHoldsBlocks(&_nnAtlasPages[i]) && _nnGrowAtlasPage(i))
+        {
+            if (_nnAtlasPageAlloc(&_nnAtlasPages[i], width, height, true, x, y) >= 0)
+                return i;
+        }
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    int pageIndex = _nnCreateAtlasPage(width, height, false, false);
+    if (pageIndex < 0 || _nnAtlasPageAlloc(&_nnAtlasPages[pageIndex], width, height, true, x, y) < 0)
+        return -1;
 
-    return pixmap;
+    return pageIndex;
 }
 
-nnPixmap *nnCreatePixmapFromImage(nnImage image)
+// Empties a glyph shelf, so the glyphs on it are rasterized again the next time they are drawn
+static void _nnEvictAtlasShelf(_nnAtlasPage *page, _nnAtlasShelf *shelf)
 {
-    if (image.textureID == 0 || image.width <= 0 || image.height <= 0)
+    // Queued quads may show glyphs of the shelf
+    _nnFlushBatch();
+    _nnAtlasGeneration++;
+
+    unsigned char *zeros = calloc(1, (size_t)page->width * shelf->height * _nnAtlasPixelSize(page));
+    if (zeros)
     {
-        printf("Failed to create pixmap from image");
-        return NULL; // Invalid image
+        glBindTexture(GL_TEXTURE_2D, page->textureID);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, shelf->y, page->width, shelf->height, page->rgba ? GL_RGBA : GL_ALPHA, GL_UNSIGNED_BYTE, zeros);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        free(zeros);
     }
 
-    // Allocate a new pixmap
-    nnPixmap *pixmap = nnCreatePixmap(image.width, image.height);
-    if (!pixmap)
+    shelf->x = 0;
+    shelf->lastUsed = _nnstate.frameCount;
+    shelf->generation = ++page->generation;
+}
+
+// Reserves a rectangle for a glyph on a glyph page of the given kind. When all glyph pages of the kind are full, the least
+// recently used shelf that is tall enough is evicted, or the least recently used page if no shelf is tall enough.
+// Pinned shelves, and pages with pinned shelves, are never evicted.
+static bool _nnAtlasAllocGlyph(int width, int height, bool sdf, int *pageIndex, int *shelfIndex, int *x, int *y)
+{
+    int glyphPages = 0;
+    for (int i = 0; i < _nnAtlasPageCount; i++)
     {
-        return NULL; // Failed to allocate pixmap
+        if (!_nnAtlasPageHoldsGlyphs(&_nnAtlasPages[i], sdf))
+            continue;
+
+        if (_nnAtlasPages[i].glyphs)
+            glyphPages++;
+        *shelfIndex = _nnAtlasPageAlloc(&_nnAtlasPages[i], width, height, false, x, y);
+        if (*shelfIndex >= 0)
+        {
+            *pageIndex = i;
+            return true;
+        }
     }
 
-    // Allocate a buffer to read the image data from the GPU
-    unsigned char *pixelData = malloc(image.width * image.height * 4); // 4 bytes per pixel (RGBA)
-    if (!pixelData)
+    for (int i = 0; i < _nnAtlasPageCount; i++)
     {
-        nnFreePixmap(pixmap);
-        return NULL; // Memory allocation failed
+        while (_nnAtlasPageHoldsGlyphs(&_nnAtlasPages[i], sdf) && _nnGrowAtlasPage(i))
+        {
+            *shelfIndex = _nnAtlasPageAlloc(&_nnAtlasPages[i], width, height, false, x, y);
+            if (*shelfIndex >= 0)
+            {
+                *pageIndex = i;
+                return true;
+            }
+        }
     }
 
-    // Read the image data from the GPU
-    glBindTexture(GL_TEXTURE_2D, image.textureID);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixelData);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (glyphPages < _NN_MAX_GLYPH_ATLAS_PAGES && _nnAtlasPageCount < _NN_MAX_FONT_ATLAS_PAGES)
+    {
+        *pageIndex = _nnCreateAtlasPage(width, height, true, sdf);
+        if (*pageIndex < 0)
+            return false;
 
-    // Copy the pixel data into the pixmap
-    for (int y = 0; y < image.height; y++)
+        *shelfIndex = _nnAtlasPageAlloc(&_nnAtlasPages[*pageIndex], width, height, false, x, y);
+        return *shelfIndex >= 0;
+    }
+
+    _nnAtlasPage *lruPage = NULL;
+    _nnAtlasShelf *lruShelf = NULL;
+    _nnAtlasPage *lruWholePage = NULL;
+    unsigned int lruWholePageUsed = 0;
+    for (int i = 0; i < _nnAtlasPageCount; i++)
     {
-        for (int x = 0; x < image.width; x++)
+        _nnAtlasPage *page = &_nnAtlasPages[i];
+        if (!_nnAtlasPageHoldsGlyphs(page, sdf))
+            continue;
+
+        unsigned int pageUsed = 0;
+        bool pagePinned = false;
+        for (int j = 0; j < page->shelfCount; j++)
         {
-            int index = (y * image.width + x) * 4; // Calculate the pixel index
-            nnColorf color = {
-                pixelData[index] / 255.0f,
-                pixelData[index + 1] / 255.0f,
-                pixelData[index + 2] / 255.0f,
-                pixelData[index + 3] / 255.0f};
-            nnDrawPixel(pixmap, x, y, color);
+            _nnAtlasShelf *shelf = &page->shelves[j];
+            if (shelf->lastUsed > pageUsed)
+                pageUsed = shelf->lastUsed;
+            if (shelf->pinned)
+            {
+                pagePinned = true;
+                continue;
+            }
+            if (shelf->height >= height && shelf->height * 2 <= height * 3 && page->width >= width &&
+                (!lruShelf || shelf->lastUsed < lruShelf->lastUsed))
+            {
+                lruPage = page;
+                lruShelf = shelf;
+            }
+        }
+
+        if (!pagePinned && page->width >= width && page->height >= height && (!lruWholePage || pageUsed < lruWholePageUsed))
+        {
+            lruWholePage = page;
+            lruWholePageUsed = pageUsed;
         }
     }
 
-    // Upload the pixel data to the pixmap's GPU texture
-    nnUpdatePixmap(pixmap);
+    if (lruShelf)
+    {
+        _nnEvictAtlasShelf(lruPage, lruShelf);
+        lruShelf->x = width;
+        *pageIndex = (int)(lruPage - _nnAtlasPages);
+        *shelfIndex = (int)(lruShelf - lruPage->shelves);
+        *x = 0;
+        *y = lruShelf->y;
+        return true;
+    }
 
-    // Free the temporary pixel data buffer
-    free(pixelData);
+    if (!lruWholePage)
+        return false;
 
-    return pixmap;
+    _nnClearAtlasPage(lruWholePage);
+    *pageIndex = (int)(lruWholePage - _nnAtlasPages);
+    *shelfIndex = _nnAtlasPageAlloc(lruWholePage, width, height, false, x, y);
+    return *shelfIndex >= 0;
 }
 
-void nnUpdatePixmap(nnPixmap *buffer)
+// Releases a rectangle of an atlas page. Space is reclaimed once the whole page is unused.
+static void _nnAtlasRelease(int pageIndex)
 {
-    if (!buffer || !buffer->pixels)
+    if (pageIndex < 0 || pageIndex >= _nnAtlasPageCount)
         return;
 
-    glBindTexture(GL_TEXTURE_2D, buffer->textureID);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, buffer->width, buffer->height, GL_RGBA, GL_FLOAT, buffer->pixels);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    _nnAtlasPage *page = &_nnAtlasPages[pageIndex];
+    if (--page->allocations == 0)
+        _nnClearAtlasPage(page);
 }
 
-void nnDrawPixmap(nnPixmap *pixmap, int x, int y)
+// Copies a baked glyph block into the atlas and points the font at it. Baked glyphs have a one pixel gap around them, so filtering does not bleed between blocks.
+static bool _nnAddFontBlock(nnFont *font, const unsigned char *bitmap, int width, int height, const stbtt_packedchar *charData)
 {
-    if (!pixmap || !pixmap->pixels)
-        return;
-
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, pixmap->textureID);
-
-    // Enable alpha blending
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    int x, y;
+    int pageIndex = _nnAtlasAlloc(width, height, &x, &y);
+    if (pageIndex < 0)
+    {
+        printf("Failed to allocate atlas space for font.\n");
+        return false;
+    }
 
-    glPushMatrix();
+    _nnAtlasUpload(pageIndex, x, y, width, height, bitmap);
 
-    // Translate to position
-    glTranslatef(x + pixmap->width / 2.0f, y + pixmap->height / 2.0f, 0);
+    _nnAtlasPage *page = &_nnAtlasPages[pageIndex];
+    font->atlasPage = pageIndex;
+    font->textureID = page->textureID;
+    font->atlasWidth = page->width;
+    font->atlasHeight = page->height;
 
-    // Apply rotation if any
-    if (pixmap->angle != 0.0f)
+    for (int i = 0; i < 96; i++)
     {
-        glRotatef(pixmap->angle, 0, 0, 1);
+        font->charData[i] = charData[i];
+        font->charData[i].x0 += x;
+        font->charData[i].x1 += x;
+        font->charData[i].y0 += y;
+        font->charData[i].y1 += y;
     }
 
-    // Apply flipping
-    float flipX = pixmap->isFlippedX ? -1.0f : 1.0f;
-    float flipY = pixmap->isFlippedY ? -1.0f : 1.0f;
-
-    // Apply scaling
-    glScalef(pixmap->scaleX * flipX, pixmap->scaleY * flipY, 1.0f);
+    return true;
+}
 
-    // Render the quad centered at the origin
-    glBegin(GL_QUADS);
-    glTexCoord2f(0.0f, 1.0f);
-    glVertex2f(-pixmap->width / 2.0f, -pixmap->height / 2.0f);
-    glTexCoord2f(1.0f, 1.0f);
-    glVertex2f(pixmap->width / 2.0f, -pixmap->height / 2.0f);
-    glTexCoord2f(1.0f, 0.0f);
-    glVertex2f(pixmap->width / 2.0f, pixmap->height / 2.0f);
-    glTexCoord2f(0.0f, 0.0f);
-    glVertex2f(-pixmap->width / 2.0f, pixmap->height / 2.0f);
-    glEnd();
+// Decodes the UTF-8 sequence at `*text` and moves `*text` past it. Invalid bytes decode to U+FFFD.
+// A sequence cut off by `end` (or by the terminating zero if `end` is NULL) is invalid.
+static int _nnDecodeUTF8(const char **text, const char *end)
+{
+    const unsigned char *bytes = (const unsigned char *)*text;
+    int codepoint, length;
+    if (bytes[0] < 0x80)
+    {
+        codepoint = bytes[0];
+        length = 1;
+    }
+    else if ((bytes[0] & 0xe0) == 0xc0)
+    {
+        codepoint = bytes[0] & 0x1f;
+        length = 2;
+    }
+    else if ((bytes[0] & 0xf0) == 0xe0)
+    {
+        codepoint = bytes[0] & 0x0f;
+        length = 3;
+    }
+    else if ((bytes[0] & 0xf8) == 0xf0)
+    {
+        codepoint = bytes[0] & 0x07;
+        length = 4;
+    }
+    else
+    {
+        *text += 1;
+        return 0xfffd;
+    }
 
-    glPopMatrix();
+    for (int i = 1; i < length; i++)
+    {
+        // This also stops at the terminating zero of a cut off sequence
+        if ((end && *text + i >= end) || (bytes[i] & 0xc0) != 0x80)
+        {
+            *text += i;
+            return 0xfffd;
+        }
+        codepoint = (codepoint << 6) | (bytes[i] & 0x3f);
+    }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
+    *text += length;
+    return codepoint;
 }
 
-void nnFlipPixmap(nnPixmap *pixmap, bool flipX, bool flipY)
+// Horizontal advance of a codepoint in the given font
+static float _nnCodepointAdvance(nnFont *font, int codepoint)
 {
-    if (pixmap->textureID == 0)
-    {
-        printf("Failed to flip pixmap\n");
-        return;
-    }
-    if (flipX)
-        pixmap->isFlippedX = !pixmap->isFlippedX;
+    if (codepoint >= 32 && codepoint < 128 && !font->sdf)
+        return font->charData[codepoint - 32].xadvance;
 
-    if (flipY)
-        pixmap->isFlippedY = !pixmap->isFlippedY;
+    int advanceWidth, leftSideBearing;
+    stbtt_GetCodepointHMetrics(&font->face->fontInfo, codepoint, &advanceWidth, &leftSideBearing);
+    return font->scale * advanceWidth;
 }
 
-void nnRotatePixmap(nnPixmap *pixmap, float angle)
+#define _NN_KERNING_CHARS 96
+
+// Builds the kerning table of the ASCII pairs of a face. Faces without kerning data stay unkerned.
+static void _nnLoadFaceKerning(nnFontFace *face)
 {
-    if (pixmap->textureID == 0)
+    stbtt_fontinfo *fontInfo = &face->fontInfo;
+    if (face->kerning || (!fontInfo->kern && !fontInfo->gpos))
+        return;
+
+    short *kerning = calloc(_NN_KERNING_CHARS * _NN_KERNING_CHARS, sizeof(short));
+    if (!kerning)
     {
-        printf("Failed to rotate pixmap\n");
+        printf("Failed to allocate memory for the kerning table.\n");
         return;
     }
 
-    pixmap->angle = fmod(angle, 360.0f);
-    if (pixmap->angle < 0.0f)
+    // Looking up the glyph indices once saves a cmap search per pair
+    int glyphs[_NN_KERNING_CHARS];
+    for (int i = 0; i < _NN_KERNING_CHARS; i++)
+        glyphs[i] = stbtt_FindGlyphIndex(fontInfo, 32 + i);
+
+    for (int i = 0; i < _NN_KERNING_CHARS; i++)
     {
-        pixmap->angle += 360.0f;
+        for (int j = 0; j < _NN_KERNING_CHARS; j++)
+            kerning[i * _NN_KERNING_CHARS + j] = (short)stbtt_GetGlyphKernAdvance(fontInfo, glyphs[i], glyphs[j]);
     }
+
+    face->kerning = kerning;
 }
 
-void nnScalePixmap(nnPixmap *pixmap, float scaleX, float scaleY)
+// Doubles the capacity of the kerning pair table of a face
+static bool _nnGrowKernPairTable(nnFontFace *face)
 {
-    if (pixmap->textureID == 0)
+    int capacity = face->kernPairCapacity ? face->kernPairCapacity * 2 : 64;
+    struct _nnKernPair *pairs = calloc(capacity, sizeof(struct _nnKernPair));
+    if (!pairs)
+        return false;
+
+    for (int i = 0; i < face->kernPairCapacity; i++)
     {
-        printf("Failed to scale pixmap\n");
-        return;
+        struct _nnKernPair *pair = &face->kernPairs[i];
+        if (pair->first == 0)
+            continue;
+
+        unsigned int slot = (((unsigned int)pair->first * 2654435761u) ^ (unsigned int)pair->second) * 2654435761u & (capacity - 1);
+        while (pairs[slot].first != 0)
+            slot = (slot + 1) & (capacity - 1);
+        pairs[slot] = *pair;
     }
 
-    pixmap->scaleX = scaleX;
-    pixmap->scaleY = scaleY;
+    free(face->kernPairs);
+    face->kernPairs = pairs;
+    face->kernPairCapacity = capacity;
+    return true;
 }
 
-nnPixmap *nnCopyPixmap(nnPixmap *pixmap)
+// Returns the kerning in font units of a pair outside ASCII, looking it up in the font only the first time
+static int _nnGetKernPair(nnFontFace *face, int first, int second)
 {
-    if (!pixmap || !pixmap->pixels)
-        return NULL;
+    if (face->kernPairCount * 4 >= face->kernPairCapacity * 3 && !_nnGrowKernPairTable(face))
+        return stbtt_GetCodepointKernAdvance(&face->fontInfo, first, second);
 
-    // Allocate a new pixmap
-    nnPixmap *newPixmap = nnCreatePixmap(pixmap->width, pixmap->height);
-    if (!newPixmap)
-        return NULL;
+    unsigned int slot = (((unsigned int)first * 2654435761u) ^ (unsigned int)second) * 2654435761u & (face->kernPairCapacity - 1);
+    while (face->kernPairs[slot].first != 0)
+    {
+        struct _nnKernPair *pair = &face->kernPairs[slot];
+        if (pair->first == first && pair->second == second)
+            return pair->kerning;
+        slot = (slot + 1) & (face->kernPairCapacity - 1);
+    }
 
-    // Copy pixel data from the original pixmap
-    memcpy(newPixmap->pixels, pixmap->pixels, pixmap->width * pixmap->height * sizeof(nnColorf));
+    struct _nnKernPair *pair = &face->kernPairs[slot];
+    pair->first = first;
+    pair->second = second;
+    pair->kerning = (short)stbtt_GetCodepointKernAdvance(&face->fontInfo, first, second);
+    face->kernPairCount++;
+    return pair->kerning;
+}
 
-    // Update the texture on the GPU
-    nnUpdatePixmap(newPixmap);
+// Horizontal adjustment between two codepoints in the given font, 0 if the font is not kerned or `previous` is no character
+static float _nnKernAdvance(nnFont *font, int previous, int codepoint)
+{
+    nnFontFace *face = font->face;
+    if (!face->kerning || previous < 32)
+        return 0.0f;
 
-    return newPixmap;
+    if (previous < 128 && codepoint < 128)
+        return font->scale * face->kerning[(previous - 32) * _NN_KERNING_CHARS + codepoint - 32];
+
+    return font->scale * _nnGetKernPair(face, previous, codepoint);
 }
 
-void nnFreePixmap(nnPixmap *buffer)
+// Rasterizes a glyph into a glyph page, as a signed distance field for SDF fonts
+static bool _nnRasterizeGlyph(nnFont *font, struct _nnGlyph *glyph)
 {
-    if (!buffer)
-        return;
+    stbtt_fontinfo *fontInfo = &font->face->fontInfo;
+    memset(&glyph->quad, 0, sizeof(glyph->quad));
+    glyph->quad.xadvance = _nnCodepointAdvance(font, glyph->codepoint);
+    glyph->page = -1;
+
+    int width, height, xoff, yoff;
+    unsigned char *bitmap;
+    if (font->sdf)
+    {
+        // Distances map to alpha with the outline at 128, falling off over _NN_SDF_PADDING pixels
+        bitmap = stbtt_GetCodepointSDF(fontInfo, font->scale, glyph->codepoint, _NN_SDF_PADDING, 128, 128.0f / _NN_SDF_PADDING, &width, &height, &xoff, &yoff);
+        if (!bitmap)
+            return true;
+    }
+    else
+    {
+        int x0, y0, x1, y1;
+        stbtt_GetCodepointBitmapBox(fontInfo, glyph->codepoint, font->scale, font->scale, &x0, &y0, &x1, &y1);
+        width = x1 - x0;
+        height = y1 - y0;
+        xoff = x0;
+        yoff = y0;
+        if (width <= 0 || height <= 0)
+            return true;
+
+        bitmap = malloc((size_t)width * height);
+        if (!bitmap)
+            return false;
+        stbtt_MakeCodepointBitmap(fontInfo, bitmap, width, height, width, font->scale, font->scale, glyph->codepoint);
+    }
 
-    if (buffer->pixels)
-        free(buffer->pixels);
-    glDeleteTextures(1, &buffer->textureID);
-    free(buffer);
-}
+    // The rectangle has a one pixel gap on its top and left, so filtering does not bleed between glyphs
+    int pageIndex, shelfIndex, x, y;
+    if (!_nnAtlasAllocGlyph(width + 1, height + 1, font->sdf, &pageIndex, &shelfIndex, &x, &y))
+    {
+        free(bitmap);
+        return false;
+    }
 
-//// Primitives
+    _nnAtlasUpload(pageIndex, x + 1, y + 1, width, height, bitmap);
+    free(bitmap);
 
-void nnPutPixel(float x, float y)
-{
-    glBegin(GL_POINTS);
-    glVertex2f(x, y);
-    glEnd();
+    glyph->page = pageIndex;
+    glyph->shelf = shelfIndex;
+    glyph->generation = _nnAtlasPages[pageIndex].shelves[shelfIndex].generation;
+    glyph->quad.x0 = x + 1;
+    glyph->quad.y0 = y + 1;
+    glyph->quad.x1 = x + 1 + width;
+    glyph->quad.y1 = y + 1 + height;
+    glyph->quad.xoff = (float)xoff;
+    glyph->quad.yoff = (float)yoff;
+    glyph->quad.xoff2 = (float)(xoff + width);
+    glyph->quad.yoff2 = (float)(yoff + height);
+    return true;
 }
 
-void nnDrawPixel(nnPixmap *pixmap, int x, int y, nnColorf color)
+// Doubles the capacity of the glyph table of a font
+static bool _nnGrowGlyphTable(nnFont *font)
 {
-    if (!pixmap || x < 0 || y < 0 || x >= pixmap->width || y >= pixmap->height)
-        return;
+    int capacity = font->glyphCapacity ? font->glyphCapacity * 2 : 64;
+    struct _nnGlyph *glyphs = calloc(capacity, sizeof(struct _nnGlyph));
+    if (!glyphs)
+        return false;
 
-    y = pixmap->height - 1 - y; // Adjust y-coordinate for top-left origin
-    pixmap->pixels[y * pixmap->width + x] = color;
+    for (int i = 0; i < font->glyphCapacity; i++)
+    {
+        struct _nnGlyph *glyph = &font->glyphs[i];
+        if (glyph->codepoint == 0)
+            continue;
+
+        unsigned int slot = ((unsigned int)glyph->codepoint * 2654435761u) & (capacity - 1);
+        while (glyphs[slot].codepoint != 0)
+            slot = (slot + 1) & (capacity - 1);
+        glyphs[slot] = *glyph;
+    }
+
+    free(font->glyphs);
+    font->glyphs = glyphs;
+    font->glyphCapacity = capacity;
+    return true;
 }
 
-void nnDrawLine(nnPixmap *pixmap, int x0, int y0, int x1, int y1, nnColorf color)
+// Returns the glyph of a codepoint outside ASCII. Missing glyphs, and glyphs whose shelf was evicted, are rasterized first.
+static struct _nnGlyph *_nnGetGlyph(nnFont *font, int codepoint)
 {
-    if (!pixmap)
-        return;
+    if (font->glyphCount * 4 >= font->glyphCapacity * 3 && !_nnGrowGlyphTable(font))
+        return NULL;
 
-    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy, e2;
+    unsigned int slot = ((unsigned int)codepoint * 2654435761u) & (font->glyphCapacity - 1);
+    while (font->glyphs[slot].codepoint != 0 && font->glyphs[slot].codepoint != codepoint)
+        slot = (slot + 1) & (font->glyphCapacity - 1);
 
-    while (true)
+    struct _nnGlyph *glyph = &font->glyphs[slot];
+    if (glyph->codepoint == codepoint)
     {
-        nnDrawPixel(pixmap, x0, y0, color);
-        if (x0 == x1 && y0 == y1)
-            break;
-        e2 = 2 * err;
-        if (e2 >= dy)
-        {
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx)
+        if (glyph->page < 0)
+            return glyph;
+
+        _nnAtlasShelf *shelf = &_nnAtlasPages[glyph->page].shelves[glyph->shelf];
+        if (glyph->shelf < _nnAtlasPages[glyph->page].shelfCount && shelf->generation == glyph->generation)
         {
-            err += dx;
-            y0 += sy;
+            shelf->lastUsed = _nnstate.frameCount;
+            return glyph;
         }
     }
-}
-
-void nnDrawOval(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf color, bool filled)
-{
-    if (!pixmap)
-        return;
 
-    int a = width / 2;
-    int b = height / 2;
-    int x0 = x - a, y0 = y - b;
+    if (glyph->codepoint == 0)
+    {
+        glyph->codepoint = codepoint;
+        font->glyphCount++;
+    }
 
-    if (filled)
+    if (!_nnRasterizeGlyph(font, glyph))
     {
-        for (int i = 0; i <= height; i++)
-        {
-            for (int j = 0; j <= width; j++)
-            {
-                int px = x0 + j;
-                int py = y0 + i;
-                if (((j - a) * (j - a)) * b * b + ((i - b) * (i - b)) * a * a <= a * a * b * b)
-                {
-                    nnDrawPixel(pixmap, px, py, color);
-                }
-            }
-        }
+        glyph->page = -1;
+        return NULL;
     }
-    else
+
+    return glyph;
+}
+
+// Creates a size instance of a face without glyphs
+static nnFont *_nnCreateFontSize(nnFontFace *face, float fontSize)
+{
+    nnFont *font = calloc(1, sizeof(nnFont));
+    if (!font)
     {
-        int x1 = 0, y1 = b;
-        int a2 = a * a, b2 = b * b;
-        int fa2 = 4 * a2, fb2 = 4 * b2;
-        int sigma = 2 * b2 + a2 * (1 - 2 * b);
+        printf("Failed to allocate memory for font.\n");
+        return NULL;
+    }
 
-        while (b2 * x1 <= a2 * y1)
-        {
-            nnDrawPixel(pixmap, x + x1, y + y1, color);
-            nnDrawPixel(pixmap, x - x1, y + y1, color);
-            nnDrawPixel(pixmap, x + x1, y - y1, color);
-            nnDrawPixel(pixmap, x - x1, y - y1, color);
+    font->face = face;
+    font->size = fontSize;
+    font->atlasPage = -1;
+    font->oversampling = 1;
 
-            if (sigma >= 0)
-            {
-                sigma += fa2 * (1 - y1);
-                y1--;
-            }
-            sigma += b2 * ((4 * x1) + 6);
-            x1++;
-        }
+    // Calculate font scale
+    font->scale = stbtt_ScaleForPixelHeight(&face->fontInfo, fontSize);
 
-        x1 = a;
-        y1 = 0;
-        sigma = 2 * a2 + b2 * (1 - 2 * a);
+    // Calculate height from actual glyphs (averaging between capital and lowercase letters)
+    int minYCap, maxYCap, minYLower, maxYLower;
 
-        while (a2 * y1 <= b2 * x1)
-        {
-            nnDrawPixel(pixmap, x + x1, y + y1, color);
-            nnDrawPixel(pixmap, x - x1, y + y1, color);
-            nnDrawPixel(pixmap, x + x1, y - y1, color);
-            nnDrawPixel(pixmap, x - x1, y - y1, color);
+    // Get bounding box for a capital letter (e.g., 'A')
+    stbtt_GetCodepointBox(&face->fontInfo, 'A', NULL, &minYCap, NULL, &maxYCap);
 
-            if (sigma >= 0)
-            {
-                sigma += fb2 * (1 - x1);
-                x1--;
-            }
-            sigma += a2 * ((4 * y1) + 6);
-            y1++;
-        }
-    }
+    // Get bounding box for a lowercase letter (e.g., 'x')
+    stbtt_GetCodepointBox(&face->fontInfo, 'x', NULL, &minYLower, NULL, &maxYLower);
+
+    // Scale and average the heights
+    float capHeight = font->scale * (maxYCap - minYCap);
+    float lowerHeight = font->scale * (maxYLower - minYLower);
+    font->glyphHeight = (capHeight + lowerHeight) / 2.0f;
+
+    return font;
 }
 
-void nnDrawTriangle(nnPixmap *pixmap, int x1, int y1, int x2, int y2, int x3, int y3, nnColorf color, bool filled)
+// Returns the cached size of a face, baking it into the atlas first if it is new
+static nnFont *_nnGetFaceSize(nnFontFace *face, float fontSize, bool sdf)
 {
-    if (!pixmap)
-        return;
-
-    if (filled)
+    for (nnFont *font = face->sizes; font; font = font->nextSize)
     {
-        // Sorting vertices by y-coordinate
-        if (y1 > y2)
-        {
-            int tmp;
-            tmp = y1;
-            y1 = y2;
-            y2 = tmp;
-            tmp = x1;
-            x1 = x2;
-            x2 = tmp;
-        }
-        if (y1 > y3)
-        {
-            int tmp;
-            tmp = y1;
-            y1 = y3;
-            y3 = tmp;
-            tmp = x1;
-            x1 = x3;
-            x3 = tmp;
-        }
-        if (y2 > y3)
-        {
-            int tmp;
-            tmp = y2;
-            y2 = y3;
-            y3 = tmp;
-            tmp = x2;
-            x2 = x3;
-            x3 = tmp;
-        }
+        if (font->size == fontSize && font->sdf == sdf)
+            return font;
+    }
 
-        int dx1 = x2 - x1, dy1 = y2 - y1, dx2 = x3 - x1, dy2 = y3 - y1, dx3 = x3 - x2, dy3 = y3 - y2;
-        float slope1 = dy1 ? (float)dx1 / dy1 : 0;
-        float slope2 = dy2 ? (float)dx2 / dy2 : 0;
-        float slope3 = dy3 ? (float)dx3 / dy3 : 0;
+    nnFont *font = _nnCreateFontSize(face, fontSize);
+    if (!font)
+        return NULL;
 
-        for (int y = y1; y <= y2; y++)
+    // SDF sizes bake nothing, their glyphs are generated once for the face and scaled when drawn
+    if (sdf)
+    {
+        if (!face->sdfGlyphs)
         {
-            int x_start = x1 + (y - y1) * slope1;
-            int x_end = x1 + (y - y1) * slope2;
-            if (x_start > x_end)
-            {
-                int tmp = x_start;
-                x_start = x_end;
-                x_end = tmp;
-            }
-            for (int x = x_start; x <= x_end; x++)
+            face->sdfGlyphs = _nnCreateFontSize(face, _NN_SDF_FONT_SIZE);
+            if (!face->sdfGlyphs)
             {
-                nnDrawPixel(pixmap, x, y, color);
+                free(font);
+                return NULL;
             }
+            face->sdfGlyphs->sdf = true;
         }
-        for (int y = y2; y <= y3; y++)
+
+        font->sdf = true;
+        font->nextSize = face->sizes;
+        face->sizes = font;
+        return font;
+    }
+
+    // Pack into the smallest power of two that fits, then only keep the rows that were used
+    unsigned char *bitmap = NULL;
+    stbtt_packedchar charData[96];
+    stbtt_pack_range range = {.font_size = fontSize, .first_unicode_codepoint_in_range = 32, .num_chars = 96, .chardata_for_range = charData};
+    int width = 0, usedRows = 0;
+    for (int size = 64; size <= 4096 && !usedRows; size *= 2)
+    {
+        for (int height = size / 2; height <= size && !usedRows; height *= 2)
         {
-            int x_start = x2 + (y - y2) * slope3;
-            int x_end = x1 + (y - y1) * slope2;
-            if (x_start > x_end)
-            {
-                int tmp = x_start;
-                x_start = x_end;
-                x_end = tmp;
-            }
-            for (int x = x_start; x <= x_end; x++)
+            free(bitmap);
+            bitmap = calloc(1, (size_t)size * height);
+            if (!bitmap)
+                break;
+
+            stbtt_pack_context context;
+            if (!stbtt_PackBegin(&context, bitmap, size, height, 0, 1, NULL))
+                continue;
+            stbtt_PackSetOversampling(&context, _nnFontOversampling, _nnFontOversampling);
+            int packed = stbtt_PackFontRanges(&context, face->fontBuffer, 0, &range, 1);
+            stbtt_PackEnd(&context);
+
+            if (packed)
             {
-                nnDrawPixel(pixmap, x, y, color);
+                width = size;
+                for (int i = 0; i < 96; i++)
+                {
+                    if (charData[i].y1 + 1 > usedRows)
+                        usedRows = charData[i].y1 + 1;
+                }
             }
         }
     }
-    else
+
+    if (!bitmap || !usedRows || !_nnAddFontBlock(font, bitmap, width, usedRows, charData))
     {
-        nnDrawLine(pixmap, x1, y1, x2, y2, color);
-        nnDrawLine(pixmap, x2, y2, x3, y3, color);
-        nnDrawLine(pixmap, x3, y3, x1, y1, color);
+        printf("Failed to bake font at size %g.\n", fontSize);
+        free(bitmap);
+        free(font);
+        return NULL;
     }
+    free(bitmap);
+    font->oversampling = _nnFontOversampling;
+
+    font->nextSize = face->sizes;
+    face->sizes = font;
+    return font;
 }
 
-void nnDrawRect(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf color, bool filled)
+// Creates a face that uses the font data in place. The face releases `fontFile` when it is freed, or right away if loading fails.
+static nnFontFace *_nnCreateFontFace(const unsigned char *fontBuffer, size_t fontBufferSize, nnFileView fontFile, const char *path)
 {
-    if (!pixmap)
-        return;
-
-    if (filled)
+    nnFontFace *face = calloc(1, sizeof(nnFontFace));
+    if (!face)
     {
-        for (int i = 0; i < height; i++)
-        {
-            for (int j = 0; j < width; j++)
-            {
-                nnDrawPixel(pixmap, x + j, y + i, color);
-            }
-        }
+        printf("Failed to allocate memory for font.\n");
+        _nnUnmapFile(&fontFile);
+        return NULL;
     }
-    else
+
+    face->fontBuffer = (unsigned char *)fontBuffer;
+    face->fontBufferSize = fontBufferSize;
+    face->fontFile = fontFile;
+
+    // Initialize font info
+    if (!stbtt_InitFont(&face->fontInfo, face->fontBuffer, 0))
     {
-        nnDrawLine(pixmap, x, y, x + width, y, color);                   // Top
-        nnDrawLine(pixmap, x, y + height, x + width, y + height, color); // Bottom
-        nnDrawLine(pixmap, x, y, x, y + height, color);                  // Left
-        nnDrawLine(pixmap, x + width, y, x + width, y + height, color);  // Right
+        printf("Failed to initialize font.\n");
+        _nnUnmapFile(&face->fontFile);
+        free(face);
+        return NULL;
     }
-}
 
-nnColorf nnReadPixel(nnPixmap *pixmap, int x, int y)
-{
-    if (!pixmap || x < 0 || y < 0 || x >= pixmap->width || y >= pixmap->height)
+    if (path)
     {
-        return (nnColorf){0, 0, 0, 0}; // Return transparent color for out-of-bounds or invalid pixmap
+        face->path = malloc(strlen(path) + 1);
+        if (face->path)
+            strcpy(face->path, path);
     }
 
-    return pixmap->pixels[y * pixmap->width + x];
+    face->next = _nnFontFaces;
+    _nnFontFaces = face;
+    return face;
 }
 
-/*
- * Text Rendering
- */
+// Frees a size that is no longer in the size list of its face
+static void _nnFreeFontSize(nnFont *font)
+{
+    if (_nnstate.font == font)
+        _nnstate.font = NULL;
+    _nnAtlasRelease(font->atlasPage);
+    free(font->glyphs);
+    free(font);
+}
 
-nnFont *nnLoadFont(const char *filepath, float fontSize)
+// Frees a face with all of its sizes
+static void _nnFreeFontFace(nnFontFace *face)
 {
-    FILE *file = fopen(filepath, "rb");
-    if (!file)
+    for (nnFontFace **link = &_nnFontFaces; *link; link = &(*link)->next)
     {
-        printf("Failed to open font file: %s\n", filepath);
-        return NULL;
+        if (*link == face)
+        {
+            *link = face->next;
+            break;
+        }
     }
 
-    fseek(file, 0, SEEK_END);
-    size_t size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    unsigned char *buffer = malloc(size);
-    if (!buffer)
+    nnFont *font = face->sizes;
+    while (font)
     {
-        printf("Failed to allocate memory for font file: %s\n", filepath);
-        fclose(file);
-        return NULL;
+        nnFont *next = font->nextSize;
+        _nnFreeFontSize(font);
+        font = next;
     }
 
-    fread(buffer, 1, size, file);
-    fclose(file);
+    if (face->sdfGlyphs)
+    {
+        free(face->sdfGlyphs->glyphs);
+        free(face->sdfGlyphs);
+    }
 
-    nnFont *font = _nnLoadFont(buffer, size, fontSize);
-    free(buffer);
-    return font;
+    free(face->kerning);
+    free(face->kernPairs);
+    _nnUnmapFile(&face->fontFile);
+    free(face->path);
+    free(face);
 }
 
-nnFont *nnLoadFontMem(const unsigned char *data, size_t dataSize, float fontSize)
+// Takes a reference to a size and its face
+static void _nnRetainFont(nnFont *font)
 {
-    return _nnLoadFont(data, dataSize, fontSize);
+    font->refCount++;
+    font->face->refCount++;
 }
 
-void nnSetFont(nnFont *font)
+// Returns a size of a face and takes a reference to it, freeing the face if the size can not be created
+static nnFont *_nnLoadFaceSize(nnFontFace *face, float fontSize, bool sdf)
 {
+    nnFont *font = _nnGetFaceSize(face, fontSize, sdf);
     if (!font)
-        return;
+    {
+        if (face->refCount == 0)
+            _nnFreeFontFace(face);
+        return NULL;
+    }
 
-    _nnstate.font = font;
+    if (_nnFontKerning)
+        _nnLoadFaceKerning(face);
+
+    _nnRetainFont(font);
+    return font;
 }
 
-nnFont *nnGetFont()
+// Creates the default font from the embedded Roboto and its atlas baked by tools/bakefont.c, so nothing is rasterized at runtime
+static nnFont *_nnLoadDefaultFont()
 {
-    if (!_nnstate.font)
+    nnFontFace *face = NULL;
+    for (face = _nnFontFaces; face; face = face->next)
+    {
+        if (face->fontBuffer == _nnRoboto_Regular_ttf_arr)
+            break;
+    }
+    if (!face)
+        face = _nnCreateFontFace(_nnRoboto_Regular_ttf_arr, _nnRoboto_Regular_ttf_arr_len, (nnFileView){0}, NULL);
+    if (!face)
         return NULL;
 
-    return _nnstate.font;
-}
+    nnFont *font = NULL;
+    for (font = face->sizes; font; font = font->nextSize)
+    {
+        if (font->size == _NN_DEFAULT_FONT_SIZE && !font->sdf)
+            break;
+    }
 
-void nnDrawText(const char *format, int x, int y, ...)
-{
-    if (!format)
-        return;
+    if (!font)
+    {
+        font = _nnCreateFontSize(face, _NN_DEFAULT_FONT_SIZE);
+        if (font && !_nnAddFontBlock(font, _nnDefaultFontAtlas, _NN_DEFAULT_FONT_ATLAS_WIDTH, _NN_DEFAULT_FONT_ATLAS_HEIGHT, _nnDefaultFontCharData))
+        {
+            free(font);
+            font = NULL;
+        }
+        if (!font)
+        {
+            if (face->refCount == 0)
+                _nnFreeFontFace(face);
+            return NULL;
+        }
 
-    va_list args;
-    va_start(args, y);
-    _nnDrawTextVA(format, x, y, 0.0f, args);
-    va_end(args);
-}
+        font->nextSize = face->sizes;
+        face->sizes = font;
+    }
 
-void nnDrawTextZ(const char *format, int x, int y, float zIndex, ...)
-{
-    if (!format)
-        return;
+    if (_nnFontKerning)
+        _nnLoadFaceKerning(face);
 
-    va_list args;
-    va_start(args, zIndex);
-    _nnDrawTextVA(format, x, y, zIndex, args);
-    va_end(args);
+    _nnRetainFont(font);
+    return font;
 }
 
-void nnDrawDebugText(const char *format, int x, int y, ...)
-{
-    if (!_nnstate.debugMode)
-        return;
-
-    if (!format)
-        return;
+// Receives the quad of a glyph laid out by _nnLayoutGlyphs. `shelf` is the shelf of a glyph rasterized on demand, -1 for baked glyphs.
+typedef void (*_nnGlyphQuadFunc)(void *userData, nnFont *font, int page, int shelf, const stbtt_aligned_quad *quad);
 
-    char buffer[1024];
-    va_list args;
-    va_start(args, y);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
+// Lays out `length` bytes of UTF-8 text and passes the quad of every visible glyph on. Returns the advance of the text.
+// Unkerned text keeps the positions of layouts built from glyph advances.
+static float _nnLayoutGlyphs(nnFont *font, const char *text, size_t length, int x, int y, bool kerning, _nnGlyphQuadFunc glyphQuad, void *userData)
+{
+    float cursorX = (float)x;
+    float cursorY = (float)(y + font->glyphHeight); // Adjust for font height
 
-    glRasterPos2i(x, y);
+    // SDF sizes draw the glyphs the face generated at _NN_SDF_FONT_SIZE, scaled to their size
+    nnFont *glyphFont = font->sdf ? font->face->sdfGlyphs : font;
+    float sdfScale = font->scale / glyphFont->scale;
 
-    for (char *c = buffer; *c != '\0'; c++)
+    const char *end = text + length;
+    int previous = 0;
+    for (const char *c = text; c < end;)
     {
-        glutBitmapCharacter(GLUT_BITMAP_9_BY_15, *c);
-    }
-}
+        int codepoint = _nnDecodeUTF8(&c, end);
+        if (codepoint < 32)
+        {
+            previous = 0;
+            continue;
+        }
 
-float nnTextWidth(const char *format, ...)
-{
-    if (!format)
-    {
-        return 0.0f; // Return 0 for null text
-    }
+        if (kerning)
+            cursorX += _nnKernAdvance(font, previous, codepoint);
+        previous = codepoint;
 
-    char buffer[1024];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
+        const stbtt_packedchar *glyphData;
+        int pageIndex;
+        int shelf = -1;
+        int alignToPixels = 1; // Oversampled glyphs are placed at subpixel positions
+        if (codepoint < 128 && !font->sdf)
+        {
+            glyphData = &font->charData[codepoint - 32];
+            pageIndex = font->atlasPage;
+            alignToPixels = font->oversampling == 1;
+        }
+        else
+        {
+            // Glyphs outside ASCII live on glyph pages, the batch is drawn whenever the page changes
+            struct _nnGlyph *glyph = _nnGetGlyph(glyphFont, codepoint);
+            if (!glyph)
+                continue;
 
-    nnFont *font = nnGetFont();
-    if (!font)
-    {
-        printf("No font set. Returning default text width as 0.\n");
-        return 0.0f;
-    }
+            if (glyph->page < 0)
+            {
+                cursorX += _nnCodepointAdvance(font, codepoint);
+                continue;
+            }
 
-    float width = 0.0f;
-    for (const char *c = buffer; *c != '\0'; c++)
-    {
-        if (*c < 32 || *c >= 128)
-        {
-            continue; // Skip non-ASCII characters
+            glyphData = &glyph->quad;
+            pageIndex = glyph->page;
+            shelf = glyph->shelf;
         }
 
-        int advanceWidth, leftSideBearing;
-        stbtt_GetCodepointHMetrics(&font->fontInfo, *c, &advanceWidth, &leftSideBearing);
+        _nnAtlasPage *page = &_nnAtlasPages[pageIndex];
+        stbtt_aligned_quad quad;
+        if (font->sdf)
+        {
+            quad.x0 = cursorX + glyphData->xoff * sdfScale;
+            quad.y0 = cursorY + glyphData->yoff * sdfScale;
+            quad.x1 = quad.x0 + (glyphData->x1 - glyphData->x0) * sdfScale;
+            quad.y1 = quad.y0 + (glyphData->y1 - glyphData->y0) * sdfScale;
+            quad.s0 = glyphData->x0 / (float)page->width;
+            quad.t0 = glyphData->y0 / (float)page->height;
+            quad.s1 = glyphData->x1 / (float)page->width;
+            quad.t1 = glyphData->y1 / (float)page->height;
+            cursorX += _nnCodepointAdvance(font, codepoint);
+        }
+        else
+        {
+            stbtt_GetPackedQuad(glyphData, page->width, page->height, 0, &cursorX, &cursorY, &quad, alignToPixels);
+        }
 
-        // Add the scaled advanceWidth to the total width
-        width += font->scale * advanceWidth;
+        glyphQuad(userData, font, pageIndex, shelf, &quad);
     }
 
-    return width;
+    return cursorX - x;
 }
 
-float nnTextHeight()
+// Color and z-index of glyphs queued by _nnBatchGlyphQuad
+typedef struct
 {
-    nnFont *font = nnGetFont();
-    if (!font)
-    {
-        printf("No font set. Returning default glyph height as 0.\n");
-        return 0.0f;
-    }
-    return font->glyphHeight;
+    float color[4];
+    float zIndex;
+} _nnGlyphBatchArgs;
+
+// Queues a glyph quad in the batch
+static void _nnBatchGlyphQuad(void *userData, nnFont *font, int page, int shelf, const stbtt_aligned_quad *quad)
+{
+    (void)shelf;
+    _nnGlyphBatchArgs *args = userData;
+    _nnBatchQuad(_nnAtlasPages[page].textureID, font->sdf, quad->x0, quad->y0, quad->x1, quad->y1, quad->s0, quad->t0, quad->s1, quad->t1, args->zIndex, args->color);
 }
 
-void nnFreeFont(nnFont *font)
+// Draws `length` bytes of UTF-8 text, without formatting. Unkerned text keeps the positions of layouts built from glyph advances.
+static void _nnDrawGlyphs(const char *text, size_t length, int x, int y, float zIndex, bool kerning)
 {
+    nnFont *font = nnGetFont();
     if (!font)
         return;
 
-    if (font->fontBuffer)
-        free(font->fontBuffer);
+    // Glyphs are queued in the batch with the current color, so they can join the quads of the gui element drawing the text
+    _nnGlyphBatchArgs args;
+    glGetFloatv(GL_CURRENT_COLOR, args.color);
+    args.zIndex = zIndex;
 
-    glDeleteTextures(1, &font->textureID);
-    free(font);
+    _nnBeginBatchedDraw();
+    _nnLayoutGlyphs(font, text, length, x, y, kerning, _nnBatchGlyphQuad, &args);
+    _nnEndBatchedDraw();
 }
 
-/*
- * Collision Handling
- */
-
-bool nnPosRecOverlaps(int x, int y, nnRecf rec)
+// Draws `length` bytes of UTF-8 text, without formatting
+static void _nnDrawTextN(const char *text, size_t length, int x, int y, float zIndex)
 {
-    return (x >= rec.x && x <= rec.x + rec.width && y >= rec.y && y <= rec.y + rec.height) ? true : false;
+    _nnDrawGlyphs(text, length, x, y, zIndex, true);
 }
 
-bool nnRecsOverlap(nnRecf rec1, nnRecf rec2)
+// A glyph quad of a text object and its page
+typedef struct
 {
-    return (rec1.x < rec2.x + rec2.width && rec1.x + rec1.width > rec2.x && rec1.y < rec2.y + rec2.height && rec1.y + rec1.height > rec2.y) ? true : false;
-}
+    int page;
+    stbtt_aligned_quad quad;
+} _nnTextQuad;
 
-bool nnPosCircleOverlaps(int x, int y, int cx, int cy, float circleRadius)
+// Quads and glyph shelves collected while a text object is laid out. A glyph takes at least one byte, so `length` entries always suffice.
+typedef struct
 {
-    float dx = x - cx;
-    float dy = y - cy;
-    return (dx * dx + dy * dy <= circleRadius * circleRadius) ? true : false;
-}
-
-bool nnRecCircleOverlaps(nnRecf rec, int cx, int cy, float circleRadius)
+    _nnTextQuad *quads;
+    int quadCount;
+    _nnTextShelf *shelves;
+    int shelfCount;
+} _nnTextLayout;
+
+// Collects a glyph quad of a text object
+static void _nnCollectGlyphQuad(void *userData, nnFont *font, int page, int shelf, const stbtt_aligned_quad *quad)
 {
-    // Find the closest point on the rectangle to the circle center
-    float closestX = (cx < rec.x) ? rec.x : (cx > rec.x + rec.width) ? rec.x + rec.width
-                                                                     : cx;
-    float closestY = (cy < rec.y) ? rec.y : (cy > rec.y + rec.height) ? rec.y + rec.height
-                                                                      : cy;
-
-    // Calculate the distance between the circle center and this closest point
-    float dx = cx - closestX;
-    float dy = cy - closestY;
-
-    return (dx * dx + dy * dy <= circleRadius * circleRadius) ? true : false;
-}
+    (void)font;
+    _nnTextLayout *layout = userData;
+    layout->quads[layout->quadCount++] = (_nnTextQuad){page, *quad};
+    if (shelf < 0)
+        return;
 
-bool nnCirclesOverlaps(int cx1, int cy1, float circle1Radius, int cx2, int cy2, float circle2Radius)
-{
-    float dx = cx1 - cx2;
-    float dy = cy1 - cy2;
-    float distanceSquared = dx * dx + dy * dy;
-    float radiusSum = circle1Radius + circle2Radius;
-    return (distanceSquared <= radiusSum * radiusSum) ? true : false;
+    for (int i = 0; i < layout->shelfCount; i++)
+    {
+        if (layout->shelves[i].page == page && layout->shelves[i].shelf == shelf)
+            return;
+    }
+    layout->shelves[layout->shelfCount++] = (_nnTextShelf){page, shelf};
 }
 
-/*
- * Input Handling
- */
-//// Keyboard Input
-bool nnKeyHit(int key)
+// Lays out the quads of a text object at the origin, grouped by atlas page, and uploads them into its vertex buffer
+static bool _nnLayoutTextObject(nnText *text)
 {
-    if (key < _NN_MAX_KEYS) // Normal key
+    size_t capacity = text->length ? text->length : 1;
+    _nnTextLayout layout = {malloc(capacity * sizeof(_nnTextQuad)), 0, malloc(capacity * sizeof(_nnTextShelf)), 0};
+    if (!layout.quads || !layout.shelves)
     {
-        return _nnstate.keysPressed[key];
+        printf("Failed to allocate memory for text layout.\n");
+        free(layout.quads);
+        free(layout.shelves);
+        return false;
     }
-    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+
+    // Rasterizing glyphs of the text can grow or evict atlas pages and move glyphs laid out before, the second pass finds them in place.
+    // If the atlas still changes, the generation is left behind and the text is laid out again when it is drawn.
+    for (int pass = 0; pass < 2; pass++)
     {
-        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
-        return _nnstate.skeysPressed[specialKey];
+        text->atlasGeneration = _nnAtlasGeneration;
+        layout.quadCount = 0;
+        layout.shelfCount = 0;
+        text->width = _nnLayoutGlyphs(text->font, text->text, text->length, 0, 0, true, _nnCollectGlyphQuad, &layout);
+        if (text->atlasGeneration == _nnAtlasGeneration)
+            break;
     }
-    return false; // Invalid key
-}
 
-bool nnKeyDown(int key)
-{
-    if (key < _NN_MAX_KEYS) // Normal key
+    _nnTextVertex *vertices = malloc((size_t)(layout.quadCount ? layout.quadCount : 1) * 4 * sizeof(_nnTextVertex));
+    if (!vertices)
     {
-        return _nnstate.keys[key];
+        printf("Failed to allocate memory for text layout.\n");
+        free(layout.quads);
+        free(layout.shelves);
+        return false;
     }
-    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+
+    // Each page gets one run, its quads are drawn with one call
+    text->runCount = 0;
+    text->vertexCount = 0;
+    for (int i = 0; i < layout.quadCount; i++)
     {
-        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
-        return _nnstate.skeys[specialKey];
+        int page = layout.quads[i].page;
+        bool grouped = false;
+        for (int j = 0; j < text->runCount && !grouped; j++)
+            grouped = text->runs[j].page == page;
+        if (grouped)
+            continue;
+
+        _nnTextRun *run = &text->runs[text->runCount++];
+        run->page = page;
+        run->first = text->vertexCount;
+        for (int j = i; j < layout.quadCount; j++)
+        {
+            if (layout.quads[j].page != page)
+                continue;
+
+            const stbtt_aligned_quad *q = &layout.quads[j].quad;
+            _nnTextVertex *vertex = &vertices[text->vertexCount];
+            vertex[0] = (_nnTextVertex){q->x0, q->y1, q->s0, q->t1};
+            vertex[1] = (_nnTextVertex){q->x1, q->y1, q->s1, q->t1};
+            vertex[2] = (_nnTextVertex){q->x1, q->y0, q->s1, q->t0};
+            vertex[3] = (_nnTextVertex){q->x0, q->y0, q->s0, q->t0};
+            text->vertexCount += 4;
+        }
+        run->count = text->vertexCount - run->first;
     }
-    return false; // Invalid key
-}
 
-bool nnKeyReleased(int key)
-{
-    if (key < _NN_MAX_KEYS) // Normal key
+    free(layout.quads);
+    free(text->shelves);
+    text->shelves = layout.shelves;
+    text->shelfCount = layout.shelfCount;
+
+    free(text->vertices);
+    text->vertices = NULL;
+    if (_nnLoadBufferFuncs())
     {
-        return _nnstate.keysReleased[key];
+        if (!text->buffer)
+            _nnGenBuffers(1, &text->buffer);
+        _nnBindBuffer(GL_ARRAY_BUFFER, text->buffer);
+        _nnBufferData(GL_ARRAY_BUFFER, (ptrdiff_t)text->vertexCount * sizeof(_nnTextVertex), vertices, GL_STATIC_DRAW);
+        _nnBindBuffer(GL_ARRAY_BUFFER, 0);
+        free(vertices);
     }
-    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+    else
     {
-        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
-        return _nnstate.skeysReleased[specialKey];
+        text->vertices = vertices;
     }
-    return false; // Invalid key
-}
-
-//// Mouse Input
 
-bool nnMouseHit(int button)
-{
-    bool wasPressed = _nnstate.mouseButtonsPressed[button];
-    return wasPressed;
+    return true;
 }
 
-bool nnMouseDown(int button)
+// Formats the text once and draws it
+static void _nnDrawTextVA(const char *format, int x, int y, float zIndex, va_list args)
 {
-    return _nnstate.mouseButtons[button];
-}
+    if (!format)
+        return;
 
-bool nnMouseReleased(int button)
-{
-    bool wasReleased = _nnstate.mouseButtonsReleased[button];
-    return wasReleased;
-}
+    char buffer[1024];
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    if (length < 0)
+        return;
 
-int nnMouseWheelDelta()
-{
-    int delta = _nnstate.mouseWheelDelta;
-    return delta;
+    _nnDrawTextN(buffer, length < (int)sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1, x, y, zIndex);
 }
 
-nnPos nnMousePosition()
+// Draws a zero terminated string as is, so '%' in gui element texts is not taken as a format specifier
+static void _nnDrawString(const char *text, int x, int y, float zIndex)
 {
-    return _nnstate.mousePosition;
+    _nnDrawTextN(text, strlen(text), x, y, zIndex);
 }
 
-nnPos nnMouseMotionDelta()
+// Width of a zero terminated string as is
+static float _nnStringWidth(const char *text)
 {
-    nnPos delta = _nnstate.mouseMotionDelta;
-    return delta;
+    return nnTextWidthN(text, strlen(text));
 }
 
-void nnFlushKeys()
-{
-    for (int key = 0; key < _NN_MAX_KEYS; key++)
-    {
-        _nnstate.keysPressed[key] = false;
-        _nnstate.keysReleased[key] = false;
-        _nnstate.skeysPressed[key] = false;
-        _nnstate.skeysReleased[key] = false;
-    }
-}
+// static const char *_nnFetchTextInput()
+// {
+//     static char typedText[1024];
+//     int index = 0;
 
-void nnFlushMouse()
-{
-    for (int button = 0; button < _NN_MAX_MOUSE_BUTTONS; button++)
-    {
-        _nnstate.mouseButtonsPressed[button] = false;
-        _nnstate.mouseButtonsReleased[button] = false;
-    }
-}
+//     // Clear the buffer before starting
+//     typedText[0] = '\0';
 
-/*
- * Utility
- */
+//     // Iterate over printable ASCII characters (32-126)
+//     for (int key = 32; key <= 126; key++)
+//     {
+//         bool pressed = _nnstate.keysPressed[key];
+//         if (pressed) // Check if the key is pressed
+//         {
+//             typedText[index++] = (char)key; // Add the character to the buffer
+//         }
+//     }
 
-unsigned char *nnLoadFileBytes(const char *filepath, int *size)
-{
-    FILE *file = fopen(filepath, "rb");
-    if (!file)
-    {
-        printf("Failed to open file:\n%s\n", filepath);
-        return NULL;
-    }
+//     // Handle backspace
+//     // if (nnKeyHit(8)) // Backspace key code
+//     // {
+//     //     typedText[index++] = '\b'; // Add backspace marker
+//     // }
 
-    fseek(file, 0, SEEK_END);
-    *size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    unsigned char *buffer = (unsigned char *)malloc(*size);
-    if (!buffer)
-    {
-        printf("Failed to allocate memory for file: %s\n", filepath);
-        fclose(file);
-        return NULL;
-    }
+//     // Handle enter (if needed for a text input)
+//     // if (nnKeyHit(13)) // Enter key code
+//     // {
+//     //     typedText[index++] = '\n'; // Add newline marker
+//     // }
 
-    fread(buffer, 1, *size, file);
-    fclose(file);
+//     // Null-terminate the string
+//     typedText[index] = '\0';
 
-    return buffer;
-}
+//     return typedText;
+// }
 
-void nnFreeFileBytes(unsigned char *buffer)
+static const char *_nnFetchTextInput()
 {
-    if (buffer)
+    static char typedText[1024];
+    int index = 0;
+
+    // Clear the buffer before starting
+    typedText[0] = '\0';
+
+    // Iterate over printable ASCII characters (32-126)
+    for (int key = 32; key <= 126; key++)
     {
-        free(buffer);
+        if (_nnstate.keysPressed[key]) // Check only normal keys
+        {
+            typedText[index++] = (char)key; // Add the character to the buffer
+        }
     }
+
+    // Null-terminate the string
+    typedText[index] = '\0';
+
+    return typedText;
 }
 
-float nnLerp(float min, float max, float speed, float ease)
+// Copies `text` into `out`, truncated with "..." if it is wider than `maxWidth` in the current font.
+// Every character is measured only once.
+static void _nnTruncateText(const char *text, float maxWidth, char *out, int outSize)
 {
-    // Static variables to maintain state between calls
-    static float currentValue = 0.0f;
-    static float direction = 1.0f; // 1.0f for increasing, -1.0f for decreasing
-
-    // Initialize currentValue on the first call
-    if (currentValue == 0.0f)
+    nnFont *font = nnGetFont();
+    int length = strlen(text);
+    if (!font || outSize < 4)
     {
-        currentValue = min;
+        snprintf(out, outSize, "%s", text);
+        return;
     }
 
-    // Calculate the change per frame
-    float delta = speed * direction;
-
-    // Update the current value
-    currentValue += delta;
+    float ellipsisWidth = nnTextWidthN("...", 3);
 
-    // Check bounds and reverse direction if necessary
-    if (currentValue > max)
+    float width = 0.0f;
+    int fitLength = 0; // Number of bytes that still fit in front of the ellipsis
+    int previous = 0;
+    const char *c = text;
+    while (*c)
     {
-        currentValue = max;
-        direction = -1.0f;
-        currentValue -= delta * ease; // Smooth transition when changing direction
+        const char *next = c;
+        int codepoint = _nnDecodeUTF8(&next, NULL);
+        if (codepoint >= 32)
+            width += _nnKernAdvance(font, previous, codepoint) + _nnCodepointAdvance(font, codepoint);
+        previous = codepoint;
+        if (width > maxWidth || next - text > outSize - 1)
+            break;
+        if (width + ellipsisWidth <= maxWidth && next - text <= outSize - 4)
+            fitLength = (int)(next - text);
+        c = next;
     }
-    else if (currentValue < min)
+
+    if (*c == '\0')
     {
-        currentValue = min;
-        direction = 1.0f;
-        currentValue += delta * 0.5f; // Smooth transition when changing direction
+        memcpy(out, text, length + 1);
+        return;
     }
 
-    return currentValue;
+    memcpy(out, text, fitLength);
+    memcpy(out + fitLength, "...", 4);
 }
 
-void nnSetDebugMode(bool flag)
-{
-    _nnstate.debugMode = flag;
-}
+/*******************************************************************************************************/
+/*******************************************************************************************************/
 
-bool nnIsDebugMode()
-{
-    return _nnstate.debugMode;
-}
+// Public Interface implementations
+
+/*******************************************************************************************************/
+/*******************************************************************************************************/
 
 /*
- * GUI
+ * Window Management
  */
-
-bool nnPanel(int x, int y, int width, int height)
+bool nnCreateWindow(char *title, int width, int height, bool virtual, bool filtered)
 {
-    // Define the background and border colors
-    nnColorf bgColor = _nnCurrentTheme.secondaryColor;  // Background color
-    nnColorf borderColor = _nnCurrentTheme.borderColor; // Border color
-
-    nnPos mousePos = nnMousePosition();
-    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
-
-    // Enable blending for transparency
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    // Draw the background
-    glBegin(GL_QUADS);
-    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-
-    // Draw the border
-    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-
-    // Disable blending
-    glDisable(GL_BLEND);
-
-    return hovered;
-}
+    _nnstate.displayCallback = NULL;
 
-void nnLabel(const char *format, int x, int y, int width, int height, bool border, ...)
-{
-    if (!format)
-        return;
+    _nnstate.virtual = virtual;
+    _nnstate.filtered = filtered;
 
-    // Format the text
-    char buffer[1024];
-    va_list args;
-    va_start(args, border);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
+    _nnstate.title = title;
+    _nnstate.initialWidth = width;
+    _nnstate.initialHeight = height;
+    _nnstate.windowWidth = width;
+    _nnstate.windowHeight = height;
+    _nnstate.windowScaleX = 1.0f;
+    _nnstate.windowScaleY = 1.0f;
 
-    // Prepare to draw
-    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
-    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    _nnstate.deltaTime = 0.0f;
+    _nnstate.lastTime = glutGet(GLUT_ELAPSED_TIME) / 1000.0;
+    _nnstate.currentFPS = 0;
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _nnstate.isAnyPopupOpen = false;
+    _nnstate.anyKeyEvent = false;
+    _nnstate.frameCount = 0;
 
-    // Draw background and border if enabled
-    if (border)
+    // Set default FPS if not already set
+    if (_nnstate.targetFPS <= 0)
     {
-        // Draw background
-        glBegin(GL_QUADS);
-        glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-        glVertex2f(x, y);
-        glVertex2f(x + width, y);
-        glVertex2f(x + width, y + height);
-        glVertex2f(x, y + height);
-        glEnd();
-
-        // Draw border
-        glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-        glBegin(GL_LINE_LOOP);
-        glVertex2f(x, y);
-        glVertex2f(x + width, y);
-        glVertex2f(x + width, y + height);
-        glVertex2f(x, y + height);
-        glEnd();
+        _nnstate.targetFPS = 60;
     }
 
-    // Split text into words for wrapping
-    const char *current = buffer;
-    char line[256];
-    int lineHeight = nnTextHeight() + 12;
-    int padding = 8;
-    int maxLines = (height - padding) / lineHeight;
-
-    int currentY = y;
-    int linesDrawn = 0;
+    nnFPS = 0;
+    nnDT = 0.0f;
+    nnMS = 0.0f;
 
-    while (*current != '\0' && linesDrawn < maxLines)
-    {
-        // Accumulate words into a line
-        int lastBreak = 0;
-        bool isLastLine = (linesDrawn == maxLines - 1);
-        bool truncated = false;
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
-        for (int i = 0; current[i] != '\0'; i++)
-        {
-            line[i] = current[i];
-            line[i + 1] = '\0';
+    int argc = 1;
+    char *argv[1] = {(char *)"Something"};
+    glutInit(&argc, argv);
+    glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE);
+    glutInitWindowSize(width, height);
+    _nnstate.window = glutCreateWindow(title);
 
-            // Break line on spaces or forced newlines
-            if (current[i] == ' ' || current[i] == '\n')
-                lastBreak = i;
+    /* Set the callbacks */
+    glutKeyboardFunc(_nnKeyDownCallback);
+    glutKeyboardUpFunc(_nnKeyUpCallback);
+    glutSpecialFunc(_nnSpecialKeyCallback);
+    glutSpecialUpFunc(_nnSpecialKeyUpCallback);
+    glutMouseFunc(_nnMouseButtonCallback);
+    glutMouseWheelFunc(_nnMouseWheelFunc);
+    glutMotionFunc(_nnMouseMotionFunc);
+    glutPassiveMotionFunc(_nnMouseMotionFunc);
+    glutReshapeFunc(_nnFramebufferSizeCallback);
 
-            // If the line is too wide, break it
-            if (nnTextWidth(line) > width - padding) // Account for padding
-            {
-                if (lastBreak == 0) // No break point, force truncation
-                {
-                    line[i] = '\0';
-                    current += i;
-                }
-                else // Break at the last space or newline
-                {
-                    line[lastBreak] = '\0';
-                    current += lastBreak + 1;
-                }
-                break;
-            }
+    /* Set up the orthographic projection */
+    _nnSetupOrthoProjection(_nnstate.windowWidth, _nnstate.windowHeight);
+    _nnUpdateScale(_nnstate.windowWidth, _nnstate.windowHeight, _nnstate.virtual);
 
-            // Handle end of text
-            if (current[i + 1] == '\0')
-            {
-                current += i + 1;
-                break;
-            }
-        }
+    /* Set initial scale */
+    _nnSetScale(_nnstate.windowScaleX, _nnstate.windowScaleY);
 
-        // If this is the last line and there's more text, truncate it and add "..."
-        if (isLastLine && *current != '\0')
-        {
-            truncated = true;
-            int len = strlen(line);
-            while (len > 0 && nnTextWidth(line) + nnTextWidth("...") > width - padding)
-            {
-                line[--len] = '\0';
-            }
-            strcat(line, "...");
-        }
+    /* Start the timer for limiting FPS */
+    glutTimerFunc(1000 / _nnstate.targetFPS, _nnTimerCallback, 0);
 
-        // Draw the line
-        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-        nnDrawText(line, x + padding, currentY + padding); // Add slight padding
-        currentY += lineHeight;
-        linesDrawn++;
+    nnResetColor();
 
-        // Stop drawing if truncated
-        if (truncated)
-            break;
-    }
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
 
-    glDisable(GL_BLEND);
+    return true;
 }
 
-int nnTextInput(char *buffer, int maxLength, int x, int y, int width, int height, const char *placeholder)
+void nnSetRenderFunc(void (*callback)(void))
 {
-    // Generate a unique ID based on position
-    unsigned int id = _nnGenUID(x, y);
+    _nnstate.displayCallback = callback;
+    glutDisplayFunc(_nnDisplayCallbackWrapper);
+}
 
-    // Find or initialize state
-    _nnTextInputState *state = NULL;
-    for (int i = 0; i < _nnTextInputStateCount; i++)
+void nnDestroyWindow()
+{
+    _nnStopImageWorkers();
+    nnFreeFont(_nnstate.defaultFont);
+    _nnstate.defaultFont = NULL;
+    if (_nnDebugFontTexture)
     {
-        if (_nnTextInputStates[i].id == id)
-        {
-            state = &_nnTextInputStates[i];
-            break;
-        }
+        glDeleteTextures(1, &_nnDebugFontTexture);
+        _nnDebugFontTexture = 0;
     }
-    if (!state)
+    glDisable(GL_DEPTH_TEST);
+    glutDestroyWindow(_nnstate.window);
+}
+
+void nnSetTargetFPS(int fps)
+{
+    if (fps <= 0)
     {
-        if (_nnTextInputStateCount >= _NN_MAX_TEXTINPUT_STATES)
-        {
-            printf("Error: Too many text inputs! Increase _NN_MAX_TEXTINPUT_STATES.\n");
-            return -1;
+        printf("Invalid FPS value. FPS must be greater than 0.\n");
+        return;
+    }
+    _nnstate.targetFPS = fps;
+}
+
+void nnSetWindowTitle(const char *format, ...)
+{
+    char buffer[256] = {0};
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    glutSetWindowTitle(buffer);
+}
+
+void nnSetClearColor(nnColorf color)
+{
+    glClearColor(color.r, color.g, color.b, color.a);
+}
+
+void nnSetColor(nnColorf color)
+{
+    _nnstate.currentDrawColor = color;
+    glColor4f(color.r, color.g, color.b, color.a);
+}
+
+nnColorf nnGetColor()
+{
+    return _nnstate.currentDrawColor;
+}
+
+void nnResetColor()
+{
+    _nnstate.currentDrawColor = (nnColorf){1.0f, 1.0f, 1.0f, 1.0f};
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+void nnRun()
+{
+    if (_nnstate.displayCallback == NULL)
+    {
+        printf("DisplayCallback not set, shutting down...");
+        exit(-1);
+    }
+    glutMainLoop();
+}
+
+int nnWindowWidth()
+{
+    return _nnstate.windowWidth;
+}
+
+int nnWindowHeight()
+{
+    return _nnstate.windowHeight;
+}
+
+int nnScreenWidth()
+{
+    if (_nnstate.virtual)
+    {
+        return _nnstate.initialWidth;
+    }
+    return _nnstate.windowWidth;
+}
+
+int nnScreenHeight()
+{
+    if (_nnstate.virtual)
+    {
+        return _nnstate.initialHeight;
+    }
+    return _nnstate.windowHeight;
+}
+
+/*
+ * Image Loading and Drawing
+ */
+
+// Creates an image from encoded image or .nntex data, without printing errors.
+static nnImage _nnLoadImageData(const unsigned char *data, size_t size)
+{
+    nnImage image;
+    image.isFlippedX = false;
+    image.isFlippedY = false;
+    image.scaleX = 1.0f;
+    image.scaleY = 1.0f;
+    image.angle = 0.0f;
+    image.textureID = 0;
+
+    // .nntex data is handed to the GPU without decoding
+    _nnTexInfo tex;
+    if (_nnParseTex(data, size, &tex))
+    {
+        image.textureID = _nnCreateTexTexture(&tex);
+        image.width = tex.width;
+        image.height = tex.height;
+        return image;
+    }
+
+    if (size > 0x7fffffff)
+        return image;
+
+    // stbi_set_flip_vertically_on_load(1);
+    unsigned char *imageData = stbi_load_from_memory(data, (int)size, &image.width, &image.height, 0, 4);
+    if (!imageData)
+        return image;
+
+    image.textureID = _nnCreateImageTexture(imageData, image.width, image.height);
+
+    stbi_image_free(imageData);
+
+    return image;
+}
+
+nnImage nnLoadImage(const char *filepath)
+{
+    // The file is mapped and decoded in place instead of being read into a buffer first
+    nnFileView view;
+    nnImage image = {0};
+    if (_nnMapFile(filepath, &view))
+    {
+        image = _nnLoadImageData(view.data, view.size);
+        _nnUnmapFile(&view);
+    }
+
+    if (image.textureID == 0)
+        printf("Failed to load image:\n%s\n", filepath);
+
+    return image;
+}
+
+nnImage nnLoadImageMem(const unsigned char *data, int size)
+{
+    nnImage image = _nnLoadImageData(data, size > 0 ? size : 0);
+    if (image.textureID == 0)
+        printf("Failed to load image from memory\n");
+
+    return image;
+}
+
+void nnDrawImage(nnImage image, int x, int y)
+{
+    _nnFlushBatch();
+
+    if (image.textureID == 0)
+    {
+        printf("Failed to draw image\n");
+        return;
+    }
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, image.textureID);
+
+    // Enable alpha blending
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glPushMatrix();
+
+    // Translate to position
+    glTranslatef(x + image.width / 2.0f, y + image.height / 2.0f, 0);
+
+    // Apply rotation if any
+    if (image.angle != 0.0f)
+    {
+        glRotatef(image.angle, 0, 0, 1);
+    }
+
+    // Apply flipping
+    float flipX = image.isFlippedX ? -1.0f : 1.0f;
+    float flipY = image.isFlippedY ? -1.0f : 1.0f;
+
+    // Apply scaling
+    glScalef(image.scaleX * flipX, image.scaleY * flipY, 1.0f);
+
+    // Render the quad centered at the origin
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 0.0f);
+    glVertex2f(-image.width / 2.0f, -image.height / 2.0f);
+    glTexCoord2f(1.0f, 0.0f);
+    glVertex2f(image.width / 2.0f, -image.height / 2.0f);
+    glTexCoord2f(1.0f, 1.0f);
+    glVertex2f(image.width / 2.0f, image.height / 2.0f);
+    glTexCoord2f(0.0f, 1.0f);
+    glVertex2f(-image.width / 2.0f, image.height / 2.0f);
+    glEnd();
+
+    glPopMatrix();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+}
+
+void nnDrawImagePortion(nnImage image, int x, int y, nnRecf srcRec)
+{
+    _nnFlushBatch();
+
+    if (image.textureID == 0)
+    {
+        printf("Failed to draw image portion\n");
+        return;
+    }
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, image.textureID);
+
+    // Enable alpha blending
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glPushMatrix();
+
+    // Translate to position
+    glTranslatef(x + srcRec.width / 2.0f, y + srcRec.height / 2.0f, 0);
+
+    // Apply rotation if any
+    if (image.angle != 0.0f)
+    {
+        glRotatef(image.angle, 0, 0, 1);
+    }
+
+    // Scale for flipping
+    float scaleX = image.isFlippedX ? -1.0f : 1.0f;
+    float scaleY = image.isFlippedY ? -1.0f : 1.0f;
+    glScalef(scaleX, scaleY, 1.0f);
+
+    // Adjust texture coordinates for the specified portion
+    float texLeft = srcRec.x / image.width;
+    float texRight = (srcRec.x + srcRec.width) / image.width;
+    float texTop = srcRec.y / image.height;
+    float texBottom = (srcRec.y + srcRec.height) / image.height;
+
+    // Render the portion centered at the origin
+    glBegin(GL_QUADS);
+    glTexCoord2f(texLeft, texTop);
+    glVertex2f(-srcRec.width / 2.0f, -srcRec.height / 2.0f);
+    glTexCoord2f(texRight, texTop);
+    glVertex2f(srcRec.width / 2.0f, -srcRec.height / 2.0f);
+    glTexCoord2f(texRight, texBottom);
+    glVertex2f(srcRec.width / 2.0f, srcRec.height / 2.0f);
+    glTexCoord2f(texLeft, texBottom);
+    glVertex2f(-srcRec.width / 2.0f, srcRec.height / 2.0f);
+    glEnd();
+
+    glPopMatrix();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+}
+
+void nnFlipImage(nnImage *image, bool flipX, bool flipY)
+{
+    if (image->textureID == 0)
+    {
+        printf("Failed to flip image\n");
+        return;
+    }
+    if (flipX)
+        image->isFlippedX = !image->isFlippedX;
+
+    if (flipY)
+        image->isFlippedX = !image->isFlippedY;
+}
+
+void nnRotateImage(nnImage *image, float angle)
+{
+    if (image->textureID == 0)
+    {
+        printf("Failed to rotate image\n");
+        return;
+    }
+
+    image->angle = fmod(angle, 360.0f);
+    if (image->angle < 0.0f)
+    {
+        image->angle += 360.0f;
+    }
+}
+
+void nnScaleImage(nnImage *image, float scaleX, float scaleY)
+{
+    if (image->textureID == 0)
+    {
+        printf("Failed to scale image\n");
+        return;
+    }
+
+    image->scaleX = scaleX;
+    image->scaleY = scaleY;
+}
+
+void nnFreeImage(nnImage image)
+{
+    if (!image.textureID == 0)
+        return;
+
+    glDeleteTextures(1, &image.textureID);
+}
+
+nnAsyncImage *nnLoadImageAsync(const char *filepath)
+{
+    if (!filepath)
+        return NULL;
+
+    if (!_nnStartImageWorkers())
+        return NULL;
+
+    nnAsyncImage *image = calloc(1, sizeof(nnAsyncImage));
+    if (image)
+        image->filepath = malloc(strlen(filepath) + 1);
+    if (!image || !image->filepath)
+    {
+        printf("Failed to allocate memory for image:\n%s\n", filepath);
+        free(image);
+        return NULL;
+    }
+    strcpy(image->filepath, filepath);
+
+    image->status = _NN_ASYNC_IMAGE_LOADING;
+    image->image.scaleX = 1.0f;
+    image->image.scaleY = 1.0f;
+
+    // A new loading phase starts once everything queued before has completed
+    if (_nnAsyncImagesCompleted == _nnAsyncImagesQueued)
+    {
+        _nnAsyncImagesQueued = 0;
+        _nnAsyncImagesCompleted = 0;
+    }
+    _nnAsyncImagesQueued++;
+
+    _nnQueueImageJob(image);
+    return image;
+}
+
+bool nnIsImageLoaded(nnAsyncImage *image)
+{
+    return image && image->status != _NN_ASYNC_IMAGE_LOADING;
+}
+
+nnImage nnGetAsyncImage(nnAsyncImage *image)
+{
+    if (!image)
+    {
+        nnImage empty = {0};
+        return empty;
+    }
+    return image->image;
+}
+
+void nnFreeAsyncImage(nnAsyncImage *image)
+{
+    if (!image)
+        return;
+
+    // Still in the hands of the loader, it gets freed once it arrives on the GL thread
+    if (image->status == _NN_ASYNC_IMAGE_LOADING)
+    {
+        image->freed = true;
+        return;
+    }
+
+    if (image->image.textureID != 0)
+        glDeleteTextures(1, &image->image.textureID);
+    free(image->filepath);
+    free(image);
+}
+
+int nnPrefetchImages(const char *manifestPath, nnAsyncImage **images, int maxImages)
+{
+    FILE *file = fopen(manifestPath, "r");
+    if (!file)
+    {
+        printf("Failed to open manifest:\n%s\n", manifestPath);
+        return -1;
+    }
+
+    int count = 0;
+    char line[1024];
+    while (count < maxImages && fgets(line, sizeof(line), file))
+    {
+        // Trim whitespace and line endings
+        char *path = line;
+        while (isspace((unsigned char)*path))
+            path++;
+        size_t length = strlen(path);
+        while (length > 0 && isspace((unsigned char)path[length - 1]))
+            path[--length] = '\0';
+
+        if (length == 0 || path[0] == '#')
+            continue;
+
+        images[count] = nnLoadImageAsync(path);
+        if (images[count])
+            count++;
+    }
+
+    fclose(file);
+    return count;
+}
+
+float nnImageLoadProgress()
+{
+    if (_nnAsyncImagesQueued == 0)
+        return 1.0f;
+    return (float)_nnAsyncImagesCompleted / _nnAsyncImagesQueued;
+}
+
+void nnSetImageUploadBudget(int bytesPerFrame, int milliseconds)
+{
+    _nnImageUploadBytesPerFrame = bytesPerFrame;
+    _nnImageUploadMilliseconds = milliseconds;
+}
+
+nnImage nnLoadImageCached(const char *filepath)
+{
+    return _nnLoadImageCached(filepath, NULL, 0);
+}
+
+nnImage nnLoadImageMemCached(const unsigned char *data, int size)
+{
+    return _nnLoadImageCached(NULL, data, size);
+}
+
+void nnReleaseImage(nnImage image)
+{
+    for (int i = 0; i < _nnImageCacheCapacity; i++)
+    {
+        _nnImageCacheEntry *entry = &_nnImageCache[i];
+        if (entry->used && entry->image.textureID == image.textureID)
+        {
+            if (entry->refCount > 0)
+                entry->refCount--;
+            entry->lastUsed = ++_nnImageCacheTick;
+            _nnEvictImageCache();
+            return;
+        }
+    }
+    printf("Failed to release image: not loaded through the image cache\n");
+}
+
+void nnSetImageCacheBudget(size_t bytes)
+{
+    _nnImageCacheBudget = bytes;
+    _nnEvictImageCache();
+}
+
+nnImageCacheStats nnImageCacheStatistics()
+{
+    nnImageCacheStats stats = {0};
+    stats.bytesResident = _nnImageCacheBytes;
+    stats.bytesBudget = _nnImageCacheBudget;
+    stats.images = _nnImageCacheCount;
+    for (int i = 0; i < _nnImageCacheCapacity; i++)
+    {
+        if (_nnImageCache[i].used && _nnImageCache[i].refCount > 0)
+            stats.referencedImages++;
+    }
+    stats.hits = _nnImageCacheHits;
+    stats.misses = _nnImageCacheMisses;
+    stats.hitRate = (_nnImageCacheHits + _nnImageCacheMisses) > 0 ? (float)_nnImageCacheHits / (_nnImageCacheHits + _nnImageCacheMisses) : 0.0f;
+    return stats;
+}
+
+/*
+ * Pixmap Management and Drawing
+ */
+
+nnPixmap *nnCreatePixmap(int width, int height)
+{
+    nnPixmap *pixmap = calloc(1, sizeof(nnPixmap));
+    pixmap->isFlippedX = false;
+    pixmap->isFlippedY = false;
+    pixmap->scaleX = 1.0f;
+    pixmap->scaleY = 1.0f;
+    pixmap->angle = 0.0f;
+
+    if (!pixmap)
+    {
+        printf("Failed to create pixmap");
+        return NULL;
+    }
+
+    pixmap->width = width;
+    pixmap->height = height;
+
+    // Allocate pixel memory
+    pixmap->pixels = calloc(width * height, sizeof(nnColorf));
+    if (!pixmap->pixels)
+    {
+        printf("Failed to create pixmap pixel buffer");
+        free(pixmap);
+        return NULL;
+    }
+
+    // Create OpenGL texture
+    glGenTextures(1, &pixmap->textureID);
+    glBindTexture(GL_TEXTURE_2D, pixmap->textureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_FLOAT, pixmap->pixels);
+
+    // Set texture parameters
+    if (!_nnstate.filtered)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    else
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return pixmap;
+}
+
+nnPixmap *nnCreatePixmapFromImage(nnImage image)
+{
+    if (image.textureID == 0 || image.width <= 0 || image.height <= 0)
+    {
+        printf("Failed to create pixmap from image");
+        return NULL; // Invalid image
+    }
+
+    // Allocate a new pixmap
+    nnPixmap *pixmap = nnCreatePixmap(image.width, image.height);
+    if (!pixmap)
+    {
+        return NULL; // Failed to allocate pixmap
+    }
+
+    // Allocate a buffer to read the image data from the GPU
+    unsigned char *pixelData = malloc(image.width * image.height * 4); // 4 bytes per pixel (RGBA)
+    if (!pixelData)
+    {
+        nnFreePixmap(pixmap);
+        return NULL; // Memory allocation failed
+    }
+
+    // Read the image data from the GPU
+    glBindTexture(GL_TEXTURE_2D, image.textureID);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixelData);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Copy the pixel data into the pixmap
+    for (int y = 0; y < image.height; y++)
+    {
+        for (int x = 0; x < image.width; x++)
+        {
+            int index = (y * image.width + x) * 4; // Calculate the pixel index
+            nnColorf color = {
+                pixelData[index] / 255.0f,
+                pixelData[index + 1] / 255.0f,
+                pixelData[index + 2] / 255.0f,
+                pixelData[index + 3] / 255.0f};
+            nnDrawPixel(pixmap, x, y, color);
+        }
+    }
+
+    // Upload the pixel data to the pixmap's GPU texture
+    nnUpdatePixmap(pixmap);
+
+    // Free the temporary pixel data buffer
+    free(pixelData);
+
+    return pixmap;
+}
+
+nnPixmap *nnLoadPixmap(const char *filepath)
+{
+    nnFileView view;
+    if (!_nnMapFile(filepath, &view))
+    {
+        printf("Failed to load pixmap:\n%s\n", filepath);
+        return NULL;
+    }
+
+    nnPixmap *pixmap = nnLoadPixmapMem(view.data, view.size);
+    _nnUnmapFile(&view);
+    return pixmap;
+}
+
+nnPixmap *nnLoadPixmapMem(const unsigned char *data, size_t size)
+{
+    if (!data || size == 0 || size > 0x7fffffff)
+    {
+        printf("Failed to load pixmap from memory\n");
+        return NULL;
+    }
+
+    // .nntex pixels are used as they are, everything else is decoded
+    int width, height;
+    const unsigned char *pixelData;
+    unsigned char *decoded = NULL;
+    _nnTexInfo tex;
+    if (_nnParseTex(data, size, &tex))
+    {
+        width = tex.width;
+        height = tex.height;
+        pixelData = tex.pixels;
+    }
+    else
+    {
+        decoded = stbi_load_from_memory(data, (int)size, &width, &height, 0, 4);
+        if (!decoded)
+        {
+            printf("Failed to load pixmap from memory\n");
+            return NULL;
+        }
+        pixelData = decoded;
+    }
+
+    nnPixmap *pixmap = nnCreatePixmap(width, height);
+    if (pixmap)
+    {
+        // Pixmaps are stored bottom up
+        for (int y = 0; y < height; y++)
+        {
+            const unsigned char *row = pixelData + (size_t)y * width * 4;
+            nnColorf *target = &pixmap->pixels[(size_t)(height - 1 - y) * width];
+            for (int x = 0; x < width; x++)
+            {
+                target[x].r = row[x * 4] / 255.0f;
+                target[x].g = row[x * 4 + 1] / 255.0f;
+                target[x].b = row[x * 4 + 2] / 255.0f;
+                target[x].a = row[x * 4 + 3] / 255.0f;
+            }
+        }
+        nnUpdatePixmap(pixmap);
+    }
+
+    stbi_image_free(decoded);
+    return pixmap;
+}
+
+void nnUpdatePixmap(nnPixmap *buffer)
+{
+    if (!buffer || !buffer->pixels)
+        return;
+
+    glBindTexture(GL_TEXTURE_2D, buffer->textureID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, buffer->width, buffer->height, GL_RGBA, GL_FLOAT, buffer->pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    buffer->dirtyX1 = buffer->dirtyX0;
+    buffer->dirtyY1 = buffer->dirtyY0;
+}
+
+// Grows the region of a pixmap waiting for upload by a rectangle, which must lie inside the pixmap
+static void _nnMarkPixmapDirty(nnPixmap *pixmap, int x, int y, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    if (pixmap->dirtyX0 >= pixmap->dirtyX1 || pixmap->dirtyY0 >= pixmap->dirtyY1)
+    {
+        pixmap->dirtyX0 = x;
+        pixmap->dirtyY0 = y;
+        pixmap->dirtyX1 = x + width;
+        pixmap->dirtyY1 = y + height;
+        return;
+    }
+
+    pixmap->dirtyX0 = x < pixmap->dirtyX0 ? x : pixmap->dirtyX0;
+    pixmap->dirtyY0 = y < pixmap->dirtyY0 ? y : pixmap->dirtyY0;
+    pixmap->dirtyX1 = x + width > pixmap->dirtyX1 ? x + width : pixmap->dirtyX1;
+    pixmap->dirtyY1 = y + height > pixmap->dirtyY1 ? y + height : pixmap->dirtyY1;
+}
+
+// Uploads the region written with nnUnlockPixmap or nnWritePixels since the last upload
+static void _nnUploadDirtyPixmap(nnPixmap *pixmap)
+{
+    int width = pixmap->dirtyX1 - pixmap->dirtyX0;
+    int height = pixmap->dirtyY1 - pixmap->dirtyY0;
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Texture rows are the rows in memory, bottom up
+    int row = pixmap->height - pixmap->dirtyY1;
+    glBindTexture(GL_TEXTURE_2D, pixmap->textureID);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, pixmap->width);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, pixmap->dirtyX0, row, width, height, GL_RGBA, GL_FLOAT, &pixmap->pixels[(size_t)row * pixmap->width + pixmap->dirtyX0]);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    pixmap->dirtyX1 = pixmap->dirtyX0;
+    pixmap->dirtyY1 = pixmap->dirtyY0;
+}
+
+void nnDrawPixmap(nnPixmap *pixmap, int x, int y)
+{
+    _nnFlushBatch();
+
+    if (!pixmap || !pixmap->pixels)
+        return;
+
+    _nnUploadDirtyPixmap(pixmap);
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, pixmap->textureID);
+
+    // Enable alpha blending
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glPushMatrix();
+
+    // Translate to position
+    glTranslatef(x + pixmap->width / 2.0f, y + pixmap->height / 2.0f, 0);
+
+    // Apply rotation if any
+    if (pixmap->angle != 0.0f)
+    {
+        glRotatef(pixmap->angle, 0, 0, 1);
+    }
+
+    // Apply flipping
+    float flipX = pixmap->isFlippedX ? -1.0f : 1.0f;
+    float flipY = pixmap->isFlippedY ? -1.0f : 1.0f;
+
+    // Apply scaling
+    glScalef(pixmap->scaleX * flipX, pixmap->scaleY * flipY, 1.0f);
+
+    // Render the quad centered at the origin
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 1.0f);
+    glVertex2f(-pixmap->width / 2.0f, -pixmap->height / 2.0f);
+    glTexCoord2f(1.0f, 1.0f);
+    glVertex2f(pixmap->width / 2.0f, -pixmap->height / 2.0f);
+    glTexCoord2f(1.0f, 0.0f);
+    glVertex2f(pixmap->width / 2.0f, pixmap->height / 2.0f);
+    glTexCoord2f(0.0f, 0.0f);
+    glVertex2f(-pixmap->width / 2.0f, pixmap->height / 2.0f);
+    glEnd();
+
+    glPopMatrix();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+}
+
+void nnFlipPixmap(nnPixmap *pixmap, bool flipX, bool flipY)
+{
+    if (pixmap->textureID == 0)
+    {
+        printf("Failed to flip pixmap\n");
+        return;
+    }
+    if (flipX)
+        pixmap->isFlippedX = !pixmap->isFlippedX;
+
+    if (flipY)
+        pixmap->isFlippedY = !pixmap->isFlippedY;
+}
+
+void nnRotatePixmap(nnPixmap *pixmap, float angle)
+{
+    if (pixmap->textureID == 0)
+    {
+        printf("Failed to rotate pixmap\n");
+        return;
+    }
+
+    pixmap->angle = fmod(angle, 360.0f);
+    if (pixmap->angle < 0.0f)
+    {
+        pixmap->angle += 360.0f;
+    }
+}
+
+void nnScalePixmap(nnPixmap *pixmap, float scaleX, float scaleY)
+{
+    if (pixmap->textureID == 0)
+    {
+        printf("Failed to scale pixmap\n");
+        return;
+    }
+
+    pixmap->scaleX = scaleX;
+    pixmap->scaleY = scaleY;
+}
+
+nnPixmap *nnCopyPixmap(nnPixmap *pixmap)
+{
+    if (!pixmap || !pixmap->pixels)
+        return NULL;
+
+    // Allocate a new pixmap
+    nnPixmap *newPixmap = nnCreatePixmap(pixmap->width, pixmap->height);
+    if (!newPixmap)
+        return NULL;
+
+    // Copy pixel data from the original pixmap
+    memcpy(newPixmap->pixels, pixmap->pixels, pixmap->width * pixmap->height * sizeof(nnColorf));
+
+    // Update the texture on the GPU
+    nnUpdatePixmap(newPixmap);
+
+    return newPixmap;
+}
+
+void nnFreePixmap(nnPixmap *buffer)
+{
+    if (!buffer)
+        return;
+
+    if (buffer->pixels)
+        free(buffer->pixels);
+    glDeleteTextures(1, &buffer->textureID);
+    free(buffer);
+}
+
+nnPixmapLock nnLockPixmap(nnPixmap *pixmap, nnRecf rect)
+{
+    nnPixmapLock lock = {NULL, 0, 0, 0, NN_PIXEL_FORMAT_RGBA_FLOAT};
+    if (!pixmap || !pixmap->pixels)
+        return lock;
+
+    if (pixmap->isLocked)
+    {
+        printf("Pixmap is already locked.\n");
+        return lock;
+    }
+
+    int x0 = (int)rect.x, y0 = (int)rect.y;
+    int x1 = (int)(rect.x + rect.width), y1 = (int)(rect.y + rect.height);
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > pixmap->width ? pixmap->width : x1;
+    y1 = y1 > pixmap->height ? pixmap->height : y1;
+    if (x0 >= x1 || y0 >= y1)
+        return lock;
+
+    pixmap->isLocked = true;
+    pixmap->lockX = x0;
+    pixmap->lockY = y0;
+    pixmap->lockWidth = x1 - x0;
+    pixmap->lockHeight = y1 - y0;
+
+    lock.pixels = &pixmap->pixels[(size_t)(pixmap->height - 1 - y0) * pixmap->width + x0];
+    lock.stride = -pixmap->width;
+    lock.width = pixmap->lockWidth;
+    lock.height = pixmap->lockHeight;
+    return lock;
+}
+
+void nnUnlockPixmap(nnPixmap *pixmap)
+{
+    if (!pixmap || !pixmap->isLocked)
+        return;
+
+    pixmap->isLocked = false;
+    _nnMarkPixmapDirty(pixmap, pixmap->lockX, pixmap->lockY, pixmap->lockWidth, pixmap->lockHeight);
+}
+
+void nnWritePixels(nnPixmap *pixmap, int x, int y, const nnColorf *pixels, int count)
+{
+    if (!pixmap || !pixmap->pixels || !pixels || y < 0 || y >= pixmap->height)
+        return;
+
+    // Clip the span to the row
+    if (x < 0)
+    {
+        pixels -= x;
+        count += x;
+        x = 0;
+    }
+    if (x + count > pixmap->width)
+        count = pixmap->width - x;
+    if (count <= 0)
+        return;
+
+    memcpy(&pixmap->pixels[(size_t)(pixmap->height - 1 - y) * pixmap->width + x], pixels, count * sizeof(nnColorf));
+    _nnMarkPixmapDirty(pixmap, x, y, count, 1);
+}
+
+void nnReadPixels(nnPixmap *pixmap, int x, int y, nnColorf *pixels, int count)
+{
+    if (!pixels || count <= 0)
+        return;
+
+    memset(pixels, 0, count * sizeof(nnColorf));
+    if (!pixmap || !pixmap->pixels || y < 0 || y >= pixmap->height)
+        return;
+
+    if (x < 0)
+    {
+        pixels -= x;
+        count += x;
+        x = 0;
+    }
+    if (x + count > pixmap->width)
+        count = pixmap->width - x;
+    if (count <= 0)
+        return;
+
+    memcpy(pixels, &pixmap->pixels[(size_t)(pixmap->height - 1 - y) * pixmap->width + x], count * sizeof(nnColorf));
+}
+
+//// Primitives
+
+#define _NN_PI 3.14159265358979f
+
+// Current color as the float array the batch takes
+static void _nnPrimitiveColor(float color[4])
+{
+    color[0] = _nnstate.currentDrawColor.r;
+    color[1] = _nnstate.currentDrawColor.g;
+    color[2] = _nnstate.currentDrawColor.b;
+    color[3] = _nnstate.currentDrawColor.a;
+}
+
+// Number of segments for a circle, so its edges stay within a quarter pixel of the true circle
+static int _nnCircleSegments(float radius)
+{
+    if (radius <= 1.0f)
+        return 8;
+
+    int segments = (int)ceilf(_NN_PI / acosf(1.0f - 0.25f / radius));
+    return segments < 8 ? 8 : (segments > 512 ? 512 : segments);
+}
+
+// Queues a line as a quad stretched along it
+static void _nnBatchLine(float x0, float y0, float x1, float y1, float thickness, const float color[4])
+{
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f)
+        return;
+
+    float nx = -dy / length * thickness * 0.5f;
+    float ny = dx / length * thickness * 0.5f;
+    _nnBatchSolidQuad(x0 + nx, y0 + ny, x1 + nx, y1 + ny, x1 - nx, y1 - ny, x0 - nx, y0 - ny, color);
+}
+
+// Returns `true` if p lies inside the triangle a, b, c or on its edges, for a triangle wound with the sign of `orientation`
+static bool _nnPointInTriangle(nnPosf p, nnPosf a, nnPosf b, nnPosf c, float orientation)
+{
+    float ab = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+    float bc = (c.x - b.x) * (p.y - b.y) - (c.y - b.y) * (p.x - b.x);
+    float ca = (a.x - c.x) * (p.y - c.y) - (a.y - c.y) * (p.x - c.x);
+    return ab * orientation >= 0.0f && bc * orientation >= 0.0f && ca * orientation >= 0.0f;
+}
+
+// Queues a simple polygon as triangles, cutting off one ear (a convex corner without other points inside) at a time
+static void _nnBatchPolygon(const nnPosf *points, int count, const float color[4])
+{
+    int *indices = malloc(count * sizeof(int));
+    if (!indices)
+    {
+        printf("Failed to allocate memory for polygon.\n");
+        return;
+    }
+
+    float area = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        indices[i] = i;
+        const nnPosf *a = &points[i];
+        const nnPosf *b = &points[(i + 1) % count];
+        area += a->x * b->y - b->x * a->y;
+    }
+    float orientation = area < 0.0f ? -1.0f : 1.0f;
+
+    int remaining = count;
+    int misses = 0; // Corners tried since the last ear, once all were tried the rest is not a simple polygon
+    int i = 0;
+    while (remaining > 3 && misses < remaining)
+    {
+        int prev = (i + remaining - 1) % remaining;
+        int next = (i + 1) % remaining;
+        nnPosf a = points[indices[prev]];
+        nnPosf b = points[indices[i]];
+        nnPosf c = points[indices[next]];
+        bool ear = ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) * orientation > 0.0f;
+        for (int j = 0; ear && j < remaining; j++)
+        {
+            if (j != prev && j != i && j != next)
+                ear = !_nnPointInTriangle(points[indices[j]], a, b, c, orientation);
+        }
+
+        if (!ear)
+        {
+            misses++;
+            i = next;
+            continue;
+        }
+
+        _nnBatchTriangle(a.x, a.y, b.x, b.y, c.x, c.y, color);
+        memmove(&indices[i], &indices[i + 1], (remaining - i - 1) * sizeof(int));
+        remaining--;
+        misses = 0;
+        if (i >= remaining)
+            i = 0;
+    }
+
+    // The last triangle, or a fan over what is left of a polygon that crosses itself
+    for (int i = 1; i + 1 < remaining; i++)
+    {
+        nnPosf a = points[indices[0]];
+        nnPosf b = points[indices[i]];
+        nnPosf c = points[indices[i + 1]];
+        _nnBatchTriangle(a.x, a.y, b.x, b.y, c.x, c.y, color);
+    }
+
+    free(indices);
+}
+
+void nnPutPixel(float x, float y)
+{
+    float color[4];
+    _nnPrimitiveColor(color);
+    _nnBatchSolidQuad(x, y, x + 1.0f, y, x + 1.0f, y + 1.0f, x, y + 1.0f, color);
+}
+
+void nnPutLine(float x0, float y0, float x1, float y1, float thickness)
+{
+    float color[4];
+    _nnPrimitiveColor(color);
+    _nnBatchLine(x0, y0, x1, y1, thickness > 0.0f ? thickness : 1.0f, color);
+}
+
+void nnPutRect(float x, float y, float width, float height, bool filled)
+{
+    if (width <= 0.0f || height <= 0.0f)
+        return;
+
+    float color[4];
+    _nnPrimitiveColor(color);
+    if (filled || width <= 2.0f || height <= 2.0f)
+    {
+        _nnBatchSolidQuad(x, y, x + width, y, x + width, y + height, x, y + height, color);
+        return;
+    }
+
+    _nnBatchSolidQuad(x, y, x + width, y, x + width, y + 1.0f, x, y + 1.0f, color);
+    _nnBatchSolidQuad(x, y + height - 1.0f, x + width, y + height - 1.0f, x + width, y + height, x, y + height, color);
+    _nnBatchSolidQuad(x, y + 1.0f, x + 1.0f, y + 1.0f, x + 1.0f, y + height - 1.0f, x, y + height - 1.0f, color);
+    _nnBatchSolidQuad(x + width - 1.0f, y + 1.0f, x + width, y + 1.0f, x + width, y + height - 1.0f, x + width - 1.0f, y + height - 1.0f, color);
+}
+
+void nnPutCircle(float x, float y, float radius, bool filled)
+{
+    if (radius <= 0.0f)
+        return;
+
+    float color[4];
+    _nnPrimitiveColor(color);
+
+    // Filled circles are a fan of triangles around the center, outlines a ring of one pixel wide quads inside the radius
+    int segments = _nnCircleSegments(radius);
+    float inner = radius > 1.0f ? radius - 1.0f : 0.0f;
+    float step = 2.0f * _NN_PI / segments;
+    float cx0 = 1.0f, sy0 = 0.0f;
+    for (int i = 1; i <= segments; i++)
+    {
+        float cx1 = cosf(i * step);
+        float sy1 = sinf(i * step);
+        if (filled)
+            _nnBatchTriangle(x, y, x + cx0 * radius, y + sy0 * radius, x + cx1 * radius, y + sy1 * radius, color);
+        else
+            _nnBatchSolidQuad(x + cx0 * radius, y + sy0 * radius, x + cx1 * radius, y + sy1 * radius, x + cx1 * inner, y + sy1 * inner, x + cx0 * inner, y + sy0 * inner, color);
+        cx0 = cx1;
+        sy0 = sy1;
+    }
+}
+
+void nnPutPolygon(const nnPosf *points, int count, bool filled)
+{
+    if (!points || count < 2)
+        return;
+
+    float color[4];
+    _nnPrimitiveColor(color);
+    if (filled && count >= 3)
+    {
+        _nnBatchPolygon(points, count, color);
+        return;
+    }
+
+    // Two points are a single line, more are closed
+    int edges = count == 2 ? 1 : count;
+    for (int i = 0; i < edges; i++)
+    {
+        const nnPosf *a = &points[i];
+        const nnPosf *b = &points[(i + 1) % count];
+        _nnBatchLine(a->x, a->y, b->x, b->y, 1.0f, color);
+    }
+}
+
+void nnFlushPrimitives()
+{
+    _nnFlushBatch();
+}
+
+//// Paths
+
+// Points of a path from one moveTo (or the start after a close) to the next
+typedef struct
+{
+    int first;   // First point
+    int count;   // Number of points
+    bool closed; // Ends with a line back to the first point
+} _nnSubpath;
+
+// The quads of a tessellated path, kept until the path changes or is drawn with other settings
+typedef struct
+{
+    nnPosf *vertices;    // Four per quad, freed once they are in the vertex buffer
+    int vertexCount;
+    int capacity;
+    unsigned int buffer; // Vertex buffer holding the quads, 0 without vertex buffer support
+    bool valid;          // Tessellated from the current points with the settings below
+    bool failed;         // Ran out of memory while tessellating
+    float thickness;     // Settings of a stroke
+    nnLineJoin join;
+    nnLineCap cap;
+    bool evenOdd;        // Fill rule of a fill
+} _nnPathMesh;
+
+struct _nnPath
+{
+    nnPosf *points; // Points of all subpaths, curves flattened to lines
+    int pointCount;
+    int pointCapacity;
+    _nnSubpath *subpaths;
+    int subpathCount;
+    int subpathCapacity;
+    nnPosf start;   // Start of the current subpath, where the next one starts after a close
+    bool drawing;   // The last subpath is still being added to
+    _nnPathMesh fill;
+    _nnPathMesh stroke;
+};
+
+// An edge of a filled path, from top to bottom
+typedef struct _nnPathEdge
+{
+    float x0, y0;
+    float y1;
+    float slope;   // Change of x per y
+    int winding;   // 1 if the path goes down along the edge, -1 if it goes up
+    float x;       // Position in the band being filled, used for sorting
+    struct _nnPathEdge *right; // Right edge of the trapezoid this edge is the left edge of, NULL if there is none
+    float spanTop; // Top of that trapezoid
+    int band;      // Last band the trapezoid was part of
+} _nnPathEdge;
+
+#define _NN_MITER_LIMIT 4.0f
+
+// Appends a quad to a mesh
+static void _nnMeshQuad(_nnPathMesh *mesh, nnPosf a, nnPosf b, nnPosf c, nnPosf d)
+{
+    if (mesh->failed)
+        return;
+
+    if (mesh->vertexCount + 4 > mesh->capacity)
+    {
+        int capacity = mesh->capacity ? mesh->capacity * 2 : 256;
+        nnPosf *vertices = realloc(mesh->vertices, capacity * sizeof(nnPosf));
+        if (!vertices)
+        {
+            printf("Failed to allocate memory for path.\n");
+            mesh->failed = true;
+            return;
+        }
+        mesh->vertices = vertices;
+        mesh->capacity = capacity;
+    }
+
+    nnPosf *vertex = &mesh->vertices[mesh->vertexCount];
+    vertex[0] = a;
+    vertex[1] = b;
+    vertex[2] = c;
+    vertex[3] = d;
+    mesh->vertexCount += 4;
+}
+
+// Appends a triangle to a mesh, as a quad whose last corner repeats the third
+static void _nnMeshTriangle(_nnPathMesh *mesh, nnPosf a, nnPosf b, nnPosf c)
+{
+    _nnMeshQuad(mesh, a, b, c, c);
+}
+
+// Appends a fan of triangles around center, from center + offset turning by `angle` radians
+static void _nnMeshArc(_nnPathMesh *mesh, nnPosf center, nnPosf offset, float angle, float radius)
+{
+    int segments = (int)ceilf(_nnCircleSegments(radius) * fabsf(angle) / (2.0f * _NN_PI));
+    if (segments < 1)
+        segments = 1;
+
+    float c = cosf(angle / segments);
+    float s = sinf(angle / segments);
+    for (int i = 0; i < segments; i++)
+    {
+        nnPosf next = {offset.x * c - offset.y * s, offset.x * s + offset.y * c};
+        _nnMeshTriangle(mesh, center, (nnPosf){center.x + offset.x, center.y + offset.y}, (nnPosf){center.x + next.x, center.y + next.y});
+        offset = next;
+    }
+}
+
+// Returns the direction from a to b with a length of one
+static nnPosf _nnDirection(nnPosf a, nnPosf b)
+{
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float length = sqrtf(dx * dx + dy * dy);
+    return (nnPosf){dx / length, dy / length};
+}
+
+// Appends the corner between a segment in direction d0 and the next one in direction d1, on the outside of the turn.
+// With an inset the segment quads end where their inner edges cross, `inset` before and after p, and the gap up to p is filled too.
+static void _nnMeshJoin(_nnPathMesh *mesh, nnPosf p, nnPosf d0, nnPosf d1, float halfThickness, float inset, nnLineJoin join)
+{
+    float cross = d0.x * d1.y - d0.y * d1.x;
+    float dot = d0.x * d1.x + d0.y * d1.y;
+    if (fabsf(cross) < 1e-6f && dot > 0.0f)
+        return; // Straight on
+
+    // Normals pointing to the outside of the turn, the segment quads end there
+    float side = cross > 0.0f ? -1.0f : 1.0f;
+    nnPosf n0 = {-d0.y * side * halfThickness, d0.x * side * halfThickness};
+    nnPosf n1 = {-d1.y * side * halfThickness, d1.x * side * halfThickness};
+    nnPosf o0 = {p.x + n0.x, p.y + n0.y};
+    nnPosf o1 = {p.x + n1.x, p.y + n1.y};
+
+    if (inset > 0.0f)
+    {
+        nnPosf q = {p.x - n0.x - d0.x * inset, p.y - n0.y - d0.y * inset};
+        _nnMeshTriangle(mesh, q, o0, p);
+        _nnMeshTriangle(mesh, q, p, o1);
+    }
+
+    if (join == NN_JOIN_ROUND)
+    {
+        _nnMeshArc(mesh, p, n0, atan2f(n0.x * n1.y - n0.y * n1.x, n0.x * n1.x + n0.y * n1.y), halfThickness);
+        return;
+    }
+
+    // The miter tip lies on the bisector of the normals, 1 / cos(half the angle between them) away
+    float mx = n0.x + n1.x;
+    float my = n0.y + n1.y;
+    float length = sqrtf(mx * mx + my * my);
+    float cosHalf = length / (2.0f * halfThickness);
+    if (join == NN_JOIN_MITER && cosHalf > 1.0f / _NN_MITER_LIMIT)
+    {
+        float scale = halfThickness / (cosHalf * length);
+        _nnMeshQuad(mesh, p, o0, (nnPosf){p.x + mx * scale, p.y + my * scale}, o1);
+        return;
+    }
+
+    _nnMeshTriangle(mesh, p, o0, o1);
+}
+
+// Returns how far before and after the corner at point k the inner edges of the two segments meeting there cross, so their
+// quads can end there instead of overlapping. Returns 0 if there is no turn or the segments are too short for the turn,
+// then the quads simply overlap. `inner` is set to 1 if the inside of the turn is left of the path, -1 if it is right.
+static float _nnStrokeInset(const nnPosf *points, int count, int k, float halfThickness, float *inner)
+{
+    nnPosf p = points[k];
+    nnPosf previous = points[(k + count - 1) % count];
+    nnPosf next = points[(k + 1) % count];
+    nnPosf d0 = _nnDirection(previous, p);
+    nnPosf d1 = _nnDirection(p, next);
+    float cross = d0.x * d1.y - d0.y * d1.x;
+    float dot = d0.x * d1.x + d0.y * d1.y;
+    *inner = cross > 0.0f ? 1.0f : -1.0f;
+    if (fabsf(cross) < 1e-6f)
+        return 0.0f;
+
+    // Half the thickness times the tangent of half the turn, each segment may give up to half its length
+    float inset = halfThickness * fabsf(cross) / (1.0f + dot);
+    float shorter = fminf(hypotf(p.x - previous.x, p.y - previous.y), hypotf(next.x - p.x, next.y - p.y));
+    return inset <= 0.5f * shorter ? inset : 0.0f;
+}
+
+// Appends the cap at the end point p of an open subpath, which ends in direction d
+static void _nnMeshCap(_nnPathMesh *mesh, nnPosf p, nnPosf d, float halfThickness, nnLineCap cap)
+{
+    nnPosf n = {-d.y * halfThickness, d.x * halfThickness};
+    if (cap == NN_CAP_ROUND)
+    {
+        _nnMeshArc(mesh, p, n, -_NN_PI, halfThickness);
+    }
+    else if (cap == NN_CAP_SQUARE)
+    {
+        nnPosf e = {d.x * halfThickness, d.y * halfThickness};
+        _nnMeshQuad(mesh, (nnPosf){p.x + n.x, p.y + n.y}, (nnPosf){p.x + n.x + e.x, p.y + n.y + e.y},
+                    (nnPosf){p.x - n.x + e.x, p.y - n.y + e.y}, (nnPosf){p.x - n.x, p.y - n.y});
+    }
+}
+
+// Tessellates the outline of every subpath into quads along its segments plus joins and caps
+static void _nnTessellateStroke(nnPath *path, _nnPathMesh *mesh)
+{
+    float halfThickness = mesh->thickness * 0.5f;
+    for (int i = 0; i < path->subpathCount; i++)
+    {
+        const nnPosf *points = &path->points[path->subpaths[i].first];
+        int count = path->subpaths[i].count;
+        bool closed = path->subpaths[i].closed;
+        if (closed && count > 1 && points[0].x == points[count - 1].x && points[0].y == points[count - 1].y)
+            count--; // The closing line is implied
+        if (count < 2)
+            continue;
+        if (count == 2)
+            closed = false; // Closing a single line would only draw it back
+
+        int segments = closed ? count : count - 1;
+        nnPosf previous = _nnDirection(points[count - 1], points[0]);
+        for (int j = 0; j < segments; j++)
+        {
+            nnPosf a = points[j];
+            nnPosf b = points[(j + 1) % count];
+            nnPosf d = _nnDirection(a, b);
+            nnPosf n = {-d.y * halfThickness, d.x * halfThickness};
+            nnPosf startLeft = {a.x + n.x, a.y + n.y};
+            nnPosf startRight = {a.x - n.x, a.y - n.y};
+            nnPosf endLeft = {b.x + n.x, b.y + n.y};
+            nnPosf endRight = {b.x - n.x, b.y - n.y};
+
+            // On the inside of a turn the quad ends where it meets the neighbor's inner edge, so translucent strokes
+            // are not blended twice there
+            bool startJoin = j > 0 || closed;
+            bool endJoin = j < count - 2 || closed;
+            float inner = 0.0f;
+            float startInset = startJoin ? _nnStrokeInset(points, count, j, halfThickness, &inner) : 0.0f;
+            nnPosf *corner = inner > 0.0f ? &startLeft : &startRight;
+            corner->x += d.x * startInset;
+            corner->y += d.y * startInset;
+            float endInset = endJoin ? _nnStrokeInset(points, count, (j + 1) % count, halfThickness, &inner) : 0.0f;
+            corner = inner > 0.0f ? &endLeft : &endRight;
+            corner->x -= d.x * endInset;
+            corner->y -= d.y * endInset;
+            _nnMeshQuad(mesh, startLeft, endLeft, endRight, startRight);
+
+            if (startJoin)
+                _nnMeshJoin(mesh, a, previous, d, halfThickness, startInset, mesh->join);
+            previous = d;
+        }
+
+        if (!closed)
+        {
+            _nnMeshCap(mesh, points[0], _nnDirection(points[1], points[0]), halfThickness, mesh->cap);
+            _nnMeshCap(mesh, points[count - 1], _nnDirection(points[count - 2], points[count - 1]), halfThickness, mesh->cap);
+        }
+    }
+}
+
+// Compares floats for qsort
+static int _nnCompareFloats(const void *a, const void *b)
+{
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Compares path edges by their top for qsort
+static int _nnComparePathEdges(const void *a, const void *b)
+{
+    return _nnCompareFloats(&((const _nnPathEdge *)a)->y0, &((const _nnPathEdge *)b)->y0);
+}
+
+// Position of an edge at y
+static float _nnEdgeX(const _nnPathEdge *edge, float y)
+{
+    return edge->x0 + (y - edge->y0) * edge->slope;
+}
+
+// Appends the trapezoid between two edges from top to bottom
+static void _nnMeshTrapezoid(_nnPathMesh *mesh, const _nnPathEdge *left, const _nnPathEdge *right, float top, float bottom)
+{
+    _nnMeshQuad(mesh, (nnPosf){_nnEdgeX(left, top), top}, (nnPosf){_nnEdgeX(right, top), top},
+                (nnPosf){_nnEdgeX(right, bottom), bottom}, (nnPosf){_nnEdgeX(left, bottom), bottom});
+}
+
+// Tessellates the inside of the path into trapezoids. The path is cut into horizontal bands at every point and every crossing of two edges,
+// inside a band the edges keep their order, so walking them from left to right while summing their windings finds the inside spans.
+// A span between the same two edges as in the band above grows that trapezoid instead of starting a new one.
+static void _nnTessellateFill(nnPath *path, _nnPathMesh *mesh)
+{
+    _nnPathEdge *edges = malloc((path->pointCount ? path->pointCount : 1) * sizeof(_nnPathEdge));
+    _nnPathEdge **active = malloc((path->pointCount ? path->pointCount : 1) * sizeof(_nnPathEdge *));
+    float *ys = malloc((path->pointCount ? path->pointCount : 1) * sizeof(float));
+    if (!edges || !active || !ys)
+    {
+        printf("Failed to allocate memory for path.\n");
+        mesh->failed = true;
+        free(edges);
+        free(active);
+        free(ys);
+        return;
+    }
+
+    // Every subpath is closed, horizontal edges do not bound any band
+    int edgeCount = 0;
+    for (int i = 0; i < path->subpathCount; i++)
+    {
+        const nnPosf *points = &path->points[path->subpaths[i].first];
+        int count = path->subpaths[i].count;
+        if (count < 3)
+            continue;
+
+        for (int j = 0; j < count; j++)
+        {
+            nnPosf a = points[j];
+            nnPosf b = points[(j + 1) % count];
+            if (a.y == b.y)
+                continue;
+
+            _nnPathEdge *edge = &edges[edgeCount++];
+            edge->winding = a.y < b.y ? 1 : -1;
+            if (a.y > b.y)
+            {
+                nnPosf swap = a;
+                a = b;
+                b = swap;
+            }
+            edge->x0 = a.x;
+            edge->y0 = a.y;
+            edge->y1 = b.y;
+            edge->slope = (b.x - a.x) / (b.y - a.y);
+            edge->right = NULL;
+            edge->band = -1;
+        }
+    }
+
+    for (int i = 0; i < path->pointCount; i++)
+        ys[i] = path->points[i].y;
+    qsort(ys, path->pointCount, sizeof(float), _nnCompareFloats);
+    qsort(edges, edgeCount, sizeof(_nnPathEdge), _nnComparePathEdges);
+
+    int activeCount = 0;
+    int nextEdge = 0;
+    int band = 0;
+    for (int i = 0; i + 1 < path->pointCount; i++)
+    {
+        float bandEnd = ys[i + 1];
+        float top = ys[i];
+        if (top == bandEnd)
+            continue;
+
+        // Edges ending at the top of the band leave and end their trapezoids, edges starting there join
+        int kept = 0;
+        for (int j = 0; j < activeCount; j++)
+        {
+            _nnPathEdge *edge = active[j];
+            if (edge->y1 > top)
+                active[kept++] = edge;
+            else if (edge->right)
+                _nnMeshTrapezoid(mesh, edge, edge->right, edge->spanTop, top);
+        }
+        activeCount = kept;
+        while (nextEdge < edgeCount && edges[nextEdge].y0 <= top)
+        {
+            if (edges[nextEdge].y1 > top)
+                active[activeCount++] = &edges[nextEdge];
+            nextEdge++;
+        }
+
+        while (top < bandEnd)
+        {
+            // Sort the edges by their middle in the band and cut the band at the first crossing, until no edges cross inside it.
+            // Crossings within a thousandth of a pixel of the top are left, the edges then only swap places inside that sliver.
+            float bottom = bandEnd;
+            for (int attempt = 0; attempt < 32; attempt++)
+            {
+                float middle = (top + bottom) * 0.5f;
+                for (int j = 0; j < activeCount; j++)
+                {
+                    _nnPathEdge *edge = active[j];
+                    edge->x = _nnEdgeX(edge, middle);
+                    int k = j;
+                    for (; k > 0 && active[k - 1]->x > edge->x; k--)
+                        active[k] = active[k - 1];
+                    active[k] = edge;
+                }
+
+                float crossing = bottom;
+                for (int j = 0; j + 1 < activeCount; j++)
+                {
+                    float above = _nnEdgeX(active[j], top) - _nnEdgeX(active[j + 1], top);
+                    float below = _nnEdgeX(active[j], bottom) - _nnEdgeX(active[j + 1], bottom);
+                    if (above <= 1e-4f && below <= 1e-4f)
+                        continue;
+
+                    float y = top + (bottom - top) * above / (above - below);
+                    if (y > top + 1e-3f && y < crossing)
+                        crossing = y;
+                }
+
+                if (crossing == bottom)
+                    break;
+                bottom = crossing;
+            }
+
+            // The left edge of each inside span keeps the trapezoid it bounds
+            int winding = 0;
+            _nnPathEdge *left = NULL;
+            for (int j = 0; j < activeCount; j++)
+            {
+                winding += active[j]->winding;
+                bool inside = mesh->evenOdd ? (winding & 1) != 0 : winding != 0;
+                if (inside && !left)
+                {
+                    left = active[j];
+                }
+                else if (!inside && left)
+                {
+                    if (left->right != active[j])
+                    {
+                        if (left->right)
+                            _nnMeshTrapezoid(mesh, left, left->right, left->spanTop, top);
+                        left->right = active[j];
+                        left->spanTop = top;
+                    }
+                    left->band = band;
+                    left = NULL;
+                }
+            }
+
+            // Trapezoids whose edges no longer bound a span end at the top of the band
+            for (int j = 0; j < activeCount; j++)
+            {
+                _nnPathEdge *edge = active[j];
+                if (edge->right && edge->band != band)
+                {
+                    _nnMeshTrapezoid(mesh, edge, edge->right, edge->spanTop, top);
+                    edge->right = NULL;
+                }
+            }
+
+            band++;
+            top = bottom;
+        }
+    }
+
+    // What is left ends at the bottom of the path
+    for (int j = 0; j < activeCount; j++)
+    {
+        if (active[j]->right)
+            _nnMeshTrapezoid(mesh, active[j], active[j]->right, active[j]->spanTop, ys[path->pointCount - 1]);
+    }
+
+    free(edges);
+    free(active);
+    free(ys);
+}
+
+// Moves the quads of a freshly tessellated mesh into its vertex buffer, if there is one
+static void _nnUploadPathMesh(_nnPathMesh *mesh)
+{
+    if (!_nnLoadBufferFuncs())
+        return;
+
+    if (!mesh->buffer)
+        _nnGenBuffers(1, &mesh->buffer);
+    _nnBindBuffer(GL_ARRAY_BUFFER, mesh->buffer);
+    _nnBufferData(GL_ARRAY_BUFFER, (ptrdiff_t)mesh->vertexCount * sizeof(nnPosf), mesh->vertices, GL_STATIC_DRAW);
+    _nnBindBuffer(GL_ARRAY_BUFFER, 0);
+    free(mesh->vertices);
+    mesh->vertices = NULL;
+    mesh->capacity = 0;
+}
+
+// Draws the quads of a mesh moved by x, y with the current color in one call
+static void _nnDrawPathMesh(_nnPathMesh *mesh, float x, float y)
+{
+    if (mesh->vertexCount == 0)
+        return;
+
+    // Quads queued before are drawn first, so the path ends up on top of them
+    _nnFlushBatch();
+
+    glPushMatrix();
+    glTranslatef(x, y, 0.0f);
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    // With a vertex buffer bound, the pointer is an offset into it
+    if (mesh->buffer)
+        _nnBindBuffer(GL_ARRAY_BUFFER, mesh->buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(nnPosf), mesh->buffer ? NULL : mesh->vertices);
+    glDrawArrays(GL_QUADS, 0, mesh->vertexCount);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    if (mesh->buffer)
+        _nnBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDisable(GL_BLEND);
+    glPopMatrix();
+}
+
+// Drops the tessellated quads of a mesh, keeping its vertex buffer for the next tessellation
+static void _nnResetPathMesh(_nnPathMesh *mesh)
+{
+    free(mesh->vertices);
+    mesh->vertices = NULL;
+    mesh->vertexCount = 0;
+    mesh->capacity = 0;
+    mesh->valid = false;
+    mesh->failed = false;
+}
+
+// Adds a point to the current subpath, starting one at the current point if there is none
+static void _nnPathAddPoint(nnPath *path, float x, float y)
+{
+    if (!path->drawing)
+    {
+        if (path->subpathCount == path->subpathCapacity)
+        {
+            int capacity = path->subpathCapacity ? path->subpathCapacity * 2 : 4;
+            _nnSubpath *subpaths = realloc(path->subpaths, capacity * sizeof(_nnSubpath));
+            if (!subpaths)
+            {
+                printf("Failed to allocate memory for path.\n");
+                return;
+            }
+            path->subpaths = subpaths;
+            path->subpathCapacity = capacity;
+        }
+        path->subpaths[path->subpathCount++] = (_nnSubpath){path->pointCount, 0, false};
+        path->drawing = true;
+        _nnPathAddPoint(path, path->start.x, path->start.y);
+    }
+
+    _nnSubpath *subpath = &path->subpaths[path->subpathCount - 1];
+    if (subpath->count > 0)
+    {
+        nnPosf last = path->points[path->pointCount - 1];
+        if (last.x == x && last.y == y)
+            return;
+    }
+
+    if (path->pointCount == path->pointCapacity)
+    {
+        int capacity = path->pointCapacity ? path->pointCapacity * 2 : 64;
+        nnPosf *points = realloc(path->points, capacity * sizeof(nnPosf));
+        if (!points)
+        {
+            printf("Failed to allocate memory for path.\n");
+            return;
+        }
+        path->points = points;
+        path->pointCapacity = capacity;
+    }
+
+    path->points[path->pointCount++] = (nnPosf){x, y};
+    subpath->count++;
+    _nnResetPathMesh(&path->fill);
+    _nnResetPathMesh(&path->stroke);
+}
+
+// Returns the point a curve or line added to the path starts at
+static nnPosf _nnPathCurrentPoint(nnPath *path)
+{
+    return path->drawing ? path->points[path->pointCount - 1] : path->start;
+}
+
+// Number of lines a curve is flattened to, so they stay within a quarter pixel of it (Wang's formula).
+// `bound` is the largest second difference of the control points times degree * (degree - 1) / 8.
+static int _nnCurveSegments(float bound)
+{
+    int segments = (int)ceilf(sqrtf(bound / 0.25f));
+    return segments < 1 ? 1 : (segments > 256 ? 256 : segments);
+}
+
+nnPath *nnCreatePath()
+{
+    nnPath *path = calloc(1, sizeof(nnPath));
+    if (!path)
+    {
+        printf("Failed to allocate memory for path.\n");
+        return NULL;
+    }
+    return path;
+}
+
+void nnPathMoveTo(nnPath *path, float x, float y)
+{
+    if (!path)
+        return;
+
+    path->start = (nnPosf){x, y};
+    path->drawing = false;
+}
+
+void nnPathLineTo(nnPath *path, float x, float y)
+{
+    if (!path)
+        return;
+
+    _nnPathAddPoint(path, x, y);
+}
+
+void nnPathQuadTo(nnPath *path, float cx, float cy, float x, float y)
+{
+    if (!path)
+        return;
+
+    nnPosf p = _nnPathCurrentPoint(path);
+    float ddx = p.x - 2.0f * cx + x;
+    float ddy = p.y - 2.0f * cy + y;
+    int segments = _nnCurveSegments(sqrtf(ddx * ddx + ddy * ddy) * 0.25f);
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i / segments;
+        float u = 1.0f - t;
+        _nnPathAddPoint(path, u * u * p.x + 2.0f * u * t * cx + t * t * x, u * u * p.y + 2.0f * u * t * cy + t * t * y);
+    }
+}
+
+void nnPathCubicTo(nnPath *path, float cx1, float cy1, float cx2, float cy2, float x, float y)
+{
+    if (!path)
+        return;
+
+    nnPosf p = _nnPathCurrentPoint(path);
+    float ddx0 = p.x - 2.0f * cx1 + cx2;
+    float ddy0 = p.y - 2.0f * cy1 + cy2;
+    float ddx1 = cx1 - 2.0f * cx2 + x;
+    float ddy1 = cy1 - 2.0f * cy2 + y;
+    float dd = fmaxf(sqrtf(ddx0 * ddx0 + ddy0 * ddy0), sqrtf(ddx1 * ddx1 + ddy1 * ddy1));
+    int segments = _nnCurveSegments(dd * 0.75f);
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i / segments;
+        float u = 1.0f - t;
+        float a = u * u * u, b = 3.0f * u * u * t, c = 3.0f * u * t * t, d = t * t * t;
+        _nnPathAddPoint(path, a * p.x + b * cx1 + c * cx2 + d * x, a * p.y + b * cy1 + c * cy2 + d * y);
+    }
+}
+
+void nnPathClose(nnPath *path)
+{
+    if (!path || !path->drawing)
+        return;
+
+    path->subpaths[path->subpathCount - 1].closed = true;
+    path->drawing = false;
+    _nnResetPathMesh(&path->stroke);
+}
+
+void nnClearPath(nnPath *path)
+{
+    if (!path)
+        return;
+
+    path->pointCount = 0;
+    path->subpathCount = 0;
+    path->start = (nnPosf){0.0f, 0.0f};
+    path->drawing = false;
+    _nnResetPathMesh(&path->fill);
+    _nnResetPathMesh(&path->stroke);
+}
+
+void nnStrokePath(nnPath *path, float x, float y, float thickness, nnLineJoin join, nnLineCap cap)
+{
+    if (!path || thickness <= 0.0f)
+        return;
+
+    _nnPathMesh *mesh = &path->stroke;
+    if (!mesh->valid || mesh->thickness != thickness || mesh->join != join || mesh->cap != cap)
+    {
+        _nnResetPathMesh(mesh);
+        mesh->thickness = thickness;
+        mesh->join = join;
+        mesh->cap = cap;
+        _nnTessellateStroke(path, mesh);
+        if (mesh->failed)
+        {
+            _nnResetPathMesh(mesh);
+            return;
+        }
+        _nnUploadPathMesh(mesh);
+        mesh->valid = true;
+    }
+
+    _nnDrawPathMesh(mesh, x, y);
+}
+
+void nnFillPath(nnPath *path, float x, float y, bool evenOdd)
+{
+    if (!path)
+        return;
+
+    _nnPathMesh *mesh = &path->fill;
+    if (!mesh->valid || mesh->evenOdd != evenOdd)
+    {
+        _nnResetPathMesh(mesh);
+        mesh->evenOdd = evenOdd;
+        _nnTessellateFill(path, mesh);
+        if (mesh->failed)
+        {
+            _nnResetPathMesh(mesh);
+            return;
+        }
+        _nnUploadPathMesh(mesh);
+        mesh->valid = true;
+    }
+
+    _nnDrawPathMesh(mesh, x, y);
+}
+
+void nnFreePath(nnPath *path)
+{
+    if (!path)
+        return;
+
+    if (path->fill.buffer)
+        _nnDeleteBuffers(1, &path->fill.buffer);
+    if (path->stroke.buffer)
+        _nnDeleteBuffers(1, &path->stroke.buffer);
+    free(path->fill.vertices);
+    free(path->stroke.vertices);
+    free(path->points);
+    free(path->subpaths);
+    free(path);
+}
+
+void nnDrawPixel(nnPixmap *pixmap, int x, int y, nnColorf color)
+{
+    if (!pixmap || x < 0 || y < 0 || x >= pixmap->width || y >= pixmap->height)
+        return;
+
+    y = pixmap->height - 1 - y; // Adjust y-coordinate for top-left origin
+    pixmap->pixels[y * pixmap->width + x] = color;
+}
+
+void nnDrawLine(nnPixmap *pixmap, int x0, int y0, int x1, int y1, nnColorf color)
+{
+    if (!pixmap)
+        return;
+
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy, e2;
+
+    while (true)
+    {
+        nnDrawPixel(pixmap, x0, y0, color);
+        if (x0 == x1 && y0 == y1)
+            break;
+        e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void nnDrawOval(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf color, bool filled)
+{
+    if (!pixmap)
+        return;
+
+    int a = width / 2;
+    int b = height / 2;
+    int x0 = x - a, y0 = y - b;
+
+    if (filled)
+    {
+        for (int i = 0; i <= height; i++)
+        {
+            for (int j = 0; j <= width; j++)
+            {
+                int px = x0 + j;
+                int py = y0 + i;
+                if (((j - a) * (j - a)) * b * b + ((i - b) * (i - b)) * a * a <= a * a * b * b)
+                {
+                    nnDrawPixel(pixmap, px, py, color);
+                }
+            }
+        }
+    }
+    else
+    {
+        int x1 = 0, y1 = b;
+        int a2 = a * a, b2 = b * b;
+        int fa2 = 4 * a2, fb2 = 4 * b2;
+        int sigma = 2 * b2 + a2 * (1 - 2 * b);
+
+        while (b2 * x1 <= a2 * y1)
+        {
+            nnDrawPixel(pixmap, x + x1, y + y1, color);
+            nnDrawPixel(pixmap, x - x1, y + y1, color);
+            nnDrawPixel(pixmap, x + x1, y - y1, color);
+            nnDrawPixel(pixmap, x - x1, y - y1, color);
+
+            if (sigma >= 0)
+            {
+                sigma += fa2 * (1 - y1);
+                y1--;
+            }
+            sigma += b2 * ((4 * x1) + 6);
+            x1++;
+        }
+
+        x1 = a;
+        y1 = 0;
+        sigma = 2 * a2 + b2 * (1 - 2 * a);
+
+        while (a2 * y1 <= b2 * x1)
+        {
+            nnDrawPixel(pixmap, x + x1, y + y1, color);
+            nnDrawPixel(pixmap, x - x1, y + y1, color);
+            nnDrawPixel(pixmap, x + x1, y - y1, color);
+            nnDrawPixel(pixmap, x - x1, y - y1, color);
+
+            if (sigma >= 0)
+            {
+                sigma += fb2 * (1 - x1);
+                x1--;
+            }
+            sigma += a2 * ((4 * y1) + 6);
+            y1++;
+        }
+    }
+}
+
+void nnDrawTriangle(nnPixmap *pixmap, int x1, int y1, int x2, int y2, int x3, int y3, nnColorf color, bool filled)
+{
+    if (!pixmap)
+        return;
+
+    if (filled)
+    {
+        // Sorting vertices by y-coordinate
+        if (y1 > y2)
+        {
+            int tmp;
+            tmp = y1;
+            y1 = y2;
+            y2 = tmp;
+            tmp = x1;
+            x1 = x2;
+            x2 = tmp;
+        }
+        if (y1 > y3)
+        {
+            int tmp;
+            tmp = y1;
+            y1 = y3;
+            y3 = tmp;
+            tmp = x1;
+            x1 = x3;
+            x3 = tmp;
+        }
+        if (y2 > y3)
+        {
+            int tmp;
+            tmp = y2;
+            y2 = y3;
+            y3 = tmp;
+            tmp = x2;
+            x2 = x3;
+            x3 = tmp;
+        }
+
+        int dx1 = x2 - x1, dy1 = y2 - y1, dx2 = x3 - x1, dy2 = y3 - y1, dx3 = x3 - x2, dy3 = y3 - y2;
+        float slope1 = dy1 ? (float)dx1 / dy1 : 0;
+        float slope2 = dy2 ? (float)dx2 / dy2 : 0;
+        float slope3 = dy3 ? (float)dx3 / dy3 : 0;
+
+        for (int y = y1; y <= y2; y++)
+        {
+            int x_start = x1 + (y - y1) * slope1;
+            int x_end = x1 + (y - y1) * slope2;
+            if (x_start > x_end)
+            {
+                int tmp = x_start;
+                x_start = x_end;
+                x_end = tmp;
+            }
+            for (int x = x_start; x <= x_end; x++)
+            {
+                nnDrawPixel(pixmap, x, y, color);
+            }
+        }
+        for (int y = y2; y <= y3; y++)
+        {
+            int x_start = x2 + (y - y2) * slope3;
+            int x_end = x1 + (y - y1) * slope2;
+            if (x_start > x_end)
+            {
+                int tmp = x_start;
+                x_start = x_end;
+                x_end = tmp;
+            }
+            for (int x = x_start; x <= x_end; x++)
+            {
+                nnDrawPixel(pixmap, x, y, color);
+            }
+        }
+    }
+    else
+    {
+        nnDrawLine(pixmap, x1, y1, x2, y2, color);
+        nnDrawLine(pixmap, x2, y2, x3, y3, color);
+        nnDrawLine(pixmap, x3, y3, x1, y1, color);
+    }
+}
+
+void nnDrawRect(nnPixmap *pixmap, int x, int y, int width, int height, nnColorf color, bool filled)
+{
+    if (!pixmap)
+        return;
+
+    if (filled)
+    {
+        for (int i = 0; i < height; i++)
+        {
+            for (int j = 0; j < width; j++)
+            {
+                nnDrawPixel(pixmap, x + j, y + i, color);
+            }
+        }
+    }
+    else
+    {
+        nnDrawLine(pixmap, x, y, x + width, y, color);                   // Top
+        nnDrawLine(pixmap, x, y + height, x + width, y + height, color); // Bottom
+        nnDrawLine(pixmap, x, y, x, y + height, color);                  // Left
+        nnDrawLine(pixmap, x + width, y, x + width, y + height, color);  // Right
+    }
+}
+
+// Blends a color over a pixel with `coverage` out of 256 of the pixel covered
+static void _nnBlendPixel(nnColorf *pixel, nnColorf color, int coverage)
+{
+    float alpha = color.a * coverage * (1.0f / 256.0f);
+    if (pixel->a >= 1.0f)
+    {
+        // Opaque pixels stay opaque, the color is mixed in
+        pixel->r += (color.r - pixel->r) * alpha;
+        pixel->g += (color.g - pixel->g) * alpha;
+        pixel->b += (color.b - pixel->b) * alpha;
+        return;
+    }
+
+    float keep = pixel->a * (1.0f - alpha);
+    float outAlpha = alpha + keep;
+    if (outAlpha <= 0.0f)
+        return;
+
+    float scale = 1.0f / outAlpha;
+    pixel->r = (color.r * alpha + pixel->r * keep) * scale;
+    pixel->g = (color.g * alpha + pixel->g * keep) * scale;
+    pixel->b = (color.b * alpha + pixel->b * keep) * scale;
+    pixel->a = outAlpha;
+}
+
+// Blends a color over `count` pixels of a row that are covered alike
+static void _nnBlendSpan(nnColorf *pixels, int count, nnColorf color, int coverage)
+{
+    if (coverage >= 256 && color.a >= 1.0f)
+    {
+        for (int i = 0; i < count; i++)
+            pixels[i] = color;
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+        _nnBlendPixel(&pixels[i], color, coverage);
+}
+
+// Converts a coverage between 0 and 1 to the 0 to 256 the blending takes
+static int _nnCoverage(float coverage)
+{
+    return coverage <= 0.0f ? 0 : (coverage >= 1.0f ? 256 : (int)(coverage * 256.0f + 0.5f));
+}
+
+// Draws a line of at most one pixel with Xiaolin Wu's algorithm: along the major axis every step blends two pixels, split by where the line
+// passes between them. The line is clipped to the pixmap first, the minor position is stepped in 16.16 fixed point.
+static void _nnDrawWuLine(nnPixmap *pixmap, float x0, float y0, float x1, float y1, int weight, nnColorf color)
+{
+    bool steep = fabsf(y1 - y0) > fabsf(x1 - x0);
+    if (steep)
+    {
+        float swap = x0;
+        x0 = y0;
+        y0 = swap;
+        swap = x1;
+        x1 = y1;
+        y1 = swap;
+    }
+    if (x0 > x1)
+    {
+        float swap = x0;
+        x0 = x1;
+        x1 = swap;
+        swap = y0;
+        y0 = y1;
+        y1 = swap;
+    }
+
+    // u runs along the major axis, v along the minor one. Pixel centers are at whole coordinates, rows are stored bottom up.
+    int majorSize = steep ? pixmap->height : pixmap->width;
+    int minorSize = steep ? pixmap->width : pixmap->height;
+    nnColorf *base = pixmap->pixels + (size_t)(pixmap->height - 1) * pixmap->width;
+    int majorStride = steep ? -pixmap->width : 1;
+    int minorStride = steep ? 1 : -pixmap->width;
+
+    float gradient = x1 > x0 ? (y1 - y0) / (x1 - x0) : 0.0f;
+    float uMin = -0.5f, uMax = majorSize - 0.501f;
+    if (gradient > 0.0f)
+    {
+        uMin = fmaxf(uMin, x0 + (-1.0f - y0) / gradient);
+        uMax = fminf(uMax, x0 + (minorSize - y0) / gradient);
+    }
+    else if (gradient < 0.0f)
+    {
+        uMin = fmaxf(uMin, x0 + (minorSize - y0) / gradient);
+        uMax = fminf(uMax, x0 + (-1.0f - y0) / gradient);
+    }
+    else if (y0 < -1.0f || y0 > minorSize)
+    {
+        return;
+    }
+
+    float start = fmaxf(x0, uMin);
+    float end = fminf(x1, uMax);
+    if (start > end)
+        return;
+
+    // The first and last pixel are covered as far as the line reaches into them
+    int u0 = (int)floorf(start + 0.5f);
+    int u1 = (int)floorf(end + 0.5f);
+    float firstWeight = fminf(u0 + 0.5f, end) - start;
+    float lastWeight = end - fmaxf(u1 - 0.5f, start);
+
+    // The minor position is kept two pixels higher, so it stays positive and shifts round down
+    long long v = (long long)((y0 + gradient * (u0 - x0) + 2.0f) * 65536.0f);
+    long long step = (long long)(gradient * 65536.0f);
+    nnColorf scratch = {0.0f, 0.0f, 0.0f, 0.0f}; // Takes the half of a step that falls just outside the pixmap
+    for (int u = u0; u <= u1; u++, v += step)
+    {
+        int row = (int)(v >> 16) - 2;
+        int fraction = (int)(v >> 8) & 255;
+        int coverage = weight;
+        if (u == u0)
+            coverage = (int)(coverage * firstWeight);
+        else if (u == u1)
+            coverage = (int)(coverage * lastWeight);
+
+        nnColorf *pixel = base + (ptrdiff_t)u * majorStride;
+        _nnBlendPixel((unsigned)row < (unsigned)minorSize ? pixel + (ptrdiff_t)row * minorStride : &scratch, color, ((256 - fraction) * coverage) >> 8);
+        _nnBlendPixel((unsigned)(row + 1) < (unsigned)minorSize ? pixel + (ptrdiff_t)(row + 1) * minorStride : &scratch, color, (fraction * coverage) >> 8);
+    }
+}
+
+// Draws a line thicker than a pixel as a rectangle with flat ends. Each row is clipped to the span the rectangle covers, along it the distances
+// to the center line and to its middle are stepped in 16.16 fixed point and give the coverage of each pixel.
+static void _nnDrawThickLine(nnPixmap *pixmap, float x0, float y0, float x1, float y1, float thickness, nnColorf color)
+{
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f)
+        return;
+
+    float ux = dx / length, uy = dy / length;
+    float mx = (x0 + x1) * 0.5f, my = (y0 + y1) * 0.5f;
+    float reachAlong = length * 0.5f + 0.5f; // Half extents grown by half a pixel, pixels up to there are partly covered
+    float reachAcross = thickness * 0.5f + 0.5f;
+
+    float extentY = fabsf(uy) * reachAlong + fabsf(ux) * reachAcross;
+    int top = (int)ceilf(my - extentY);
+    int bottom = (int)floorf(my + extentY);
+    top = top < 0 ? 0 : top;
+    bottom = bottom >= pixmap->height ? pixmap->height - 1 : bottom;
+
+    long long limitAlong = (long long)(reachAlong * 65536.0f);
+    long long limitAcross = (long long)(reachAcross * 65536.0f);
+    long long stepAlong = (long long)(ux * 65536.0f);
+    long long stepAcross = (long long)(-uy * 65536.0f);
+    for (int y = top; y <= bottom; y++)
+    {
+        // Where the row is within reach of the line along it and across it
+        float ry = y - my;
+        float left = -1e9f, right = 1e9f;
+        if (fabsf(ux) > 1e-6f)
+        {
+            float a = (-reachAlong - ry * uy) / ux, b = (reachAlong - ry * uy) / ux;
+            left = fmaxf(left, fminf(a, b));
+            right = fminf(right, fmaxf(a, b));
+        }
+        else if (fabsf(ry * uy) >= reachAlong)
+        {
+            continue;
+        }
+        if (fabsf(uy) > 1e-6f)
+        {
+            float a = (ry * ux - reachAcross) / uy, b = (ry * ux + reachAcross) / uy;
+            left = fmaxf(left, fminf(a, b));
+            right = fminf(right, fmaxf(a, b));
+        }
+        else if (fabsf(ry * ux) >= reachAcross)
+        {
+            continue;
+        }
+
+        int from = (int)ceilf(mx + left);
+        int to = (int)floorf(mx + right);
+        from = from < 0 ? 0 : from;
+        to = to >= pixmap->width ? pixmap->width - 1 : to;
+        if (from > to)
+            continue;
+
+        float rx = from - mx;
+        long long along = (long long)((rx * ux + ry * uy) * 65536.0f);
+        long long across = (long long)((-rx * uy + ry * ux) * 65536.0f);
+        nnColorf *pixel = &pixmap->pixels[(size_t)(pixmap->height - 1 - y) * pixmap->width + from];
+        for (int x = from; x <= to; x++, pixel++, along += stepAlong, across += stepAcross)
+        {
+            long long coverAlong = (limitAlong - (along < 0 ? -along : along)) >> 8;
+            long long coverAcross = (limitAcross - (across < 0 ? -across : across)) >> 8;
+            coverAlong = coverAlong < 0 ? 0 : (coverAlong > 256 ? 256 : coverAlong);
+            coverAcross = coverAcross < 0 ? 0 : (coverAcross > 256 ? 256 : coverAcross);
+            _nnBlendPixel(pixel, color, (int)((coverAlong * coverAcross) >> 8));
+        }
+    }
+}
+
+// Approximate distance of a point relative to the center from the edge of an ellipse, negative inside
+static float _nnEllipseDistance(float x, float y, float a, float b)
+{
+    if (a == b)
+        return sqrtf(x * x + y * y) - a;
+
+    // The implicit function divided by the length of its gradient, close to the true distance near the edge
+    float a2 = a * a, b2 = b * b;
+    float f = x * x / a2 + y * y / b2 - 1.0f;
+    float gx = 2.0f * x / a2, gy = 2.0f * y / b2;
+    float g = sqrtf(gx * gx + gy * gy);
+    if (g <= 0.0f)
+        return -fminf(a, b);
+
+    // Far from the edge of a thin ellipse the estimate falls short. Outside, the distance to the bounding box is a lower bound.
+    float distance = f / g;
+    return f > 0.0f ? fmaxf(distance, fmaxf(fabsf(x) - a, fabsf(y) - b)) : distance;
+}
+
+// Half the width of an ellipse at height y relative to its center, negative if the row misses it
+static float _nnEllipseHalfWidth(float y, float a, float b)
+{
+    if (a <= 0.0f || b <= 0.0f || fabsf(y) >= b)
+        return -1.0f;
+    return a * sqrtf(1.0f - (y * y) / (b * b));
+}
+
+// Coverage (0..256) of the pixel at x in a row of an oval, by its distance from the edge
+static int _nnOvalCoverage(int x, float cx, float ry, float a, float b, bool filled)
+{
+    float distance = _nnEllipseDistance(x - cx, ry, a, b);
+    return _nnCoverage(filled ? 0.5f - distance : 1.0f - fabsf(distance + 0.5f));
+}
+
+// Blends the pixels from..to of a row of an oval by their distance from its edge
+static void _nnBlendOvalEdge(nnColorf *row, int from, int to, float cx, float ry, float a, float b, nnColorf color, bool filled)
+{
+    for (int x = from; x <= to; x++)
+        _nnBlendPixel(&row[x], color, _nnOvalCoverage(x, cx, ry, a, b, filled));
+}
+
+void nnDrawLineAA(nnPixmap *pixmap, float x0, float y0, float x1, float y1, float thickness, nnColorf color)
+{
+    if (!pixmap || !pixmap->pixels || thickness <= 0.0f)
+        return;
+
+    // Hairlines are drawn fainter instead of thinner
+    if (thickness <= 1.0f)
+        _nnDrawWuLine(pixmap, x0, y0, x1, y1, _nnCoverage(thickness), color);
+    else
+        _nnDrawThickLine(pixmap, x0, y0, x1, y1, thickness, color);
+}
+
+void nnDrawOvalAA(nnPixmap *pixmap, float x, float y, float width, float height, nnColorf color, bool filled)
+{
+    if (!pixmap || !pixmap->pixels || width <= 0.0f || height <= 0.0f)
+        return;
+
+    float a = width * 0.5f;
+    float b = height * 0.5f;
+    int top = (int)ceilf(y - b - 1.0f);
+    int bottom = (int)floorf(y + b + 1.0f);
+    top = top < 0 ? 0 : top;
+    bottom = bottom >= pixmap->height ? pixmap->height - 1 : bottom;
+
+    // Every row has an outer span of partly covered pixels around an inner one: fully covered for filled ovals, empty for outlines.
+    // Only the pixels in between are measured, the inner span of a filled oval is blended in one go. The spans are estimated from
+    // ellipses grown and shrunk by the edge width. Those are not at a constant distance from the edge, so the estimates are
+    // corrected by measuring pixels until the coverage changes.
+    float innerShrink = filled ? 0.5f : 1.5f;
+    int innerCoverage = filled ? 256 : 0;
+    for (int row = top; row <= bottom; row++)
+    {
+        float ry = row - y;
+        float outer = _nnEllipseHalfWidth(ry, a + 0.5f, b + 0.5f);
+        int from = outer < 0.0f ? (int)floorf(x + 0.5f) : (int)ceilf(x - outer);
+        int to = outer < 0.0f ? from : (int)floorf(x + outer);
+        from = from < 0 ? 0 : (from >= pixmap->width ? pixmap->width - 1 : from);
+        to = to < 0 ? 0 : (to >= pixmap->width ? pixmap->width - 1 : to);
+        while (from > 0 && _nnOvalCoverage(from - 1, x, ry, a, b, filled) > 0)
+            from--;
+        while (to < pixmap->width - 1 && _nnOvalCoverage(to + 1, x, ry, a, b, filled) > 0)
+            to++;
+        if (from > to)
+            continue;
+
+        nnColorf *pixels = &pixmap->pixels[(size_t)(pixmap->height - 1 - row) * pixmap->width];
+        float inner = _nnEllipseHalfWidth(ry, a - innerShrink, b - innerShrink);
+        int innerFrom = inner < 0.0f ? to + 1 : (int)ceilf(x - inner);
+        int innerTo = inner < 0.0f ? to : (int)floorf(x + inner);
+        innerFrom = innerFrom < from ? from : innerFrom;
+        innerTo = innerTo > to ? to : innerTo;
+        while (innerFrom <= innerTo && _nnOvalCoverage(innerFrom, x, ry, a, b, filled) != innerCoverage)
+            innerFrom++;
+        while (innerFrom <= innerTo && _nnOvalCoverage(innerTo, x, ry, a, b, filled) != innerCoverage)
+            innerTo--;
+
+        if (innerFrom > innerTo)
+        {
+            _nnBlendOvalEdge(pixels, from, to, x, ry, a, b, color, filled);
+            continue;
+        }
+
+        _nnBlendOvalEdge(pixels, from, innerFrom - 1, x, ry, a, b, color, filled);
+        if (filled)
+            _nnBlendSpan(&pixels[innerFrom], innerTo - innerFrom + 1, color, 256);
+        _nnBlendOvalEdge(pixels, innerTo + 1, to, x, ry, a, b, color, filled);
+    }
+}
+
+nnColorf nnReadPixel(nnPixmap *pixmap, int x, int y)
+{
+    if (!pixmap || x < 0 || y < 0 || x >= pixmap->width || y >= pixmap->height)
+    {
+        return (nnColorf){0, 0, 0, 0}; // Return transparent color for out-of-bounds or invalid pixmap
+    }
+
+    y = pixmap->height - 1 - y; // Adjust y-coordinate for top-left origin, like nnDrawPixel
+    return pixmap->pixels[y * pixmap->width + x];
+}
+
+// Blends a row of `count` source pixels into a row of the destination
+typedef void (*_nnBlitRowFunc)(nnColorf *dst, const nnColorf *src, int count);
+
+static void _nnBlitRowCopy(nnColorf *dst, const nnColorf *src, int count)
+{
+    memmove(dst, src, count * sizeof(nnColorf));
+}
+
+#ifdef _NN_SSE
+
+#define _NN_SPLAT_ALPHA(v) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(3, 3, 3, 3))
+
+static void _nnBlitRowAlpha(nnColorf *dst, const nnColorf *src, int count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    const __m128 tiny = _mm_set1_ps(1e-20f);
+    for (int i = 0; i < count; i++)
+    {
+        __m128 s = _mm_loadu_ps(&src[i].r);
+        __m128 d = _mm_loadu_ps(&dst[i].r);
+        __m128 sa = _NN_SPLAT_ALPHA(s);
+        if (dst[i].a >= 1.0f)
+        {
+            // Opaque pixels stay opaque, the color is mixed in without a division
+            __m128 color = _mm_add_ps(_mm_mul_ps(s, sa), _mm_mul_ps(d, _mm_sub_ps(one, sa)));
+            _mm_storeu_ps(&dst[i].r, _mm_or_ps(_mm_andnot_ps(alphaMask, color), _mm_and_ps(alphaMask, one)));
+            continue;
+        }
+
+        __m128 keep = _mm_mul_ps(_NN_SPLAT_ALPHA(d), _mm_sub_ps(one, sa));
+        __m128 outAlpha = _mm_add_ps(sa, keep);
+        __m128 color = _mm_div_ps(_mm_add_ps(_mm_mul_ps(s, sa), _mm_mul_ps(d, keep)), _mm_max_ps(outAlpha, tiny));
+        _mm_storeu_ps(&dst[i].r, _mm_or_ps(_mm_andnot_ps(alphaMask, color), _mm_and_ps(alphaMask, outAlpha)));
+    }
+}
+
+static void _nnBlitRowAdd(nnColorf *dst, const nnColorf *src, int count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 alphaOne = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    for (int i = 0; i < count; i++)
+    {
+        __m128 s = _mm_loadu_ps(&src[i].r);
+        __m128 d = _mm_loadu_ps(&dst[i].r);
+        __m128 scale = _mm_or_ps(_mm_andnot_ps(alphaMask, _NN_SPLAT_ALPHA(s)), alphaOne); // sa, sa, sa, 1
+        _mm_storeu_ps(&dst[i].r, _mm_min_ps(_mm_add_ps(d, _mm_mul_ps(s, scale)), one));
+    }
+}
+
+static void _nnBlitRowMultiply(nnColorf *dst, const nnColorf *src, int count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    for (int i = 0; i < count; i++)
+    {
+        __m128 s = _mm_loadu_ps(&src[i].r);
+        __m128 d = _mm_loadu_ps(&dst[i].r);
+        __m128 factor = _mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(s, one), _NN_SPLAT_ALPHA(s))); // 1 - sa + s * sa
+        factor = _mm_or_ps(_mm_andnot_ps(alphaMask, factor), _mm_and_ps(alphaMask, one));
+        _mm_storeu_ps(&dst[i].r, _mm_mul_ps(d, factor));
+    }
+}
+
+static void _nnBlitRowPremultiplied(nnColorf *dst, const nnColorf *src, int count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (int i = 0; i < count; i++)
+    {
+        __m128 s = _mm_loadu_ps(&src[i].r);
+        __m128 d = _mm_loadu_ps(&dst[i].r);
+        _mm_storeu_ps(&dst[i].r, _mm_add_ps(s, _mm_mul_ps(d, _mm_sub_ps(one, _NN_SPLAT_ALPHA(s)))));
+    }
+}
+
+#else
+
+static void _nnBlitRowAlpha(nnColorf *dst, const nnColorf *src, int count)
+{
+    for (int i = 0; i < count; i++)
+        _nnBlendPixel(&dst[i], src[i], 256);
+}
+
+static void _nnBlitRowAdd(nnColorf *dst, const nnColorf *src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float a = src[i].a;
+        dst[i].r = fminf(dst[i].r + src[i].r * a, 1.0f);
+        dst[i].g = fminf(dst[i].g + src[i].g * a, 1.0f);
+        dst[i].b = fminf(dst[i].b + src[i].b * a, 1.0f);
+        dst[i].a = fminf(dst[i].a + a, 1.0f);
+    }
+}
+
+static void _nnBlitRowMultiply(nnColorf *dst, const nnColorf *src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float a = src[i].a;
+        dst[i].r *= 1.0f - a + src[i].r * a;
+        dst[i].g *= 1.0f - a + src[i].g * a;
+        dst[i].b *= 1.0f - a + src[i].b * a;
+    }
+}
+
+static void _nnBlitRowPremultiplied(nnColorf *dst, const nnColorf *src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float keep = 1.0f - src[i].a;
+        dst[i].r = src[i].r + dst[i].r * keep;
+        dst[i].g = src[i].g + dst[i].g * keep;
+        dst[i].b = src[i].b + dst[i].b * keep;
+        dst[i].a = src[i].a + dst[i].a * keep;
+    }
+}
+
+#endif
+
+// Row kernels by nnBlendMode
+static const _nnBlitRowFunc _nnBlitRowFuncs[] = {_nnBlitRowCopy, _nnBlitRowAlpha, _nnBlitRowAdd, _nnBlitRowMultiply, _nnBlitRowPremultiplied};
+
+// Returns the kernel for a blend mode, NULL if the mode is unknown
+static _nnBlitRowFunc _nnGetBlitRowFunc(nnBlendMode mode)
+{
+    if ((int)mode < 0 || (int)mode >= (int)(sizeof(_nnBlitRowFuncs) / sizeof(_nnBlitRowFuncs[0])))
+    {
+        printf("Unknown blend mode %d.\n", (int)mode);
+        return NULL;
+    }
+    return _nnBlitRowFuncs[mode];
+}
+
+// Interpolates between the four pixels around a sample, `fx` and `fy` are the weights of the right and lower ones
+static nnColorf _nnBilinear(const nnColorf *topLeft, const nnColorf *topRight, const nnColorf *bottomLeft, const nnColorf *bottomRight, float fx, float fy)
+{
+#ifdef _NN_SSE
+    __m128 wx = _mm_set1_ps(fx);
+    __m128 wy = _mm_set1_ps(fy);
+    __m128 top = _mm_loadu_ps(&topLeft->r);
+    __m128 bottom = _mm_loadu_ps(&bottomLeft->r);
+    top = _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&topRight->r), top), wx));
+    bottom = _mm_add_ps(bottom, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&bottomRight->r), bottom), wx));
+    nnColorf result;
+    _mm_storeu_ps(&result.r, _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), wy)));
+    return result;
+#else
+    nnColorf result;
+    const float *tl = &topLeft->r, *tr = &topRight->r, *bl = &bottomLeft->r, *br = &bottomRight->r;
+    float *out = &result.r;
+    for (int c = 0; c < 4; c++)
+    {
+        float top = tl[c] + (tr[c] - tl[c]) * fx;
+        float bottom = bl[c] + (br[c] - bl[c]) * fx;
+        out[c] = top + (bottom - top) * fy;
+    }
+    return result;
+#endif
+}
+
+void nnBlitPixmap(nnPixmap *dst, nnPixmap *src, nnRecf srcRec, int x, int y, nnBlendMode mode)
+{
+    if (!dst || !src || !dst->pixels || !src->pixels)
+        return;
+
+    _nnBlitRowFunc blitRow = _nnGetBlitRowFunc(mode);
+    if (!blitRow)
+        return;
+
+    // Clip the source rectangle to the source, then to the destination, moving the target along
+    int sx = (int)srcRec.x, sy = (int)srcRec.y;
+    int width = (int)srcRec.width, height = (int)srcRec.height;
+    if (sx < 0)
+    {
+        width += sx;
+        x -= sx;
+        sx = 0;
+    }
+    if (sy < 0)
+    {
+        height += sy;
+        y -= sy;
+        sy = 0;
+    }
+    if (x < 0)
+    {
+        width += x;
+        sx -= x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        height += y;
+        sy -= y;
+        y = 0;
+    }
+    if (sx + width > src->width)
+        width = src->width - sx;
+    if (sy + height > src->height)
+        height = src->height - sy;
+    if (x + width > dst->width)
+        width = dst->width - x;
+    if (y + height > dst->height)
+        height = dst->height - y;
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Blitting within a pixmap reads rows it writes later, they are taken from a copy of the source rectangle
+    nnColorf *copy = NULL;
+    const nnColorf *source = src->pixels;
+    int sourceWidth = src->width, sourceHeight = src->height;
+    if (src == dst)
+    {
+        copy = malloc((size_t)width * height * sizeof(nnColorf));
+        if (!copy)
+        {
+            printf("Failed to allocate memory for blit.\n");
+            return;
+        }
+        for (int row = 0; row < height; row++)
+            memcpy(&copy[(size_t)(height - 1 - row) * width], &src->pixels[(size_t)(src->height - 1 - sy - row) * src->width + sx], width * sizeof(nnColorf));
+        source = copy;
+        sourceWidth = width;
+        sourceHeight = height;
+        sx = 0;
+        sy = 0;
+    }
+
+    // Rows are stored bottom up
+    for (int row = 0; row < height; row++)
+    {
+        nnColorf *target = &dst->pixels[(size_t)(dst->height - 1 - y - row) * dst->width + x];
+        blitRow(target, &source[(size_t)(sourceHeight - 1 - sy - row) * sourceWidth + sx], width);
+    }
+
+    free(copy);
+}
+
+void nnBlitPixmapScaled(nnPixmap *dst, nnPixmap *src, nnRecf srcRec, nnRecf dstRec, nnBlendMode mode, bool bilinear)
+{
+    if (!dst || !src || !dst->pixels || !src->pixels || srcRec.width <= 0.0f || srcRec.height <= 0.0f || dstRec.width <= 0.0f || dstRec.height <= 0.0f)
+        return;
+
+    _nnBlitRowFunc blitRow = _nnGetBlitRowFunc(mode);
+    if (!blitRow)
+        return;
+
+    // Target pixels whose centers lie in the destination rectangle, clipped to the destination
+    int left = (int)ceilf(dstRec.x - 0.5f), right = (int)ceilf(dstRec.x + dstRec.width - 0.5f);
+    int top = (int)ceilf(dstRec.y - 0.5f), bottom = (int)ceilf(dstRec.y + dstRec.height - 0.5f);
+    left = left < 0 ? 0 : left;
+    top = top < 0 ? 0 : top;
+    right = right > dst->width ? dst->width : right;
+    bottom = bottom > dst->height ? dst->height : bottom;
+
+    // Samples are clamped to the source rectangle clipped to the source, so nothing around it bleeds in
+    int minX = (int)floorf(srcRec.x), maxX = (int)ceilf(srcRec.x + srcRec.width) - 1;
+    int minY = (int)floorf(srcRec.y), maxY = (int)ceilf(srcRec.y + srcRec.height) - 1;
+    minX = minX < 0 ? 0 : minX;
+    minY = minY < 0 ? 0 : minY;
+    maxX = maxX >= src->width ? src->width - 1 : maxX;
+    maxY = maxY >= src->height ? src->height - 1 : maxY;
+    if (left >= right || top >= bottom || minX > maxX || minY > maxY)
+        return;
+
+    // A row is sampled into a buffer, then blended like an unscaled blit. The source position is stepped in 16.16 fixed point.
+    // Blitting within a pixmap samples from a copy of it.
+    int count = right - left;
+    nnColorf *row = malloc(count * sizeof(nnColorf));
+    nnColorf *copy = src == dst ? malloc((size_t)src->width * src->height * sizeof(nnColorf)) : NULL;
+    if (!row || (src == dst && !copy))
+    {
+        printf("Failed to allocate memory for blit.\n");
+        free(row);
+        free(copy);
+        return;
+    }
+    const nnColorf *pixels = src->pixels;
+    if (copy)
+    {
+        memcpy(copy, src->pixels, (size_t)src->width * src->height * sizeof(nnColorf));
+        pixels = copy;
+    }
+
+    float scaleX = srcRec.width / dstRec.width;
+    float scaleY = srcRec.height / dstRec.height;
+    float offset = bilinear ? 0.5f : 0.0f; // Bilinear samples are taken between the pixel centers around them
+    long long stepX = (long long)(scaleX * 65536.0f);
+    long long startX = (long long)((srcRec.x + (left + 0.5f - dstRec.x) * scaleX - offset) * 65536.0f);
+    for (int ty = top; ty < bottom; ty++)
+    {
+        float v = srcRec.y + (ty + 0.5f - dstRec.y) * scaleY - offset;
+        int y0 = (int)floorf(v);
+        float fy = v - y0;
+        int y1 = y0 + 1;
+        y0 = y0 < minY ? minY : (y0 > maxY ? maxY : y0);
+        y1 = y1 < minY ? minY : (y1 > maxY ? maxY : y1);
+        const nnColorf *row0 = &pixels[(size_t)(src->height - 1 - y0) * src->width];
+        const nnColorf *row1 = &pixels[(size_t)(src->height - 1 - y1) * src->width];
+
+        long long u = startX;
+        for (int i = 0; i < count; i++, u += stepX)
+        {
+            int x0 = (int)(u >> 16);
+            int x1 = x0 + 1;
+            x0 = x0 < minX ? minX : (x0 > maxX ? maxX : x0);
+            if (!bilinear)
+            {
+                row[i] = row0[x0];
+                continue;
+            }
+
+            x1 = x1 < minX ? minX : (x1 > maxX ? maxX : x1);
+            float fx = (float)(u & 0xffff) * (1.0f / 65536.0f);
+            row[i] = _nnBilinear(&row0[x0], &row0[x1], &row1[x0], &row1[x1], fx, fy);
+        }
+
+        blitRow(&dst->pixels[(size_t)(dst->height - 1 - ty) * dst->width + left], row, count);
+    }
+
+    free(row);
+    free(copy);
+}
+
+/*
+ * Text Rendering
+ */
+
+// Loads a size of a font file, sharing the face if the file is already loaded
+static nnFont *_nnLoadFontFile(const char *filepath, float fontSize, bool sdf)
+{
+    for (nnFontFace *face = _nnFontFaces; face; face = face->next)
+    {
+        if (face->path && strcmp(face->path, filepath) == 0)
+            return _nnLoadFaceSize(face, fontSize, sdf);
+    }
+
+    nnFileView fontFile;
+    if (!_nnMapFile(filepath, &fontFile))
+    {
+        printf("Failed to open font file: %s\n", filepath);
+        return NULL;
+    }
+
+    // The face keeps the file mapped
+    nnFontFace *face = _nnCreateFontFace(fontFile.data, fontFile.size, fontFile, filepath);
+    if (!face)
+        return NULL;
+
+    return _nnLoadFaceSize(face, fontSize, sdf);
+}
+
+// Loads a size of a font in memory, sharing the face if the same buffer with the same size is already loaded. The buffer is not
+// compared, so it must stay unchanged until every font loaded from it is freed.
+static nnFont *_nnLoadFontData(const unsigned char *data, size_t dataSize, float fontSize, bool sdf)
+{
+    if (!data)
+        return NULL;
+
+    for (nnFontFace *face = _nnFontFaces; face; face = face->next)
+    {
+        if (!face->path && face->fontBuffer == data && face->fontBufferSize == dataSize)
+            return _nnLoadFaceSize(face, fontSize, sdf);
+    }
+
+    nnFontFace *face = _nnCreateFontFace(data, dataSize, (nnFileView){0}, NULL);
+    if (!face)
+        return NULL;
+
+    return _nnLoadFaceSize(face, fontSize, sdf);
+}
+
+nnFont *nnLoadFont(const char *filepath, float fontSize)
+{
+    return _nnLoadFontFile(filepath, fontSize, false);
+}
+
+nnFont *nnLoadFontMem(const unsigned char *data, size_t dataSize, float fontSize)
+{
+    return _nnLoadFontData(data, dataSize, fontSize, false);
+}
+
+nnFont *nnLoadFontSDF(const char *filepath, float fontSize)
+{
+    return _nnLoadFontFile(filepath, fontSize, true);
+}
+
+nnFont *nnLoadFontMemSDF(const unsigned char *data, size_t dataSize, float fontSize)
+{
+    return _nnLoadFontData(data, dataSize, fontSize, true);
+}
+
+void nnSetFont(nnFont *font)
+{
+    if (!font)
+        return;
+
+    _nnstate.font = font;
+}
+
+nnFont *nnGetFont()
+{
+    // The default font is only created once text is used without a font being set
+    if (!_nnstate.font)
+    {
+        if (!_nnstate.defaultFont)
+            _nnstate.defaultFont = _nnLoadDefaultFont();
+        _nnstate.font = _nnstate.defaultFont;
+    }
+
+    return _nnstate.font;
+}
+
+void nnSetFontSize(float size)
+{
+    if (size <= 0.0f)
+    {
+        printf("Invalid font size: %g\n", size);
+        return;
+    }
+
+    nnFont *font = nnGetFont();
+    if (!font || font->size == size)
+        return;
+
+    nnFont *sized = _nnGetFaceSize(font->face, size, font->sdf);
+    if (sized)
+    {
+        sized->kept = true;
+        _nnstate.font = sized;
+    }
+}
+
+float nnGetFontSize()
+{
+    nnFont *font = nnGetFont();
+    if (!font)
+        return 0.0f;
+
+    return font->size;
+}
+
+void nnSetFontOversampling(bool enabled)
+{
+    _nnFontOversampling = enabled ? 2 : 1;
+}
+
+void nnSetFontKerning(bool enabled)
+{
+    _nnFontKerning = enabled;
+}
+
+nnFontAtlasStats nnFontAtlasStatistics()
+{
+    nnFontAtlasStats stats = {0};
+    stats.pages = _nnAtlasPageCount;
+
+    for (int i = 0; i < _nnAtlasPageCount; i++)
+    {
+        _nnAtlasPage *page = &_nnAtlasPages[i];
+        if (page->glyphs)
+            stats.glyphPages++;
+
+        stats.totalPixels += (size_t)page->width * page->height;
+        stats.bytes += (size_t)page->width * page->height * _nnAtlasPixelSize(page);
+        for (int j = 0; j < page->shelfCount; j++)
+            stats.usedPixels += (size_t)page->shelves[j].x * page->shelves[j].height;
+    }
+
+    stats.utilization = stats.totalPixels > 0 ? (float)stats.usedPixels / stats.totalPixels : 0.0f;
+    return stats;
+}
+
+void nnDrawText(const char *format, int x, int y, ...)
+{
+    if (!format)
+        return;
+
+    va_list args;
+    va_start(args, y);
+    _nnDrawTextVA(format, x, y, 0.0f, args);
+    va_end(args);
+}
+
+void nnDrawTextZ(const char *format, int x, int y, float zIndex, ...)
+{
+    if (!format)
+        return;
+
+    va_list args;
+    va_start(args, zIndex);
+    _nnDrawTextVA(format, x, y, zIndex, args);
+    va_end(args);
+}
+
+void nnDrawDebugText(const char *format, int x, int y, ...)
+{
+    if (!_nnstate.debugMode)
+        return;
+
+    if (!format)
+        return;
+
+    // The text is formatted straight into the frame's buffer, lines that do not fit are dropped
+    int available = _NN_DEBUG_TEXT_BUFFER_SIZE - _nnDebugTextLength;
+    if (_nnDebugLineCount == _NN_MAX_DEBUG_LINES || available <= 1)
+        return;
+
+    va_list args;
+    va_start(args, y);
+    int length = vsnprintf(_nnDebugTextBuffer + _nnDebugTextLength, available, format, args);
+    va_end(args);
+
+    if (length <= 0)
+        return;
+    if (length >= available)
+        length = available - 1;
+
+    nnColorf color = _nnstate.currentDrawColor;
+    _nnDebugLine *line = &_nnDebugLines[_nnDebugLineCount++];
+    line->x = x;
+    line->y = y;
+    line->color[0] = color.r;
+    line->color[1] = color.g;
+    line->color[2] = color.b;
+    line->color[3] = color.a;
+    line->offset = _nnDebugTextLength;
+    line->length = length;
+    _nnDebugTextLength += length;
+}
+
+void nnDrawTextN(const char *text, size_t length, int x, int y)
+{
+    if (!text)
+        return;
+
+    _nnDrawTextN(text, length, x, y, 0.0f);
+}
+
+float nnTextWidth(const char *format, ...)
+{
+    if (!format)
+    {
+        return 0.0f; // Return 0 for null text
+    }
+
+    char buffer[1024];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0)
+        return 0.0f;
+
+    return nnTextWidthN(buffer, length < (int)sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1);
+}
+
+float nnTextWidthN(const char *text, size_t length)
+{
+    if (!text)
+    {
+        return 0.0f; // Return 0 for null text
+    }
+
+    nnFont *font = nnGetFont();
+    if (!font)
+    {
+        printf("No font set. Returning default text width as 0.\n");
+        return 0.0f;
+    }
+
+    float width = 0.0f;
+    int previous = 0;
+    const char *end = text + length;
+    for (const char *c = text; c < end;)
+    {
+        int codepoint = _nnDecodeUTF8(&c, end);
+        if (codepoint < 32)
+        {
+            previous = 0;
+            continue; // Skip control characters
+        }
+
+        width += _nnKernAdvance(font, previous, codepoint) + _nnCodepointAdvance(font, codepoint);
+        previous = codepoint;
+    }
+
+    return width;
+}
+
+float nnTextHeight()
+{
+    nnFont *font = nnGetFont();
+    if (!font)
+    {
+        printf("No font set. Returning default glyph height as 0.\n");
+        return 0.0f;
+    }
+    return font->glyphHeight;
+}
+
+void nnFreeFont(nnFont *font)
+{
+    if (!font)
+        return;
+
+    // The face and all of its sizes are freed once none of its sizes is used anymore
+    nnFontFace *face = font->face;
+    font->refCount--;
+    if (--face->refCount <= 0)
+    {
+        _nnFreeFontFace(face);
+        return;
+    }
+
+    // A size nothing uses anymore gives its atlas space and glyphs back, unless nnSetFontSize cached it
+    if (font->refCount > 0 || font->kept)
+        return;
+
+    for (nnFont **link = &face->sizes; *link; link = &(*link)->nextSize)
+    {
+        if (*link == font)
+        {
+            *link = font->nextSize;
+            break;
+        }
+    }
+    _nnFreeFontSize(font);
+}
+
+nnText *nnCreateText(nnFont *font, const char *text)
+{
+    if (!text)
+        return NULL;
+
+    if (!font)
+        font = nnGetFont();
+    if (!font)
+    {
+        printf("No font set. Cannot create text.\n");
+        return NULL;
+    }
+
+    nnText *object = calloc(1, sizeof(nnText));
+    if (!object)
+    {
+        printf("Failed to allocate memory for text.\n");
+        return NULL;
+    }
+
+    object->font = font;
+    object->length = strlen(text);
+    object->text = malloc(object->length + 1);
+    if (!object->text)
+    {
+        printf("Failed to allocate memory for text.\n");
+        free(object);
+        return NULL;
+    }
+    memcpy(object->text, text, object->length + 1);
+
+    // The text keeps its font alive, the reference is released in nnFreeText
+    _nnRetainFont(font);
+
+    if (!_nnLayoutTextObject(object))
+    {
+        nnFreeText(object);
+        return NULL;
+    }
+
+    return object;
+}
+
+void nnDrawTextObject(nnText *text, int x, int y)
+{
+    if (!text)
+        return;
+
+    if (text->atlasGeneration != _nnAtlasGeneration && !_nnLayoutTextObject(text))
+        return;
+
+    if (text->runCount == 0)
+        return;
+
+    // Glyphs rasterized on demand stay in the atlas as long as the text is drawn
+    for (int i = 0; i < text->shelfCount; i++)
+        _nnAtlasPages[text->shelves[i].page].shelves[text->shelves[i].shelf].lastUsed = _nnstate.frameCount;
+
+    // Quads queued before are drawn first, so the text ends up on top of them
+    _nnFlushBatch();
+
+    glPushMatrix();
+    glTranslatef((float)x, (float)y, 0.0f);
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+    glEnable(GL_TEXTURE_2D);
+    if (text->font->sdf)
+        _nnBeginSDFText();
+
+    // With a vertex buffer bound, the pointers are offsets into it
+    const char *vertices = (const char *)text->vertices;
+    if (text->buffer)
+        _nnBindBuffer(GL_ARRAY_BUFFER, text->buffer);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(_nnTextVertex), vertices);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(_nnTextVertex), vertices + offsetof(_nnTextVertex, s));
+    for (int i = 0; i < text->runCount; i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, _nnAtlasPages[text->runs[i].page].textureID);
+        glDrawArrays(GL_QUADS, text->runs[i].first, text->runs[i].count);
+    }
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    if (text->buffer)
+        _nnBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (text->font->sdf)
+        _nnEndSDFText();
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+    glPopMatrix();
+}
+
+float nnTextObjectWidth(nnText *text)
+{
+    return text ? text->width : 0.0f;
+}
+
+float nnTextObjectHeight(nnText *text)
+{
+    return text ? text->font->glyphHeight : 0.0f;
+}
+
+void nnFreeText(nnText *text)
+{
+    if (!text)
+        return;
+
+    if (text->buffer)
+        _nnDeleteBuffers(1, &text->buffer);
+    free(text->vertices);
+    free(text->shelves);
+    free(text->text);
+    nnFreeFont(text->font);
+    free(text);
+}
+
+/*
+ * Collision Handling
+ */
+
+bool nnPosRecOverlaps(int x, int y, nnRecf rec)
+{
+    return (x >= rec.x && x <= rec.x + rec.width && y >= rec.y && y <= rec.y + rec.height) ? true : false;
+}
+
+bool nnRecsOverlap(nnRecf rec1, nnRecf rec2)
+{
+    return (rec1.x < rec2.x + rec2.width && rec1.x + rec1.width > rec2.x && rec1.y < rec2.y + rec2.height && rec1.y + rec1.height > rec2.y) ? true : false;
+}
+
+bool nnPosCircleOverlaps(int x, int y, int cx, int cy, float circleRadius)
+{
+    float dx = x - cx;
+    float dy = y - cy;
+    return (dx * dx + dy * dy <= circleRadius * circleRadius) ? true : false;
+}
+
+bool nnRecCircleOverlaps(nnRecf rec, int cx, int cy, float circleRadius)
+{
+    // Find the closest point on the rectangle to the circle center
+    float closestX = (cx < rec.x) ? rec.x : (cx > rec.x + rec.width) ? rec.x + rec.width
+                                                                     : cx;
+    float closestY = (cy < rec.y) ? rec.y : (cy > rec.y + rec.height) ? rec.y + rec.height
+                                                                      : cy;
+
+    // Calculate the distance between the circle center and this closest point
+    float dx = cx - closestX;
+    float dy = cy - closestY;
+
+    return (dx * dx + dy * dy <= circleRadius * circleRadius) ? true : false;
+}
+
+bool nnCirclesOverlaps(int cx1, int cy1, float circle1Radius, int cx2, int cy2, float circle2Radius)
+{
+    float dx = cx1 - cx2;
+    float dy = cy1 - cy2;
+    float distanceSquared = dx * dx + dy * dy;
+    float radiusSum = circle1Radius + circle2Radius;
+    return (distanceSquared <= radiusSum * radiusSum) ? true : false;
+}
+
+/*
+ * Input Handling
+ */
+//// Keyboard Input
+bool nnKeyHit(int key)
+{
+    if (key < _NN_MAX_KEYS) // Normal key
+    {
+        return _nnstate.keysPressed[key];
+    }
+    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+    {
+        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
+        return _nnstate.skeysPressed[specialKey];
+    }
+    return false; // Invalid key
+}
+
+bool nnKeyDown(int key)
+{
+    if (key < _NN_MAX_KEYS) // Normal key
+    {
+        return _nnstate.keys[key];
+    }
+    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+    {
+        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
+        return _nnstate.skeys[specialKey];
+    }
+    return false; // Invalid key
+}
+
+bool nnKeyReleased(int key)
+{
+    if (key < _NN_MAX_KEYS) // Normal key
+    {
+        return _nnstate.keysReleased[key];
+    }
+    else if (key < _NN_MAX_KEYS + _NN_MAX_KEYS) // Special key
+    {
+        int specialKey = key - _NN_MAX_KEYS; // Map to special key range
+        return _nnstate.skeysReleased[specialKey];
+    }
+    return false; // Invalid key
+}
+
+//// Mouse Input
+
+bool nnMouseHit(int button)
+{
+    bool wasPressed = _nnstate.mouseButtonsPressed[button];
+    return wasPressed;
+}
+
+bool nnMouseDown(int button)
+{
+    return _nnstate.mouseButtons[button];
+}
+
+bool nnMouseReleased(int button)
+{
+    bool wasReleased = _nnstate.mouseButtonsReleased[button];
+    return wasReleased;
+}
+
+int nnMouseWheelDelta()
+{
+    int delta = _nnstate.mouseWheelDelta;
+    return delta;
+}
+
+nnPos nnMousePosition()
+{
+    return _nnstate.mousePosition;
+}
+
+nnPos nnMouseMotionDelta()
+{
+    nnPos delta = _nnstate.mouseMotionDelta;
+    return delta;
+}
+
+void nnFlushKeys()
+{
+    for (int key = 0; key < _NN_MAX_KEYS; key++)
+    {
+        _nnstate.keysPressed[key] = false;
+        _nnstate.keysReleased[key] = false;
+        _nnstate.skeysPressed[key] = false;
+        _nnstate.skeysReleased[key] = false;
+    }
+}
+
+void nnFlushMouse()
+{
+    for (int button = 0; button < _NN_MAX_MOUSE_BUTTONS; button++)
+    {
+        _nnstate.mouseButtonsPressed[button] = false;
+        _nnstate.mouseButtonsReleased[button] = false;
+    }
+}
+
+/*
+ * Utility
+ */
+
+unsigned char *nnLoadFileBytes(const char *filepath, int *size)
+{
+    FILE *file = fopen(filepath, "rb");
+    if (!file)
+    {
+        printf("Failed to open file:\n%s\n", filepath);
+        return NULL;
+    }
+
+    // The size is returned as an int, so larger files can't be loaded
+    long long length = _nnFileSize(file);
+    if (length < 0 || length > INT_MAX)
+    {
+        printf("File is too large to load: %s\n", filepath);
+        fclose(file);
+        return NULL;
+    }
+    *size = (int)length;
+
+    unsigned char *buffer = (unsigned char *)malloc(*size);
+    if (!buffer)
+    {
+        printf("Failed to allocate memory for file: %s\n", filepath);
+        fclose(file);
+        return NULL;
+    }
+
+    fread(buffer, 1, *size, file);
+    fclose(file);
+
+    return buffer;
+}
+
+void nnFreeFileBytes(unsigned char *buffer)
+{
+    if (buffer)
+    {
+        free(buffer);
+    }
+}
+
+nnFileView nnMapFile(const char *filepath)
+{
+    nnFileView view;
+    if (!_nnMapFile(filepath, &view))
+        printf("Failed to open file:\n%s\n", filepath);
+    return view;
+}
+
+void nnUnmapFile(nnFileView view)
+{
+    _nnUnmapFile(&view);
+}
+
+/*
+ * Archives (see tools/nnpack.c) are mapped as a whole. The table of contents is sorted by name, so files are found by binary search.
+ */
+
+#define _NN_ARCHIVE_HEADER_SIZE 16
+#define _NN_ARCHIVE_ENTRY_SIZE 24
+
+struct _nnArchive
+{
+    nnFileView view;
+    int fileCount;
+    const unsigned char *entries; // Table of contents
+    const char *names;            // String table
+};
+
+static unsigned long long _nnReadUint64(const unsigned char *bytes)
+{
+    return _nnReadUint32(bytes) | ((unsigned long long)_nnReadUint32(bytes + 4) << 32);
+}
+
+static const char *_nnArchiveEntryName(nnArchive *archive, int index)
+{
+    return archive->names + _nnReadUint32(archive->entries + (size_t)index * _NN_ARCHIVE_ENTRY_SIZE);
+}
+
+nnArchive *nnOpenArchive(const char *filepath)
+{
+    nnArchive *archive = calloc(1, sizeof(nnArchive));
+    if (!archive)
+    {
+        printf("Failed to allocate memory for archive.\n");
+        return NULL;
+    }
+
+    if (!_nnMapFile(filepath, &archive->view))
+    {
+        printf("Failed to open archive:\n%s\n", filepath);
+        free(archive);
+        return NULL;
+    }
+
+    // Validate the whole table of contents once, so lookups don't have to
+    const unsigned char *data = archive->view.data;
+    size_t size = archive->view.size;
+    bool valid = size >= _NN_ARCHIVE_HEADER_SIZE && memcmp(data, "NNPK", 4) == 0 && _nnReadUint32(data + 4) == 1;
+    if (valid)
+    {
+        unsigned long long fileCount = _nnReadUint32(data + 8);
+        unsigned long long stringTableSize = _nnReadUint32(data + 12);
+        unsigned long long stringTableOffset = _NN_ARCHIVE_HEADER_SIZE + fileCount * _NN_ARCHIVE_ENTRY_SIZE;
+        valid = fileCount <= 0x7fffffff && stringTableOffset + stringTableSize <= size && (stringTableSize == 0 || data[stringTableOffset + stringTableSize - 1] == '\0');
+        if (valid)
+        {
+            archive->fileCount = (int)fileCount;
+            archive->entries = data + _NN_ARCHIVE_HEADER_SIZE;
+            archive->names = (const char *)data + stringTableOffset;
+        }
+        for (int i = 0; valid && i < archive->fileCount; i++)
+        {
+            const unsigned char *entry = archive->entries + (size_t)i * _NN_ARCHIVE_ENTRY_SIZE;
+            unsigned long long nameOffset = _nnReadUint32(entry);
+            unsigned long long nameLength = _nnReadUint32(entry + 4);
+            unsigned long long dataOffset = _nnReadUint64(entry + 8);
+            unsigned long long dataSize = _nnReadUint64(entry + 16);
+            valid = nameOffset + nameLength < stringTableSize && archive->names[nameOffset + nameLength] == '\0' &&
+                    dataOffset <= size && dataSize <= size - dataOffset &&
+                    (i == 0 || strcmp(_nnArchiveEntryName(archive, i - 1), _nnArchiveEntryName(archive, i)) < 0);
+        }
+    }
+    if (!valid)
+    {
+        printf("Invalid archive:\n%s\n", filepath);
+        nnCloseArchive(archive);
+        return NULL;
+    }
+
+    return archive;
+}
+
+nnFileView nnArchiveFile(nnArchive *archive, const char *name)
+{
+    nnFileView view = {0};
+    if (!archive || !name)
+        return view;
+
+    int low = 0, high = archive->fileCount - 1;
+    while (low <= high)
+    {
+        int mid = low + (high - low) / 2;
+        int order = strcmp(name, _nnArchiveEntryName(archive, mid));
+        if (order == 0)
+        {
+            const unsigned char *entry = archive->entries + (size_t)mid * _NN_ARCHIVE_ENTRY_SIZE;
+            view.data = archive->view.data + _nnReadUint64(entry + 8);
+            view.size = (size_t)_nnReadUint64(entry + 16);
+            return view;
+        }
+        if (order < 0)
+            high = mid - 1;
+        else
+            low = mid + 1;
+    }
+
+    printf("File not found in archive: %s\n", name);
+    return view;
+}
+
+int nnArchiveFileCount(nnArchive *archive)
+{
+    return archive ? archive->fileCount : 0;
+}
+
+const char *nnArchiveFileName(nnArchive *archive, int index)
+{
+    if (!archive || index < 0 || index >= archive->fileCount)
+        return NULL;
+    return _nnArchiveEntryName(archive, index);
+}
+
+void nnCloseArchive(nnArchive *archive)
+{
+    if (!archive)
+        return;
+
+    _nnUnmapFile(&archive->view);
+    free(archive);
+}
+
+float nnLerp(float min, float max, float speed, float ease)
+{
+    // Static variables to maintain state between calls
+    static float currentValue = 0.0f;
+    static float direction = 1.0f; // 1.0f for increasing, -1.0f for decreasing
+
+    // Initialize currentValue on the first call
+    if (currentValue == 0.0f)
+    {
+        currentValue = min;
+    }
+
+    // Calculate the change per frame
+    float delta = speed * direction;
+
+    // Update the current value
+    currentValue += delta;
+
+    // Check bounds and reverse direction if necessary
+    if (currentValue > max)
+    {
+        currentValue = max;
+        direction = -1.0f;
+        currentValue -= delta * ease; // Smooth transition when changing direction
+    }
+    else if (currentValue < min)
+    {
+        currentValue = min;
+        direction = 1.0f;
+        currentValue += delta * 0.5f; // Smooth transition when changing direction
+    }
+
+    return currentValue;
+}
+
+void nnSetDebugMode(bool flag)
+{
+    _nnstate.debugMode = flag;
+}
+
+bool nnIsDebugMode()
+{
+    return _nnstate.debugMode;
+}
+
+/*
+ * GUI
+ */
+
+bool nnPanel(int x, int y, int width, int height)
+{
+    // Define the background and border colors
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;  // Background color
+    nnColorf borderColor = _nnCurrentTheme.borderColor; // Border color
+
+    nnPos mousePos = nnMousePosition();
+    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+
+    // Draw the background and the border
+    _nnBeginBatchedDraw();
+    _nnBatchRect(x, y, width, height, bgColor);
+    _nnBatchRectOutline(x, y, width, height, borderColor);
+    _nnEndBatchedDraw();
+
+    return hovered;
+}
+
+void nnLabel(const char *format, int x, int y, int width, int height, bool border, ...)
+{
+    if (!format)
+        return;
+
+    // Format the text
+    char buffer[1024];
+    va_list args;
+    va_start(args, border);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0)
+        return;
+
+    nnLabelN(buffer, length < (int)sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1, x, y, width, height, border);
+}
+
+void nnLabelN(const char *text, size_t length, int x, int y, int width, int height, bool border)
+{
+    nnFont *font = nnGetFont();
+    if (!text || !font)
+        return;
+
+    // Prepare to draw
+    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+
+    // The background, the border and all lines of text are drawn as one batch
+    _nnBeginBatchedDraw();
+
+    // Draw background and border if enabled
+    if (border)
+    {
+        _nnBatchRect(x, y, width, height, bgColor);
+        _nnBatchRectOutline(x, y, width, height, borderColor);
+    }
+
+    // Lines are views into the text, measured glyph by glyph while they are wrapped
+    const char *end = text + length;
+    const char *current = text;
+    int lineHeight = nnTextHeight() + 12;
+    int padding = 8;
+    int maxLines = (height - padding) / lineHeight;
+
+    int currentY = y;
+    int linesDrawn = 0;
+
+    while (current < end && linesDrawn < maxLines)
+    {
+        // Accumulate words into a line
+        const char *lineEnd = current;
+        const char *lastBreak = NULL;
+        const char *next = current;
+        float lineWidth = 0.0f;
+        int previous = 0;
+        bool isLastLine = (linesDrawn == maxLines - 1);
+
+        while (next < end)
+        {
+            const char *c = next;
+            int codepoint = _nnDecodeUTF8(&next, end);
+            if (codepoint >= 32)
+                lineWidth += _nnKernAdvance(font, previous, codepoint) + _nnCodepointAdvance(font, codepoint);
+            previous = codepoint;
+
+            // Break line on spaces or forced newlines
+            if (*c == ' ' || *c == '\n')
+                lastBreak = c;
+
+            // If the line is too wide, break it
+            if (lineWidth > width - padding) // Account for padding
+            {
+                if (!lastBreak) // No break point, force truncation
+                {
+                    next = c;
+                }
+                else // Break at the last space or newline
+                {
+                    lineEnd = lastBreak;
+                    next = lastBreak + 1;
+                }
+                break;
+            }
+
+            lineEnd = next;
+        }
+        const char *lineStart = current;
+        current = next;
+
+        // If this is the last line and there's more text, truncate it and add "..."
+        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        if (isLastLine && current < end)
+        {
+            float ellipsisWidth = nnTextWidthN("...", 3);
+            while (lineEnd > lineStart && nnTextWidthN(lineStart, lineEnd - lineStart) + ellipsisWidth > width - padding)
+            {
+                do
+                    lineEnd--;
+                while (lineEnd > lineStart && ((unsigned char)*lineEnd & 0xc0) == 0x80);
+            }
+            char line[256];
+            size_t lineLength = (size_t)(lineEnd - lineStart) < sizeof(line) - 3 ? (size_t)(lineEnd - lineStart) : sizeof(line) - 3;
+            memcpy(line, lineStart, lineLength);
+            memcpy(line + lineLength, "...", 3);
+            _nnDrawTextN(line, lineLength + 3, x + padding, currentY + padding, 0.0f);
+            break;
+        }
+
+        // Draw the line
+        _nnDrawTextN(lineStart, lineEnd - lineStart, x + padding, currentY + padding, 0.0f); // Add slight padding
+        currentY += lineHeight;
+        linesDrawn++;
+    }
+
+    _nnEndBatchedDraw();
+}
+
+int nnTextInput(char *buffer, int maxLength, int x, int y, int width, int height, const char *placeholder)
+{
+    _nnFlushBatch();
+
+    // Generate a unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize state
+    _nnTextInputState *state = NULL;
+    for (int i = 0; i < _nnTextInputStateCount; i++)
+    {
+        if (_nnTextInputStates[i].id == id)
+        {
+            state = &_nnTextInputStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnTextInputStateCount >= _NN_MAX_TEXTINPUT_STATES)
+        {
+            printf("Error: Too many text inputs! Increase _NN_MAX_TEXTINPUT_STATES.\n");
+            return -1;
+        }
+        state = &_nnTextInputStates[_nnTextInputStateCount++];
+        state->id = id;
+        state->cursorIndex = 0;
+        state->selectionStart = 0;
+        state->selectionEnd = 0;
+        state->hasFocus = false;
+        state->scrollOffsetX = 0.0f;
+        state->text[0] = '\0';
+
+        // Initialize the internal text state with the external buffer if provided
+        if (buffer && buffer[0] != '\0')
+        {
+            strncpy(state->text, buffer, sizeof(state->text) - 1);
+            state->text[sizeof(state->text) - 1] = '\0';
+            state->cursorIndex = strlen(state->text);
+        }
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_TEXTINPUT, state);
+
+    // Get mouse position and input states
+    nnPos mousePos = nnMousePosition();
+    bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+
+    // Focus handling
+    if (hovering && nnMouseReleased(0))
+    {
+        state->hasFocus = true;
+    }
+    else if (!hovering && nnMouseReleased(0))
+    {
+        state->hasFocus = false;
+    }
+
+    const int padding = 4;
+
+    // Text input handling (only if focused)
+    if (state->hasFocus)
+    {
+        const char *inputText = _nnFetchTextInput(); // Fetch input text
+        if (inputText && *inputText)
+        {
+            // Insert text at cursor position
+            int inputLength = strlen(inputText);
+            int remainingSpace = maxLength - strlen(state->text) - 1;
+
+            if (inputLength > remainingSpace)
+                inputLength = remainingSpace;
+
+            // Replace selected text or insert at cursor
+            if (state->selectionStart != state->selectionEnd)
+            {
+                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
+                state->cursorIndex = selStart;
+            }
+
+            // Insert new text
+            memmove(&state->text[state->cursorIndex + inputLength], &state->text[state->cursorIndex], strlen(&state->text[state->cursorIndex]) + 1);
+            memcpy(&state->text[state->cursorIndex], inputText, inputLength);
+            state->cursorIndex += inputLength;
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+        }
+
+        // Handle backspace
+        if (nnKeyHit(nnVK_BACKSPACE))
+        {
+            if (state->selectionStart != state->selectionEnd)
+            {
+                // Delete selected text
+                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
+                state->cursorIndex = selStart;
+            }
+            else if (state->cursorIndex > 0)
+            {
+                // Delete one character
+                memmove(&state->text[state->cursorIndex - 1], &state->text[state->cursorIndex], strlen(&state->text[state->cursorIndex]) + 1);
+                state->cursorIndex--;
+            }
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+        }
+
+        // Handle delete
+        if (nnKeyHit(nnVK_DELETE))
+        {
+            if (state->selectionStart != state->selectionEnd)
+            {
+                // Delete selected text
+                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
+                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
+                state->cursorIndex = selStart;
+            }
+            else if (state->cursorIndex < strlen(state->text))
+            {
+                // Delete one character to the right of the cursor
+                memmove(&state->text[state->cursorIndex], &state->text[state->cursorIndex + 1], strlen(&state->text[state->cursorIndex + 1]) + 1);
+            }
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+        }
+
+        // Handle arrow keys
+        if (nnKeyHit(nnVK_LEFT) && state->cursorIndex > 0)
+        {
+            state->cursorIndex--;
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+
+            // Ensure the cursor stays visible
+            float cursorX = x + padding + nnTextWidthN(state->text, state->cursorIndex);
+            if (cursorX < x + padding)
+            {
+                state->scrollOffsetX -= nnTextWidthN(&state->text[state->cursorIndex], 1);
+                if (state->scrollOffsetX < 0)
+                    state->scrollOffsetX = 0;
+            }
+        }
+
+        if (nnKeyHit(nnVK_RIGHT) && state->cursorIndex < strlen(state->text))
+        {
+            state->cursorIndex++;
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+
+            // Ensure the cursor stays visible
+            float cursorX = x + padding + nnTextWidthN(state->text, state->cursorIndex);
+            if (cursorX > x + width - padding)
+            {
+                state->scrollOffsetX += nnTextWidthN(&state->text[state->cursorIndex - 1], 1);
+            }
+        }
+
+        // Handle Home/End keys
+        if (nnKeyHit(nnVK_HOME))
+        {
+            state->cursorIndex = 0;
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+            state->scrollOffsetX = 0; // Scroll to the start
+        }
+
+        if (nnKeyHit(nnVK_END))
+        {
+            // Move cursor to the end of the actual text
+            state->cursorIndex = strlen(state->text);
+            state->selectionStart = state->selectionEnd = state->cursorIndex;
+
+            // Scroll to the end of the text
+            float textWidth = _nnStringWidth(state->text);
+            if (textWidth > width - padding * 2)
+            {
+                // If the text is wider than the visible width, scroll to the end
+                state->scrollOffsetX = textWidth - (width - padding * 2);
+            }
+            else
+            {
+                // If text fits, no need to scroll
+                state->scrollOffsetX = 0;
+            }
+        }
+    }
+
+    // Calculate text width and cursor position
+    float cursorX = x + padding + nnTextWidthN(state->text, state->cursorIndex);
+
+    // Adjust scroll offset for the cursor position
+    if (cursorX < x + padding)
+    {
+        // Cursor is left of the visible area
+        state->scrollOffsetX = nnTextWidthN(state->text, state->cursorIndex) - padding;
+    }
+    else if (cursorX > x + width - padding)
+    {
+        // Cursor is right of the visible area
+        state->scrollOffsetX = nnTextWidthN(state->text, state->cursorIndex) + padding - width;
+    }
+
+    // Draw text input background and border
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    nnColorf borderColor = state->hasFocus ? _nnCurrentTheme.primaryColor : _nnCurrentTheme.borderColor;
+
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glBegin(GL_QUADS);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw cursor
+    if (state->hasFocus)
+    {
+        // Calculate the width of the text up to the cursor position
+        float cursorDrawX = x + padding + nnTextWidthN(state->text, state->cursorIndex) - state->scrollOffsetX;
+
+        // Clamp the cursor position to the visible area
+        if (cursorDrawX < x + padding)
+        {
+            cursorDrawX = x + padding;
+        }
+        else if (cursorDrawX > x + width - padding)
+        {
+            cursorDrawX = x + width - padding;
+        }
+
+        // Draw the cursor line
+        glBegin(GL_LINES);
+        glVertex2f(cursorDrawX, y + padding);
+        glVertex2f(cursorDrawX, y + height - padding);
+        glEnd();
+    }
+
+    // Set scissor for clipping
+    glEnable(GL_SCISSOR_TEST);
+    _nnScissor(x + padding, y, width - padding * 2, height);
+
+    const char *placeholderText = state->text;
+    const bool hasEnteredText = strlen(state->text) > 0;
+    // Draw placeholder if textbox is empty and placeholder exists
+    if (!hasEnteredText && placeholder)
+    {
+        nnColorf placeholderColor = _nnCurrentTheme.textSecondaryColor;
+        glColor4f(placeholderColor.r, placeholderColor.g, placeholderColor.b, placeholderColor.a);
+        placeholderText = placeholder;
+        _nnDrawString(placeholderText, x + 4, y + (height - nnTextHeight()) / 2, 0.0f);
+    }
+    else if (hasEnteredText) // Otherwise the entered text
+    {
+        nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        _nnDrawString(state->text, x + padding - state->scrollOffsetX, y + (height - nnTextHeight()) / 2, 0.0f);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+
+    // Sync internal state back to external buffer
+    if (buffer)
+    {
+        strncpy(buffer, state->text, maxLength - 1);
+        buffer[maxLength - 1] = '\0';
+    }
+
+    return state->cursorIndex;
+}
+
+bool nnButton(const char *format, int x, int y, int width, int height, ...)
+{
+    if (!format)
+        return nnButtonN(NULL, 0, x, y, width, height);
+
+    char buffer[256];
+    va_list args;
+    va_start(args, height);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0)
+        length = 0;
+
+    return nnButtonN(buffer, length < (int)sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1, x, y, width, height);
+}
+
+bool nnButtonN(const char *text, size_t length, int x, int y, int width, int height)
+{
+    // Get mouse state
+    nnPos mousePos = nnMousePosition();
+    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+    bool pressed = hovered && nnMouseDown(0);
+    bool released = hovered && nnMouseReleased(0);
+
+    // Determine button color based on state
+    nnColorf bgColor = pressed ? _nnCurrentTheme.secondaryColorAccent
+                               : (hovered ? _nnCurrentTheme.primaryColorAccent
+                                          : _nnCurrentTheme.primaryColor);
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+
+    // Draw button background and border, the text joins their batch
+    _nnBeginBatchedDraw();
+    _nnBatchRect(x, y, width, height, bgColor);
+    _nnBatchRectOutline(x, y, width, height, borderColor);
+
+    // Draw button text
+    if (text)
+    {
+        int tw = (int)nnTextWidthN(text, length);
+        int th = (int)nnTextHeight();
+
+        // Calculate the true centered position
+        int textX = x + (width / 2 - tw / 2);
+        int textY = y + (height / 2 - th / 2);
+
+        // Draw the text
+        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        _nnDrawTextN(text, length, textX, textY, 0.0f);
+    }
+
+    _nnEndBatchedDraw();
+
+    nnSetColor(nnGetColor());
+
+    return released;
+}
+
+bool nnCheckbox(const char *format, bool isChecked, int x, int y, ...)
+{
+    char buffer[256];
+    int length = 0;
+    if (format)
+    {
+        va_list args;
+        va_start(args, y);
+        length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        if (length < 0)
+            length = 0;
+    }
+
+    return nnCheckboxN(buffer, length < (int)sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1, isChecked, x, y);
+}
+
+bool nnCheckboxN(const char *text, size_t length, bool isChecked, int x, int y)
+{
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize checkbox state
+    _nnCheckboxState *state = NULL;
+    for (int i = 0; i < _nnCheckboxStateCount; i++)
+    {
+        if (_nnCheckboxStates[i].id == id)
+        {
+            state = &_nnCheckboxStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnCheckboxStateCount >= _NN_MAX_CHECKBOX_STATES)
+        {
+            printf("Error: Too many checkboxes! Increase _NN_MAX_CHECKBOX_STATES.\n");
+            return -1;
+        }
+        state = &_nnCheckboxStates[_nnCheckboxStateCount++];
+        state->id = id;
+        state->isChecked = isChecked;
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_CHECKBOX, state);
+
+    // Dimensions for the checkbox
+    int checkboxSize = 20; // Square checkbox size
+    int spacing = 8;       // Space between checkbox and label
+    int margin = 1;        // Margin for the filled area
+
+    if (!text)
+        length = 0;
+
+    // Calculate text dimensions
+    float textWidth = nnTextWidthN(text, length);
+    float textHeight = nnTextHeight();
+
+    // Total clickable area
+    int clickableWidth = checkboxSize + spacing + (int)textWidth;
+    int clickableHeight = checkboxSize > textHeight ? checkboxSize : (int)textHeight;
+
+    // Get mouse state
+    nnPos mousePos = nnMousePosition();
+    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, clickableWidth, clickableHeight});
+    bool released = hovered && nnMouseReleased(0);
+
+    // Update checkbox state
+    if (released)
+    {
+        state->isChecked = !state->isChecked;
+    }
+
+    // Draw the checkbox
+    nnColorf boxColor = hovered ? _nnCurrentTheme.secondaryColorAccent
+                                : _nnCurrentTheme.secondaryColor;
+    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent
+                                 : _nnCurrentTheme.primaryColor;
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+
+    // Background and border of the checkbox, the label text joins their batch
+    _nnBeginBatchedDraw();
+    _nnBatchRect(x, y, checkboxSize, checkboxSize, boxColor);
+    _nnBatchRectOutline(x, y, checkboxSize, checkboxSize, borderColor);
+
+    // Fill the checkbox with a margin if checked
+    if (state->isChecked)
+    {
+        _nnBatchRect(x + margin, y + margin, checkboxSize - margin * 3, checkboxSize - margin * 3, fillColor);
+    }
+
+    // Draw the label text
+    int textX = x + checkboxSize + spacing;
+    int textY = y + (checkboxSize - textHeight) / 2; // Vertically center text with checkbox
+    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+
+    nnSetColor(nnGetColor());
+    if (text)
+        _nnDrawTextN(text, length, textX, textY, 0.0f);
+    _nnEndBatchedDraw();
+
+    return state->isChecked;
+}
+
+float nnHSlider(float min, float max, float initial, float step, int x, int y, int width)
+{
+    _nnFlushBatch();
+
+    if (min >= max)
+    {
+        printf("Error: min must be less than max.\n");
+        return 0;
+    }
+
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize slider state
+    _nnSliderState *state = NULL;
+    for (int i = 0; i < _nnSliderStateCount; i++)
+    {
+        if (_nnSliderStates[i].id == id)
+        {
+            state = &_nnSliderStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnSliderStateCount >= _NN_MAX_SLIDER_STATES)
+        {
+            printf("Error: Too many sliders! Increase _NN_MAX_SLIDER_STATES.\n");
+            return -1;
+        }
+        state = &_nnSliderStates[_nnSliderStateCount++];
+        state->id = id;
+        state->value = initial;
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_SLIDER, state);
+
+    float height = 16;
+
+    // Ensure the value is clamped between min and max
+    state->value = fmaxf(min, fminf(max, state->value));
+
+    // Get mouse state
+    nnPos mousePos = nnMousePosition();
+    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, 16});
+    bool dragging = hovered && nnMouseDown(0);
+
+    // Handle dragging
+    if (dragging)
+    {
+        float relativeX = mousePos.x - x;
+        float proportion = fmaxf(0, fminf(1, relativeX / width));
+        state->value = min + proportion * (max - min);
+        state->value = roundf(state->value / step) * step; // Apply step resolution
+    }
+
+    // Calculate the knob position
+    float proportion = (state->value - min) / (max - min);
+    int knobX = x + (int)(proportion * width);
+
+    // Draw the slider bar
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    // Draw the filled portion
+    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(fillColor.r, fillColor.g,
+              fillColor.b, fillColor.a);
+    glVertex2f(x, y);
+    glVertex2f(knobX, y);
+    glVertex2f(knobX, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw the unfilled portion
+    nnColorf unfilledColor = hovered ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(unfilledColor.r, unfilledColor.g,
+              unfilledColor.b, unfilledColor.a);
+    glVertex2f(knobX, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(knobX, y + height);
+    glEnd();
+
+    // Draw the border
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw the knob
+    nnColorf knobColor = hovered ? _nnCurrentTheme.borderColorAccent : _nnCurrentTheme.borderColor;
+    glBegin(GL_QUADS);
+    glColor4f(knobColor.r, knobColor.g,
+              knobColor.b, knobColor.a);
+    glVertex2f(knobX - 4, y - 2);
+    glVertex2f(knobX + 4, y - 2);
+    glVertex2f(knobX + 4, y + height + 2);
+    glVertex2f(knobX - 4, y + height + 2);
+    glEnd();
+
+    glDisable(GL_BLEND);
+
+    nnSetColor(nnGetColor());
+
+    return state->value;
+}
+
+float nnVSlider(float min, float max, float initial, float step, int x, int y, int height)
+{
+    _nnFlushBatch();
+
+    if (min >= max)
+    {
+        printf("Error: min must be less than max.\n");
+        return 0;
+    }
+
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize slider state
+    _nnSliderState *state = NULL;
+    for (int i = 0; i < _nnSliderStateCount; i++)
+    {
+        if (_nnSliderStates[i].id == id)
+        {
+            state = &_nnSliderStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnSliderStateCount >= _NN_MAX_SLIDER_STATES)
+        {
+            printf("Error: Too many sliders! Increase _NN_MAX_SLIDER_STATES.\n");
+            return -1;
+        }
+        state = &_nnSliderStates[_nnSliderStateCount++];
+        state->id = id;
+        state->value = initial;
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_SLIDER, state);
+
+    float width = 16;
+
+    // Ensure the value is clamped between min and max
+    state->value = fmaxf(min, fminf(max, state->value));
+
+    // Get mouse state
+    nnPos mousePos = nnMousePosition();
+    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, 16, height});
+    bool dragging = hovered && nnMouseDown(0);
+
+    // Handle dragging
+    if (dragging)
+    {
+        float relativeY = mousePos.y - y;
+        float proportion = fmaxf(0, fminf(1, 1.0f - (relativeY / height)));
+        state->value = min + proportion * (max - min);
+        state->value = roundf(state->value / step) * step; // Apply step resolution
+    }
+
+    // Calculate the knob position
+    float proportion = (state->value - min) / (max - min);
+    int knobY = y + height - (int)(proportion * height);
+
+    // Draw the slider bar
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    // Draw the filled portion
+    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(fillColor.r, fillColor.g,
+              fillColor.b, fillColor.a);
+    glVertex2f(x, y + height);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x + width, knobY);
+    glVertex2f(x, knobY);
+    glEnd();
+
+    // Draw the unfilled portion
+    nnColorf unfilledColor = hovered ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(unfilledColor.r, unfilledColor.g,
+              unfilledColor.b, unfilledColor.a);
+    glVertex2f(x, knobY);
+    glVertex2f(x + width, knobY);
+    glVertex2f(x + width, y);
+    glVertex2f(x, y);
+    glEnd();
+
+    // Draw the border
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw the knob
+    nnColorf knobColor = hovered ? _nnCurrentTheme.borderColorAccent : _nnCurrentTheme.borderColor;
+    glBegin(GL_QUADS);
+    glColor4f(knobColor.r, knobColor.g,
+              knobColor.b, knobColor.a);
+    glVertex2f(x - 2, knobY - 4);
+    glVertex2f(x + width + 2, knobY - 4);
+    glVertex2f(x + width + 2, knobY + 4);
+    glVertex2f(x - 2, knobY + 4);
+    glEnd();
+
+    glDisable(GL_BLEND);
+
+    nnSetColor(nnGetColor());
+    return state->value;
+}
+
+int nnHProgressbar(float min, float max, float deltaFillState, int x, int y, int width)
+{
+    _nnFlushBatch();
+
+    if (min >= max)
+    {
+        printf("Error: min must be less than max.\n");
+        return 0;
+    }
+
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize progressbar state
+    _nnProgressbarState *state = NULL;
+    for (int i = 0; i < _nnProgressbarStateCount; i++)
+    {
+        if (_nnProgressbarStates[i].id == id)
+        {
+            state = &_nnProgressbarStates[i];
+            break;
         }
-        state = &_nnTextInputStates[_nnTextInputStateCount++];
+    }
+    if (!state)
+    {
+        if (_nnProgressbarStateCount >= _NN_MAX_PROGRESSBAR_STATES)
+        {
+            printf("Error: Too many progressbars! Increase _NN_MAX_PROGRESSBAR_STATES.\n");
+            return -1;
+        }
+        state = &_nnProgressbarStates[_nnProgressbarStateCount++];
         state->id = id;
-        state->cursorIndex = 0;
-        state->selectionStart = 0;
-        state->selectionEnd = 0;
-        state->hasFocus = false;
-        state->scrollOffsetX = 0.0f;
-        state->text[0] = '\0';
+        state->fillState = 0.0;
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_PROGRESSBAR, state);
 
-        // Initialize the internal text state with the external buffer if provided
-        if (buffer && buffer[0] != '\0')
+    // Adjust the fillState by the delta provided
+    state->fillState += deltaFillState;
+
+    // Clamp the internal fillState within the range [min, max]
+    if (state->fillState < min)
+        state->fillState = min;
+    if (state->fillState > max)
+        state->fillState = max;
+
+    // Calculate the percentage fill state
+    float range = max - min;
+    float percentage = (state->fillState - min) / range;
+    int filledWidth = (int)(percentage * width);
+
+    // Draw the progress bar background (secondary color)
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glBegin(GL_QUADS);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + 20);
+    glVertex2f(x, y + 20);
+    glEnd();
+
+    // Draw the filled portion (primary color)
+    nnColorf fillColor = _nnCurrentTheme.primaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(fillColor.r, fillColor.g, fillColor.b, fillColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + filledWidth, y);
+    glVertex2f(x + filledWidth, y + 20);
+    glVertex2f(x, y + 20);
+    glEnd();
+
+    // Draw the border
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + 20);
+    glVertex2f(x, y + 20);
+    glEnd();
+
+    glDisable(GL_BLEND);
+
+    nnSetColor(nnGetColor());
+
+    return (int)(percentage * 100);
+}
+
+int nnVProgressbar(float min, float max, float deltaFillState, int x, int y, int height)
+{
+    _nnFlushBatch();
+
+    if (min >= max)
+    {
+        printf("Error: min must be less than max.\n");
+        return 0;
+    }
+
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize progressbar state
+    _nnProgressbarState *state = NULL;
+    for (int i = 0; i < _nnProgressbarStateCount; i++)
+    {
+        if (_nnProgressbarStates[i].id == id)
+        {
+            state = &_nnProgressbarStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnProgressbarStateCount >= _NN_MAX_PROGRESSBAR_STATES)
+        {
+            printf("Error: Too many progressbars! Increase _NN_MAX_PROGRESSBAR_STATES.\n");
+            return -1;
+        }
+        state = &_nnProgressbarStates[_nnProgressbarStateCount++];
+        state->id = id;
+        state->fillState = 0.0;
+    }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_PROGRESSBAR, state);
+
+    // Adjust the fillState by the delta provided
+    state->fillState += deltaFillState;
+
+    // Clamp the internal fillState within the range [min, max]
+    if (state->fillState < min)
+        state->fillState = min;
+    if (state->fillState > max)
+        state->fillState = max;
+
+    // Calculate the percentage fill state
+    float range = max - min;
+    float percentage = (state->fillState - min) / range;
+    int filledHeight = (int)(percentage * height);
+
+    // Draw the progress bar background (secondary color)
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glBegin(GL_QUADS);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + 20, y);
+    glVertex2f(x + 20, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw the filled portion (primary color)
+    nnColorf fillColor = _nnCurrentTheme.primaryColor;
+    glBegin(GL_QUADS);
+    glColor4f(fillColor.r, fillColor.g, fillColor.b, fillColor.a);
+    glVertex2f(x, y + height - filledHeight);
+    glVertex2f(x + 20, y + height - filledHeight);
+    glVertex2f(x + 20, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw the border
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + 20, y);
+    glVertex2f(x + 20, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    glDisable(GL_BLEND);
+
+    nnSetColor(nnGetColor());
+
+    return (int)(percentage * 100);
+}
+
+int nnDropdown(const char *buttonText, const char **options, int numOptions, int x, int y, int width, int height)
+{
+    _nnFlushBatch();
+
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
+
+    // Find or initialize dropdown state
+    _nnDropdownState *state = NULL;
+    for (int i = 0; i < _nnDropdownStateCount; i++)
+    {
+        if (_nnDropdownStates[i].id == id)
+        {
+            state = &_nnDropdownStates[i];
+            break;
+        }
+    }
+    if (!state)
+    {
+        if (_nnDropdownStateCount >= _NN_MAX_DROPDOWN_STATES)
         {
-            strncpy(state->text, buffer, sizeof(state->text) - 1);
-            state->text[sizeof(state->text) - 1] = '\0';
-            state->cursorIndex = strlen(state->text);
+            printf("Error: Too many dropdowns! Increase _NN_MAX_DROPDOWN_STATES.\n");
+            return -1;
         }
+        state = &_nnDropdownStates[_nnDropdownStateCount++];
+        state->id = id;
+        state->isOpen = false;
+        state->selectedIndex = -1;
+        state->scrollOffset = 0;
+        state->initialized = false;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_DROPDOWN, state);
 
-    // Get mouse position and input states
-    nnPos mousePos = nnMousePosition();
-    bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+    const int maxVisibleOptions = 10;
+    // const int optionHeight = nnTextHeight() + 12;
 
-    // Focus handling
-    if (hovering && nnMouseReleased(0))
-    {
-        state->hasFocus = true;
-    }
-    else if (!hovering && nnMouseReleased(0))
+    // Initialize the button text with the first option if not initialized
+    if (!state->initialized)
     {
-        state->hasFocus = false;
+        if (buttonText)
+        {
+            strncpy(state->selectedText, buttonText, sizeof(state->selectedText) - 1);
+        }
+        else if (numOptions > 0 && options[0])
+        {
+            strncpy(state->selectedText, options[0], sizeof(state->selectedText) - 1);
+        }
+        state->initialized = true;
     }
 
-    const int padding = 4;
+    // Get mouse position
+    nnPos mousePos = nnMousePosition();
 
-    // Text input handling (only if focused)
-    if (state->hasFocus)
-    {
-        const char *inputText = _nnFetchTextInput(); // Fetch input text
-        if (inputText && *inputText)
-        {
-            // Insert text at cursor position
-            int inputLength = strlen(inputText);
-            int remainingSpace = maxLength - strlen(state->text) - 1;
+    // Determine if the mouse is hovering over the dropdown button
+    bool hoveringButton = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
 
-            if (inputLength > remainingSpace)
-                inputLength = remainingSpace;
+    // Calculate the actual height of the visible list
+    int actualVisibleOptions = (numOptions < maxVisibleOptions) ? numOptions : maxVisibleOptions;
+    int visibleListHeight = actualVisibleOptions * height;
 
-            // Replace selected text or insert at cursor
-            if (state->selectionStart != state->selectionEnd)
-            {
-                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
-                state->cursorIndex = selStart;
-            }
+    // Check if the list fits below or above the button
+    int screenHeight = nnScreenHeight();
+    bool drawAbove = (y - height / 2) > screenHeight / 2;
 
-            // Insert new text
-            memmove(&state->text[state->cursorIndex + inputLength], &state->text[state->cursorIndex], strlen(&state->text[state->cursorIndex]) + 1);
-            memcpy(&state->text[state->cursorIndex], inputText, inputLength);
-            state->cursorIndex += inputLength;
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
+    // Adjust Y position for the list if drawing above
+    int listY = drawAbove ? (y - visibleListHeight) : (y + height);
+
+    // Toggle dropdown open/close on button click
+    if (hoveringButton && nnMouseReleased(0))
+    {
+        state->isOpen = !state->isOpen;
+        // Other elements can use this to determine of they can be clicked.
+        // If a popup is open, other elements behind should not be clickable.
+        if (state->isOpen)
+        {
+            _nnstate.isAnyPopupOpen = true;
+        }
+        else
+        {
+            _nnstate.isAnyPopupOpen = false;
         }
+    }
 
-        // Handle backspace
-        if (nnKeyHit(nnVK_BACKSPACE))
+    // Close dropdown if mouse is not hovering over button or list
+    bool hoveringList = false;
+    if (state->isOpen)
+    {
+        int visibleListHeight = maxVisibleOptions * height;
+        hoveringList = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, drawAbove ? listY : y, width, drawAbove ? visibleListHeight : visibleListHeight + height});
+    }
+    if (!hoveringButton && !hoveringList && nnMouseReleased(0))
+    {
+        state->isOpen = false;
+    }
+
+    // Handle scrolling using nnMouseWheelDelta
+    if (state->isOpen && hoveringList)
+    {
+        int wheelDelta = nnMouseWheelDelta();
+        if (drawAbove)
         {
-            if (state->selectionStart != state->selectionEnd)
+            // Reverse the scroll direction for above layout
+            if (wheelDelta > 0)
             {
-                // Delete selected text
-                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
-                state->cursorIndex = selStart;
+                state->scrollOffset = (state->scrollOffset < numOptions - maxVisibleOptions) ? state->scrollOffset + 1 : state->scrollOffset;
             }
-            else if (state->cursorIndex > 0)
+            else if (wheelDelta < 0)
             {
-                // Delete one character
-                memmove(&state->text[state->cursorIndex - 1], &state->text[state->cursorIndex], strlen(&state->text[state->cursorIndex]) + 1);
-                state->cursorIndex--;
+                state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
             }
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
         }
-
-        // Handle delete
-        if (nnKeyHit(nnVK_DELETE))
+        else
         {
-            if (state->selectionStart != state->selectionEnd)
+            // Default scroll logic for below layout
+            if (wheelDelta > 0)
             {
-                // Delete selected text
-                int selStart = state->selectionStart < state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                int selEnd = state->selectionStart > state->selectionEnd ? state->selectionStart : state->selectionEnd;
-                memmove(&state->text[selStart], &state->text[selEnd], strlen(&state->text[selEnd]) + 1);
-                state->cursorIndex = selStart;
+                state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
             }
-            else if (state->cursorIndex < strlen(state->text))
+            else if (wheelDelta < 0)
             {
-                // Delete one character to the right of the cursor
-                memmove(&state->text[state->cursorIndex], &state->text[state->cursorIndex + 1], strlen(&state->text[state->cursorIndex + 1]) + 1);
+                state->scrollOffset = (state->scrollOffset < numOptions - maxVisibleOptions) ? state->scrollOffset + 1 : state->scrollOffset;
             }
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
         }
+    }
 
-        // Handle arrow keys
-        if (nnKeyHit(nnVK_LEFT) && state->cursorIndex > 0)
-        {
-            state->cursorIndex--;
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
+    // Draw dropdown button
+    nnColorf bgColor = state->isOpen ? _nnCurrentTheme.primaryColorAccent
+                                     : (hoveringButton ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor);
+    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
 
-            // Ensure the cursor stays visible
-            float cursorX = x + padding + nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]);
-            if (cursorX < x + padding)
-            {
-                state->scrollOffsetX -= nnTextWidth(&state->text[state->cursorIndex]) - nnTextWidth(&state->text[state->cursorIndex - 1]);
-                if (state->scrollOffsetX < 0)
-                    state->scrollOffsetX = 0;
-            }
-        }
+    // Draw button background
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+    glBegin(GL_QUADS);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
 
-        if (nnKeyHit(nnVK_RIGHT) && state->cursorIndex < strlen(state->text))
+    // Draw button border
+    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+    glBegin(GL_LINE_LOOP);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
+    glEnd();
+
+    // Draw triangle indicator (direction depends on list position: above or below)
+    int triangleSize = height / 4;
+    int triangleX = x + width - triangleSize * 2; // Position triangle on the right side
+    int triangleY = drawAbove ? (y + height / 2) + triangleSize / 2 : (y + height / 2) - triangleSize / 2;
+
+    glBegin(GL_TRIANGLES);
+    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+    if (drawAbove)
+    {
+        glVertex2f(triangleX, triangleY);
+        glVertex2f(triangleX + triangleSize, triangleY);
+        glVertex2f(triangleX + triangleSize / 2, triangleY - triangleSize);
+    }
+    else
+    {
+        glVertex2f(triangleX, triangleY);
+        glVertex2f(triangleX + triangleSize, triangleY);
+        glVertex2f(triangleX + triangleSize / 2, triangleY + triangleSize);
+    }
+    glEnd();
+
+    // Draw button text (truncate if necessary)
+    char truncatedText[256];
+    _nnTruncateText(state->selectedText, width - triangleSize * 3, truncatedText, sizeof(truncatedText));
+
+    int textX = x + 8; // Left-align with a margin of 8 pixels
+    int textY = y + (height - nnTextHeight()) / 2;
+    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+    _nnDrawString(truncatedText, textX, textY, 0.0f);
+
+    // Draw dropdown list if open
+    if (state->isOpen)
+    {
+        // Draw the dropdown list options
+        for (int i = 0; i < numOptions; i++)
         {
-            state->cursorIndex++;
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
+            // Calculate the visible range of options considering the scroll offset
+            int visibleStart = state->scrollOffset;
+            int visibleEnd = state->scrollOffset + actualVisibleOptions;
+            if (i < visibleStart || i >= visibleEnd)
+                continue;
+
+            // Calculate option position
+            int visibleIndex = i - state->scrollOffset;
+            int optionY = drawAbove
+                              ? (listY + (actualVisibleOptions - 1 - visibleIndex) * height) // Adjust for drawing above
+                              : (listY + visibleIndex * height);                             // Default when drawing below
+
+            // Determine if mouse is hovering over the option
+            bool hoveringOption = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, optionY, width, height});
+
+            // Background color for the option
+            nnColorf optionBgColor = hoveringOption ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+
+            // Draw option popup background
+            glBegin(GL_QUADS);
+            glColor4f(optionBgColor.r, optionBgColor.g, optionBgColor.b, optionBgColor.a);
+            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
+            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
+            glEnd();
+
+            // Draw option popup border
+            glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+            glBegin(GL_LINE_LOOP);
+            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
+            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
+            glEnd();
+
+            // Draw option text (truncate if necessary)
+            char optionText[256];
+            float rightMargin = 20;
+            _nnTruncateText(options[i], width - rightMargin, optionText, sizeof(optionText));
+
+            int optionTextX = x + 10; // Left-aligned with a margin of 10 pixels
+            int optionTextY = optionY + (height - nnTextHeight()) / 2;
+            glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+            _nnDrawString(optionText, optionTextX, optionTextY, _NN_Z_INDEX_POPUP_TEXT);
 
-            // Ensure the cursor stays visible
-            float cursorX = x + padding + nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]);
-            if (cursorX > x + width - padding)
+            // Handle option click
+            if (hoveringOption && nnMouseReleased(0))
             {
-                state->scrollOffsetX += nnTextWidth(&state->text[state->cursorIndex]) - nnTextWidth(&state->text[state->cursorIndex - 1]);
+                state->selectedIndex = i;
+                strncpy(state->selectedText, options[i], sizeof(state->selectedText) - 1);
+                state->isOpen = false;
+                nnFlushMouse();
             }
         }
 
-        // Handle Home/End keys
-        if (nnKeyHit(nnVK_HOME))
+        // Draw scrollbar if the list is scrollable
+        if (numOptions > maxVisibleOptions)
         {
-            state->cursorIndex = 0;
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
-            state->scrollOffsetX = 0; // Scroll to the start
-        }
+            float scrollbarHeight = (float)actualVisibleOptions / numOptions * visibleListHeight;
+            float scrollbarPosition = (float)state->scrollOffset / numOptions * visibleListHeight;
+            int scrollbarX = x + width - 2; // 4px wide scrollbar at the right edge
+            int scrollbarY = drawAbove
+                                 ? (listY + visibleListHeight - scrollbarHeight - scrollbarPosition)
+                                 : (listY + scrollbarPosition);
 
-        if (nnKeyHit(nnVK_END))
-        {
-            // Move cursor to the end of the actual text
-            state->cursorIndex = strlen(state->text);
-            state->selectionStart = state->selectionEnd = state->cursorIndex;
+            // Draw scrollbar background
+            // nnColorf scrollbarBgColor = _nnCurrentTheme.secondaryColor; // Background color
+            // glBegin(GL_QUADS);
+            // glColor4f(scrollbarBgColor.r, scrollbarBgColor.g, scrollbarBgColor.b, scrollbarBgColor.a);
+            // glVertex2f(scrollbarX, listY);
+            // glVertex2f(scrollbarX + 2, listY);
+            // glVertex2f(scrollbarX + 2, listY + visibleListHeight);
+            // glVertex2f(scrollbarX, listY + visibleListHeight);
+            // glEnd();
 
-            // Scroll to the end of the text
-            float textWidth = nnTextWidth(state->text);
-            if (textWidth > width - padding * 2)
-            {
-                // If the text is wider than the visible width, scroll to the end
-                state->scrollOffsetX = textWidth - (width - padding * 2);
-            }
-            else
-            {
-                // If text fits, no need to scroll
-                state->scrollOffsetX = 0;
-            }
+            // Draw scrollbar foreground
+            nnColorf scrollbarFgColor = _nnCurrentTheme.primaryColor; // Scrollbar color
+            glBegin(GL_QUADS);
+            glColor4f(scrollbarFgColor.r, scrollbarFgColor.g, scrollbarFgColor.b, scrollbarFgColor.a);
+            glVertex3f(scrollbarX, scrollbarY, _NN_Z_INDEX_POPUP);
+            glVertex3f(scrollbarX + 2, scrollbarY, _NN_Z_INDEX_POPUP);
+            glVertex3f(scrollbarX + 2, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP);
+            glVertex3f(scrollbarX, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP);
+            glEnd();
         }
     }
 
-    // Calculate text width and cursor position
-    float cursorX = x + padding + nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]);
+    glDisable(GL_BLEND);
 
-    // Adjust scroll offset for the cursor position
-    if (cursorX < x + padding)
-    {
-        // Cursor is left of the visible area
-        state->scrollOffsetX = nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]) - padding;
-    }
-    else if (cursorX > x + width - padding)
-    {
-        // Cursor is right of the visible area
-        state->scrollOffsetX = nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]) + padding - width;
-    }
+    nnSetColor(nnGetColor());
 
-    // Draw text input background and border
-    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
-    nnColorf borderColor = state->hasFocus ? _nnCurrentTheme.primaryColor : _nnCurrentTheme.borderColor;
+    return state->selectedIndex;
+}
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+// Bucket of the trigram starting at the given lowercase text.
+static int _nnTrigramBucket(const char *text)
+{
+    unsigned int hash = _nnHashBytes(2166136261u, text, 3);
+    return hash & (_NN_FILTER_TRIGRAM_BUCKETS - 1);
+}
 
-    glBegin(GL_QUADS);
-    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
+static void _nnFreeFilterIndex(_nnFilterDropdownState *state)
+{
+    free(state->lowerText);
+    free(state->lowerOffsets);
+    free(state->trigramStarts);
+    free(state->trigramOptions);
+    free(state->matches);
+    state->lowerText = NULL;
+    state->lowerOffsets = NULL;
+    state->trigramStarts = NULL;
+    state->trigramOptions = NULL;
+    state->matches = NULL;
+    state->numMatches = 0;
+}
 
-    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
+// Builds the lowercase copies and the trigram index of the options.
+static bool _nnBuildFilterIndex(_nnFilterDropdownState *state, const char **options, int numOptions)
+{
+    _nnFreeFilterIndex(state);
+    state->options = options;
+    state->numOptions = numOptions;
+    state->matchedFilter[0] = '\0';
+
+    size_t totalLength = 0;
+    for (int i = 0; i < numOptions; i++)
+        totalLength += (options[i] ? strlen(options[i]) : 0) + 1;
+
+    state->lowerText = malloc(totalLength + 1);
+    state->lowerOffsets = malloc((numOptions + 1) * sizeof(int));
+    state->trigramStarts = calloc(_NN_FILTER_TRIGRAM_BUCKETS + 1, sizeof(int));
+    state->matches = malloc((numOptions + 1) * sizeof(int));
+    int *lastOption = malloc(_NN_FILTER_TRIGRAM_BUCKETS * sizeof(int));
+    if (!state->lowerText || !state->lowerOffsets || !state->trigramStarts || !state->matches || !lastOption)
+    {
+        printf("Error: Failed to allocate the option index of a filter dropdown.\n");
+        free(lastOption);
+        _nnFreeFilterIndex(state);
+        state->options = NULL;
+        return false;
+    }
 
-    // Draw cursor
-    if (state->hasFocus)
+    size_t offset = 0;
+    for (int i = 0; i < numOptions; i++)
     {
-        // Calculate the width of the text up to the cursor position
-        float cursorDrawX = x + padding + nnTextWidth(&state->text[0]) - nnTextWidth(&state->text[state->cursorIndex]) - state->scrollOffsetX;
+        state->lowerOffsets[i] = offset;
+        for (const char *c = options[i] ? options[i] : ""; *c; c++)
+            state->lowerText[offset++] = tolower((unsigned char)*c);
+        state->lowerText[offset++] = '\0';
+        state->matches[i] = i;
+    }
+    state->numMatches = numOptions;
 
-        // Clamp the cursor position to the visible area
-        if (cursorDrawX < x + padding)
+    // Count the distinct options per bucket (shifted by one so the prefix sum turns counts into starts), then fill the buckets
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int *fill = NULL;
+        if (pass == 1)
         {
-            cursorDrawX = x + padding;
+            for (int b = 0; b < _NN_FILTER_TRIGRAM_BUCKETS; b++)
+                state->trigramStarts[b + 1] += state->trigramStarts[b];
+            state->trigramOptions = malloc((state->trigramStarts[_NN_FILTER_TRIGRAM_BUCKETS] + 1) * sizeof(int));
+            fill = malloc(_NN_FILTER_TRIGRAM_BUCKETS * sizeof(int));
+            if (!state->trigramOptions || !fill)
+            {
+                printf("Error: Failed to allocate the option index of a filter dropdown.\n");
+                free(fill);
+                free(lastOption);
+                _nnFreeFilterIndex(state);
+                state->options = NULL;
+                return false;
+            }
+            memcpy(fill, state->trigramStarts, _NN_FILTER_TRIGRAM_BUCKETS * sizeof(int));
         }
-        else if (cursorDrawX > x + width - padding)
+
+        for (int b = 0; b < _NN_FILTER_TRIGRAM_BUCKETS; b++)
+            lastOption[b] = -1;
+
+        for (int i = 0; i < numOptions; i++)
         {
-            cursorDrawX = x + width - padding;
+            const char *text = state->lowerText + state->lowerOffsets[i];
+            for (int c = 0; text[c] && text[c + 1] && text[c + 2]; c++)
+            {
+                int bucket = _nnTrigramBucket(text + c);
+                if (lastOption[bucket] == i)
+                    continue;
+                lastOption[bucket] = i;
+                if (pass == 0)
+                    state->trigramStarts[bucket + 1]++;
+                else
+                    state->trigramOptions[fill[bucket]++] = i;
+            }
         }
 
-        // Draw the cursor line
-        glBegin(GL_LINES);
-        glVertex2f(cursorDrawX, y + padding);
-        glVertex2f(cursorDrawX, y + height - padding);
-        glEnd();
+        free(fill);
     }
 
-    // Set scissor for clipping
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(x + padding, nnScreenHeight() - (y + height), width - padding * 2, height);
+    free(lastOption);
+    return true;
+}
 
-    const char *placeholderText = state->text;
-    const bool hasEnteredText = strlen(state->text) > 0;
-    // Draw placeholder if textbox is empty and placeholder exists
-    if (!hasEnteredText && placeholder)
+// Updates the matches for the current filter. If the filter only got longer, just the previous matches are narrowed down,
+// otherwise the candidates come from the smallest trigram bucket of the filter. Only the candidates are compared against.
+static void _nnUpdateFilterMatches(_nnFilterDropdownState *state)
+{
+    char filter[_NN_FILTER_MAX_LENGTH];
+    int filterLength = 0;
+    for (; state->filter[filterLength]; filterLength++)
+        filter[filterLength] = tolower((unsigned char)state->filter[filterLength]);
+    filter[filterLength] = '\0';
+
+    if (strcmp(filter, state->matchedFilter) == 0)
+        return;
+
+    int matchedLength = strlen(state->matchedFilter);
+    bool narrowing = matchedLength > 0 && strncmp(filter, state->matchedFilter, matchedLength) == 0;
+
+    const int *candidates = NULL;
+    int numCandidates = state->numOptions;
+    if (narrowing)
     {
-        nnColorf placeholderColor = _nnCurrentTheme.textSecondaryColor;
-        glColor4f(placeholderColor.r, placeholderColor.g, placeholderColor.b, placeholderColor.a);
-        placeholderText = placeholder;
-        nnDrawText(placeholderText, x + 4, y + (height - nnTextHeight()) / 2);
+        candidates = state->matches;
+        numCandidates = state->numMatches;
     }
-    else if (hasEnteredText) // Otherwise the entered text
+    for (int c = 0; c + 2 < filterLength; c++)
     {
-        nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
-        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-        nnDrawText(state->text, x + padding - state->scrollOffsetX, y + (height - nnTextHeight()) / 2);
+        int bucket = _nnTrigramBucket(filter + c);
+        int bucketSize = state->trigramStarts[bucket + 1] - state->trigramStarts[bucket];
+        if (bucketSize < numCandidates)
+        {
+            candidates = state->trigramOptions + state->trigramStarts[bucket];
+            numCandidates = bucketSize;
+        }
     }
 
-    glDisable(GL_SCISSOR_TEST);
-    glDisable(GL_BLEND);
-
-    // Sync internal state back to external buffer
-    if (buffer)
+    // Collect prefix matches first, substring matches after them. Matches are written in place when narrowing,
+    // which is safe since a candidate is never written ahead of where it is read.
+    int *substringMatches = malloc((numCandidates + 1) * sizeof(int));
+    int numPrefix = 0, numSubstring = 0;
+    for (int i = 0; i < numCandidates; i++)
     {
-        strncpy(buffer, state->text, maxLength - 1);
-        buffer[maxLength - 1] = '\0';
+        int option = candidates ? candidates[i] : i;
+        const char *text = state->lowerText + state->lowerOffsets[option];
+        const char *found = filterLength > 0 ? strstr(text, filter) : text;
+        if (!found)
+            continue;
+        if (found == text)
+            state->matches[numPrefix++] = option;
+        else if (substringMatches)
+            substringMatches[numSubstring++] = option;
     }
 
-    return state->cursorIndex;
-}
-
-bool nnButton(const char *format, int x, int y, int width, int height, ...)
-{
-    // Get mouse state
-    nnPos mousePos = nnMousePosition();
-    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
-    bool pressed = hovered && nnMouseDown(0);
-    bool released = hovered && nnMouseReleased(0);
-
-    // Determine button color based on state
-    nnColorf bgColor = pressed ? _nnCurrentTheme.secondaryColorAccent
-                               : (hovered ? _nnCurrentTheme.primaryColorAccent
-                                          : _nnCurrentTheme.primaryColor);
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
-    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
-
-    // Draw button background quad
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    glBegin(GL_QUADS);
-    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-
-    // Draw button border
-    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-
-    // Draw button text
-    if (format)
+    if (substringMatches)
     {
-        char buffer[256] = {0};
-        va_list args;
-        va_start(args, height);
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        va_end(args);
-
-        int tw = (int)nnTextWidth(buffer);
-        int th = (int)nnTextHeight();
-
-        // Calculate the true centered position
-        int textX = x + (width / 2 - tw / 2);
-        int textY = y + (height / 2 - th / 2);
-
-        // Draw the text
-        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-        nnDrawText(buffer, textX, textY);
+        memcpy(state->matches + numPrefix, substringMatches, numSubstring * sizeof(int));
+        free(substringMatches);
     }
+    state->numMatches = numPrefix + numSubstring;
 
-    glDisable(GL_BLEND);
-
-    nnSetColor(nnGetColor());
-
-    return released;
+    memcpy(state->matchedFilter, filter, filterLength + 1);
+    state->scrollOffset = 0;
+    state->highlightedMatch = 0;
 }
 
-bool nnCheckbox(const char *format, bool isChecked, int x, int y, ...)
+int nnFilterDropdown(const char *buttonText, const char **options, int numOptions, int x, int y, int width, int height)
 {
+    _nnFlushBatch();
+
     // Unique ID based on position
     unsigned int id = _nnGenUID(x, y);
 
-    // Find or initialize checkbox state
-    _nnCheckboxState *state = NULL;
-    for (int i = 0; i < _nnCheckboxStateCount; i++)
+    // Find or initialize filter dropdown state
+    _nnFilterDropdownState *state = NULL;
+    for (int i = 0; i < _nnFilterDropdownStateCount; i++)
     {
-        if (_nnCheckboxStates[i].id == id)
+        if (_nnFilterDropdownStates[i].id == id)
         {
-            state = &_nnCheckboxStates[i];
+            state = &_nnFilterDropdownStates[i];
             break;
         }
     }
     if (!state)
     {
-        if (_nnCheckboxStateCount >= _NN_MAX_CHECKBOX_STATES)
+        if (_nnFilterDropdownStateCount >= _NN_MAX_FILTER_DROPDOWN_STATES)
         {
-            printf("Error: Too many checkboxes! Increase _NN_MAX_CHECKBOX_STATES.\n");
+            printf("Error: Too many filter dropdowns! Increase _NN_MAX_FILTER_DROPDOWN_STATES.\n");
             return -1;
         }
-        state = &_nnCheckboxStates[_nnCheckboxStateCount++];
+        state = &_nnFilterDropdownStates[_nnFilterDropdownStateCount++];
+        memset(state, 0, sizeof(*state));
         state->id = id;
-        state->isChecked = isChecked;
+        state->selectedIndex = -1;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_FILTER_DROPDOWN, state);
 
-    // Dimensions for the checkbox
-    int checkboxSize = 20; // Square checkbox size
-    int spacing = 8;       // Space between checkbox and label
-    int margin = 1;        // Margin for the filled area
+    // Rebuild the index only when the options changed
+    if (state->options != options || state->numOptions != numOptions || !state->lowerText)
+    {
+        if (!_nnBuildFilterIndex(state, options, numOptions))
+            return state->selectedIndex;
+        if (state->selectedIndex >= numOptions)
+            state->selectedIndex = -1;
+    }
 
-    char buffer[256] = {0};
-    if (format)
+    const int maxVisibleOptions = 10;
+    nnPos mousePos = nnMousePosition();
+    bool hoveringButton = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+
+    // The filter field is the first row of the popup, the matches follow
+    int listHeight = (maxVisibleOptions + 1) * height;
+    bool drawAbove = y + height + listHeight > nnScreenHeight() && y - listHeight >= 0;
+    int listY = drawAbove ? y - listHeight : y + height;
+    bool hoveringList = state->isOpen && nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, listY, width, listHeight});
+
+    // Toggle open/close on button click, close on clicks outside
+    if (hoveringButton && nnMouseReleased(0))
     {
-        va_list args;
-        va_start(args, y);
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        va_end(args);
+        state->isOpen = !state->isOpen;
+        _nnstate.isAnyPopupOpen = state->isOpen;
+    }
+    else if (state->isOpen && !hoveringList && nnMouseReleased(0))
+    {
+        state->isOpen = false;
+        _nnstate.isAnyPopupOpen = false;
     }
 
-    // Calculate text dimensions
-    float textWidth = nnTextWidth(buffer);
-    float textHeight = nnTextHeight();
+    if (state->isOpen)
+    {
+        // Typing edits the filter
+        const char *inputText = _nnFetchTextInput();
+        int filterLength = strlen(state->filter);
+        for (const char *c = inputText; *c && filterLength < _NN_FILTER_MAX_LENGTH - 1; c++)
+        {
+            state->filter[filterLength++] = *c;
+        }
+        state->filter[filterLength] = '\0';
+        if (nnKeyHit(nnVK_BACKSPACE) && filterLength > 0)
+        {
+            state->filter[filterLength - 1] = '\0';
+        }
 
-    // Total clickable area
-    int clickableWidth = checkboxSize + spacing + (int)textWidth;
-    int clickableHeight = checkboxSize > textHeight ? checkboxSize : (int)textHeight;
+        _nnUpdateFilterMatches(state);
 
-    // Get mouse state
-    nnPos mousePos = nnMousePosition();
-    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, clickableWidth, clickableHeight});
-    bool released = hovered && nnMouseReleased(0);
+        // Keyboard navigation through the matches
+        if (nnKeyHit(nnVK_DOWN) && state->highlightedMatch < state->numMatches - 1)
+            state->highlightedMatch++;
+        if (nnKeyHit(nnVK_UP) && state->highlightedMatch > 0)
+            state->highlightedMatch--;
+        if (state->highlightedMatch < state->scrollOffset)
+            state->scrollOffset = state->highlightedMatch;
+        if (state->highlightedMatch >= state->scrollOffset + maxVisibleOptions)
+            state->scrollOffset = state->highlightedMatch - maxVisibleOptions + 1;
+
+        if (nnKeyHit(nnVK_ENTER) && state->numMatches > 0)
+        {
+            state->selectedIndex = state->matches[state->highlightedMatch];
+            state->isOpen = false;
+            _nnstate.isAnyPopupOpen = false;
+        }
+        if (nnKeyHit(nnVK_ESCAPE))
+        {
+            state->isOpen = false;
+            _nnstate.isAnyPopupOpen = false;
+        }
 
-    // Update checkbox state
-    if (released)
-    {
-        state->isChecked = !state->isChecked;
+        // Mouse wheel scrolling
+        int wheelDelta = hoveringList ? nnMouseWheelDelta() : 0;
+        int maxScroll = state->numMatches > maxVisibleOptions ? state->numMatches - maxVisibleOptions : 0;
+        state->scrollOffset -= wheelDelta;
+        state->scrollOffset = state->scrollOffset < 0 ? 0 : (state->scrollOffset > maxScroll ? maxScroll : state->scrollOffset);
     }
 
-    // Draw the checkbox
-    nnColorf boxColor = hovered ? _nnCurrentTheme.secondaryColorAccent
-                                : _nnCurrentTheme.secondaryColor;
-    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent
-                                 : _nnCurrentTheme.primaryColor;
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    nnColorf bgColor = (state->isOpen || hoveringButton) ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
     nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
 
-    // Background of the checkbox (base color)
+    // Draw dropdown button
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
+    _nnBlendAlpha();
     glBegin(GL_QUADS);
-    glColor4f(boxColor.r, boxColor.g, boxColor.b, boxColor.a);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
     glVertex2f(x, y);
-    glVertex2f(x + checkboxSize, y);
-    glVertex2f(x + checkboxSize, y + checkboxSize);
-    glVertex2f(x, y + checkboxSize);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
     glEnd();
 
-    // Border of the checkbox
     glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
     glBegin(GL_LINE_LOOP);
     glVertex2f(x, y);
-    glVertex2f(x + checkboxSize, y);
-    glVertex2f(x + checkboxSize, y + checkboxSize);
-    glVertex2f(x, y + checkboxSize);
+    glVertex2f(x + width, y);
+    glVertex2f(x + width, y + height);
+    glVertex2f(x, y + height);
     glEnd();
 
-    // Fill the checkbox with a margin if checked
-    if (state->isChecked)
+    // Draw triangle indicator
+    int triangleSize = height / 4;
+    int triangleX = x + width - triangleSize * 2;
+    int triangleY = (y + height / 2) - triangleSize / 2;
+    glBegin(GL_TRIANGLES);
+    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+    glVertex2f(triangleX, triangleY);
+    glVertex2f(triangleX + triangleSize, triangleY);
+    glVertex2f(triangleX + triangleSize / 2, triangleY + triangleSize);
+    glEnd();
+
+    // Draw button text
+    const char *selectedText = state->selectedIndex >= 0 ? options[state->selectedIndex] : (buttonText ? buttonText : "");
+    char truncatedText[256];
+    _nnTruncateText(selectedText ? selectedText : "", width - triangleSize * 3, truncatedText, sizeof(truncatedText));
+    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+    _nnDrawString(truncatedText, x + 8, y + (height - nnTextHeight()) / 2, 0.0f);
+    glEnable(GL_BLEND);
+
+    if (state->isOpen)
     {
+        // Draw filter field
+        nnColorf fieldColor = _nnCurrentTheme.secondaryColorAccent;
         glBegin(GL_QUADS);
-        glColor4f(fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-        glVertex2f(x + margin, y + margin);
-        glVertex2f(x + checkboxSize - margin * 2, y + margin);
-        glVertex2f(x + checkboxSize - margin * 2, y + checkboxSize - margin * 2);
-        glVertex2f(x + margin, y + checkboxSize - margin * 2);
+        glColor4f(fieldColor.r, fieldColor.g, fieldColor.b, fieldColor.a);
+        glVertex3f(x, listY, _NN_Z_INDEX_POPUP);
+        glVertex3f(x + width, listY, _NN_Z_INDEX_POPUP);
+        glVertex3f(x + width, listY + height, _NN_Z_INDEX_POPUP);
+        glVertex3f(x, listY + height, _NN_Z_INDEX_POPUP);
         glEnd();
-    }
 
-    // Draw the label text
-    int textX = x + checkboxSize + spacing;
-    int textY = y + (checkboxSize - textHeight) / 2; // Vertically center text with checkbox
-    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        nnColorf fieldBorderColor = _nnCurrentTheme.primaryColor;
+        glColor4f(fieldBorderColor.r, fieldBorderColor.g, fieldBorderColor.b, fieldBorderColor.a);
+        glBegin(GL_LINE_LOOP);
+        glVertex3f(x, listY, _NN_Z_INDEX_POPUP);
+        glVertex3f(x + width, listY, _NN_Z_INDEX_POPUP);
+        glVertex3f(x + width, listY + height, _NN_Z_INDEX_POPUP);
+        glVertex3f(x, listY + height, _NN_Z_INDEX_POPUP);
+        glEnd();
+
+        int fieldTextY = listY + (height - nnTextHeight()) / 2;
+        if (state->filter[0] == '\0')
+        {
+            nnColorf placeholderColor = _nnCurrentTheme.textSecondaryColor;
+            glColor4f(placeholderColor.r, placeholderColor.g, placeholderColor.b, placeholderColor.a);
+            _nnDrawString("Type to filter...", x + 8, fieldTextY, _NN_Z_INDEX_POPUP_TEXT);
+        }
+        else
+        {
+            // Show the end of the filter if it is too wide
+            const char *shownFilter = state->filter;
+            float shownWidth = _nnStringWidth(shownFilter);
+            while (*shownFilter && shownWidth > width - 20)
+            {
+                const char *next = shownFilter;
+                _nnDecodeUTF8(&next, NULL);
+                shownWidth -= nnTextWidthN(shownFilter, next - shownFilter);
+                shownFilter = next;
+            }
+            glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+            _nnDrawString(shownFilter, x + 8, fieldTextY, _NN_Z_INDEX_POPUP_TEXT);
+            float cursorX = x + 8 + shownWidth + 1;
+            glBegin(GL_LINES);
+            glVertex3f(cursorX, listY + 4, _NN_Z_INDEX_POPUP_TEXT);
+            glVertex3f(cursorX, listY + height - 4, _NN_Z_INDEX_POPUP_TEXT);
+            glEnd();
+        }
+        glEnable(GL_BLEND);
+
+        // Draw the visible matches
+        int visibleMatches = state->numMatches - state->scrollOffset;
+        visibleMatches = visibleMatches > maxVisibleOptions ? maxVisibleOptions : visibleMatches;
+        for (int i = 0; i < visibleMatches; i++)
+        {
+            int match = state->scrollOffset + i;
+            int option = state->matches[match];
+            int optionY = listY + (i + 1) * height;
+
+            bool hoveringOption = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, optionY, width, height});
+            if (hoveringOption && (nnMouseMotionDelta().x != 0 || nnMouseMotionDelta().y != 0))
+                state->highlightedMatch = match;
+
+            nnColorf optionBgColor = (hoveringOption || match == state->highlightedMatch) ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+            glBegin(GL_QUADS);
+            glColor4f(optionBgColor.r, optionBgColor.g, optionBgColor.b, optionBgColor.a);
+            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
+            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
+            glEnd();
+
+            glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+            glBegin(GL_LINE_LOOP);
+            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
+            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
+            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
+            glEnd();
+
+            char optionText[256];
+            _nnTruncateText(options[option] ? options[option] : "", width - 20, optionText, sizeof(optionText));
+            glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+            _nnDrawString(optionText, x + 10, optionY + (height - nnTextHeight()) / 2, _NN_Z_INDEX_POPUP_TEXT);
+            glEnable(GL_BLEND);
+
+            if (hoveringOption && nnMouseReleased(0))
+            {
+                state->selectedIndex = option;
+                state->isOpen = false;
+                _nnstate.isAnyPopupOpen = false;
+                nnFlushMouse();
+            }
+        }
+
+        // Draw scrollbar if there are more matches than visible
+        if (state->numMatches > maxVisibleOptions)
+        {
+            int matchesHeight = maxVisibleOptions * height;
+            float scrollbarHeight = fmaxf(8.0f, (float)maxVisibleOptions / state->numMatches * matchesHeight);
+            float scrollbarY = listY + height + (float)state->scrollOffset / (state->numMatches - maxVisibleOptions) * (matchesHeight - scrollbarHeight);
+            int scrollbarX = x + width - 3;
+
+            nnColorf scrollbarColor = _nnCurrentTheme.primaryColor;
+            glBegin(GL_QUADS);
+            glColor4f(scrollbarColor.r, scrollbarColor.g, scrollbarColor.b, scrollbarColor.a);
+            glVertex3f(scrollbarX, scrollbarY, _NN_Z_INDEX_POPUP_TEXT);
+            glVertex3f(scrollbarX + 3, scrollbarY, _NN_Z_INDEX_POPUP_TEXT);
+            glVertex3f(scrollbarX + 3, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP_TEXT);
+            glVertex3f(scrollbarX, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP_TEXT);
+            glEnd();
+        }
+    }
 
     glDisable(GL_BLEND);
 
     nnSetColor(nnGetColor());
-    nnDrawText(buffer, textX, textY);
 
-    return state->isChecked;
+    return state->selectedIndex;
 }
 
-float nnHSlider(float min, float max, float initial, float step, int x, int y, int width)
+int nnScrollableList(const char **items, int numItems, int x, int y, int width, int height)
 {
-    if (min >= max)
-    {
-        printf("Error: min must be less than max.\n");
-        return 0;
-    }
+    _nnFlushBatch();
 
     // Unique ID based on position
     unsigned int id = _nnGenUID(x, y);
 
-    // Find or initialize slider state
-    _nnSliderState *state = NULL;
-    for (int i = 0; i < _nnSliderStateCount; i++)
+    // Find or initialize dropdown state
+    _nnScrollableListState *state = NULL;
+    for (int i = 0; i < _nnScrollableListStateCount; i++)
     {
-        if (_nnSliderStates[i].id == id)
+        if (_nnScrollableListStates[i].id == id)
         {
-            state = &_nnSliderStates[i];
+            state = &_nnScrollableListStates[i];
             break;
         }
     }
     if (!state)
     {
-        if (_nnSliderStateCount >= _NN_MAX_SLIDER_STATES)
+        if (_nnScrollableListStateCount >= _NN_MAX_SCROLLABLELIST_STATES)
         {
-            printf("Error: Too many sliders! Increase _NN_MAX_SLIDER_STATES.\n");
+            printf("Error: Too many scrollable lists! Increase _NN_MAX_SCROLLABLELIST_STATES.\n");
             return -1;
         }
-        state = &_nnSliderStates[_nnSliderStateCount++];
+        state = &_nnScrollableListStates[_nnScrollableListStateCount++];
         state->id = id;
-        state->value = initial;
+        state->selectedIndex = -1;
+        state->scrollOffset = 0;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_SCROLLABLELIST, state);
 
-    float height = 16;
+    const int itemHeight = nnTextHeight() + 14; // Fixed height for each item
+    int maxVisibleItems = height / itemHeight;  // Calculate how many items can be displayed
 
-    // Ensure the value is clamped between min and max
-    state->value = fmaxf(min, fminf(max, state->value));
+    // Ensure the scroll offset and maxVisibleItems are valid
+    if (maxVisibleItems > numItems)
+        maxVisibleItems = numItems; // No need to scroll if all items fit
+    if (state->scrollOffset > numItems - maxVisibleItems)
+        state->scrollOffset = numItems - maxVisibleItems;
 
-    // Get mouse state
+    // Get mouse position
     nnPos mousePos = nnMousePosition();
-    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, 16});
-    bool dragging = hovered && nnMouseDown(0);
-
-    // Handle dragging
-    if (dragging)
-    {
-        float relativeX = mousePos.x - x;
-        float proportion = fmaxf(0, fminf(1, relativeX / width));
-        state->value = min + proportion * (max - min);
-        state->value = roundf(state->value / step) * step; // Apply step resolution
-    }
-
-    // Calculate the knob position
-    float proportion = (state->value - min) / (max - min);
-    int knobX = x + (int)(proportion * width);
 
-    // Draw the slider bar
+    // Draw the background of the scrollable list
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    nnColorf borderColor = _nnCurrentTheme.borderColor;
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _nnBlendAlpha();
 
-    // Draw the filled portion
-    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
+    // Draw container background
     glBegin(GL_QUADS);
-    glColor4f(fillColor.r, fillColor.g,
-              fillColor.b, fillColor.a);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
     glVertex2f(x, y);
-    glVertex2f(knobX, y);
-    glVertex2f(knobX, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-
-    // Draw the unfilled portion
-    nnColorf unfilledColor = hovered ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
-    glBegin(GL_QUADS);
-    glColor4f(unfilledColor.r, unfilledColor.g,
-              unfilledColor.b, unfilledColor.a);
-    glVertex2f(knobX, y);
     glVertex2f(x + width, y);
     glVertex2f(x + width, y + height);
-    glVertex2f(knobX, y + height);
+    glVertex2f(x, y + height);
     glEnd();
 
-    // Draw the border
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    // Draw container border
     glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
     glBegin(GL_LINE_LOOP);
     glVertex2f(x, y);
@@ -2881,108 +9361,381 @@ float nnHSlider(float min, float max, float initial, float step, int x, int y, i
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw the knob
-    nnColorf knobColor = hovered ? _nnCurrentTheme.borderColorAccent : _nnCurrentTheme.borderColor;
-    glBegin(GL_QUADS);
-    glColor4f(knobColor.r, knobColor.g,
-              knobColor.b, knobColor.a);
-    glVertex2f(knobX - 4, y - 2);
-    glVertex2f(knobX + 4, y - 2);
-    glVertex2f(knobX + 4, y + height + 2);
-    glVertex2f(knobX - 4, y + height + 2);
-    glEnd();
+    // Draw visible items
+    for (int i = 0; i < maxVisibleItems && (i + state->scrollOffset) < numItems; i++)
+    {
+        int itemIndex = i + state->scrollOffset;
+        int itemY = y + i * itemHeight;
+
+        // Check if the mouse is hovering over the item
+        bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, itemY, width, itemHeight});
+
+        // Determine item background color
+        nnColorf itemBgColor;
+        if (itemIndex == state->selectedIndex)
+        {
+            itemBgColor = _nnCurrentTheme.primaryColor; // Selected item color
+        }
+        else
+        {
+            itemBgColor = hovering ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+        }
+
+        // Draw item background
+        glBegin(GL_QUADS);
+        glColor4f(itemBgColor.r, itemBgColor.g, itemBgColor.b, itemBgColor.a);
+        glVertex2f(x, itemY);
+        glVertex2f(x + width - 1, itemY);
+        glVertex2f(x + width - 1, itemY + itemHeight);
+        glVertex2f(x, itemY + itemHeight);
+        glEnd();
+
+        // Draw item text (truncate if necessary, leave some padding)
+        char truncatedText[256];
+        _nnTruncateText(items[itemIndex], width - 16, truncatedText, sizeof(truncatedText));
+
+        int textX = x + 8; // Left-align with a margin of 8 pixels
+        int textY = itemY + (itemHeight - nnTextHeight()) / 2;
+        nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
+        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        _nnDrawString(truncatedText, textX, textY, 0.0f);
+
+        // Handle item click
+        if (hovering && nnMouseReleased(0))
+        {
+            state->selectedIndex = itemIndex;
+        }
+    }
+
+    // Handle scrolling with mouse wheel
+    bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+    int wheelDelta = nnMouseWheelDelta();
+    if (hovering && numItems > maxVisibleItems)
+    {
+        if (wheelDelta > 0)
+        {
+            state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
+        }
+        else if (wheelDelta < 0)
+        {
+            state->scrollOffset = (state->scrollOffset < numItems - maxVisibleItems) ? state->scrollOffset + 1 : state->scrollOffset;
+        }
+    }
+
+    // Draw scrollbar if necessary
+    if (numItems > maxVisibleItems)
+    {
+        float scrollbarHeight = (float)maxVisibleItems / numItems * height;
+        float scrollbarPosition = (float)state->scrollOffset / numItems * height;
+        int scrollbarX = x + width - 3; // 4px wide scrollbar at the right edge
+        int scrollbarY = y + scrollbarPosition;
+
+        // Draw scrollbar
+        nnColorf scrollbarColor = _nnCurrentTheme.primaryColor;
+        glBegin(GL_QUADS);
+        glColor4f(scrollbarColor.r, scrollbarColor.g, scrollbarColor.b, scrollbarColor.a);
+        glVertex2f(scrollbarX, scrollbarY);
+        glVertex2f(scrollbarX + 3, scrollbarY);
+        glVertex2f(scrollbarX + 3, scrollbarY + scrollbarHeight);
+        glVertex2f(scrollbarX, scrollbarY + scrollbarHeight);
+        glEnd();
+    }
 
     glDisable(GL_BLEND);
 
     nnSetColor(nnGetColor());
 
-    return state->value;
+    return state->selectedIndex;
 }
 
-float nnVSlider(float min, float max, float initial, float step, int x, int y, int height)
+// Makes sure the height index of the given virtual list covers `numItems` rows. Only heights of new rows are queried.
+static bool _nnUpdateVirtualListIndex(_nnVirtualListState *state, nnListItemHeightFunc heightFunc, void *userData, int numItems)
 {
-    if (min >= max)
+    if (state->heightFunc != heightFunc || state->userData != userData || numItems < state->numRows)
     {
-        printf("Error: min must be less than max.\n");
+        // Items changed in an unknown way, rebuild the index
+        state->numRows = 0;
+        state->heightFunc = heightFunc;
+        state->userData = userData;
+        for (int i = 0; i < _NN_VIRTUALLIST_CACHE_SIZE; i++)
+            state->cache[i].index = -1;
+    }
+
+    if (!heightFunc || state->numRows == numItems)
+        return true;
+
+    if (numItems + 1 > state->rowCapacity)
+    {
+        int newCapacity = state->rowCapacity ? state->rowCapacity : 1024;
+        while (newCapacity < numItems + 1)
+            newCapacity *= 2;
+        int *newOffsets = realloc(state->rowOffsets, newCapacity * sizeof(int));
+        if (!newOffsets)
+        {
+            printf("Error: Failed to allocate the row index of a virtual list.\n");
+            return false;
+        }
+        state->rowOffsets = newOffsets;
+        state->rowCapacity = newCapacity;
+    }
+
+    if (state->numRows == 0)
+        state->rowOffsets[0] = 0;
+
+    for (int i = state->numRows; i < numItems; i++)
+    {
+        int rowHeight = heightFunc(i, userData);
+        state->rowOffsets[i + 1] = state->rowOffsets[i] + (rowHeight > 0 ? rowHeight : 1);
+    }
+    state->numRows = numItems;
+    return true;
+}
+
+// Returns the top of the given row relative to the start of the list.
+static int _nnVirtualListRowTop(_nnVirtualListState *state, int row, int rowHeight)
+{
+    return state->heightFunc ? state->rowOffsets[row] : row * rowHeight;
+}
+
+// Returns the row at the given offset relative to the start of the list.
+static int _nnVirtualListRowAt(_nnVirtualListState *state, float offset, int rowHeight, int numItems)
+{
+    if (numItems <= 0)
         return 0;
+
+    int row;
+    if (!state->heightFunc)
+    {
+        row = (int)(offset / rowHeight);
+    }
+    else
+    {
+        // Binary search for the last row starting at or before the offset
+        int low = 0, high = numItems - 1;
+        while (low < high)
+        {
+            int mid = (low + high + 1) / 2;
+            if (state->rowOffsets[mid] <= offset)
+                low = mid;
+            else
+                high = mid - 1;
+        }
+        row = low;
     }
+    return row < 0 ? 0 : (row >= numItems ? numItems - 1 : row);
+}
+
+int nnVirtualList(nnListItemFunc itemFunc, nnListItemHeightFunc heightFunc, void *userData, int numItems, int x, int y, int width, int height)
+{
+    _nnFlushBatch();
+
+    if (!itemFunc || numItems < 0)
+        return -1;
 
     // Unique ID based on position
     unsigned int id = _nnGenUID(x, y);
 
-    // Find or initialize slider state
-    _nnSliderState *state = NULL;
-    for (int i = 0; i < _nnSliderStateCount; i++)
+    // Find or initialize virtual list state
+    _nnVirtualListState *state = NULL;
+    for (int i = 0; i < _nnVirtualListStateCount; i++)
     {
-        if (_nnSliderStates[i].id == id)
+        if (_nnVirtualListStates[i]->id == id)
         {
-            state = &_nnSliderStates[i];
+            state = _nnVirtualListStates[i];
             break;
         }
     }
     if (!state)
     {
-        if (_nnSliderStateCount >= _NN_MAX_SLIDER_STATES)
+        if (_nnVirtualListStateCount >= _NN_MAX_VIRTUALLIST_STATES)
         {
-            printf("Error: Too many sliders! Increase _NN_MAX_SLIDER_STATES.\n");
+            printf("Error: Too many virtual lists! Increase _NN_MAX_VIRTUALLIST_STATES.\n");
             return -1;
         }
-        state = &_nnSliderStates[_nnSliderStateCount++];
+        state = calloc(1, sizeof(_nnVirtualListState));
+        if (!state)
+        {
+            printf("Error: Failed to allocate virtual list state.\n");
+            return -1;
+        }
+        _nnVirtualListStates[_nnVirtualListStateCount++] = state;
         state->id = id;
-        state->value = initial;
+        state->selectedIndex = -1;
+        for (int i = 0; i < _NN_VIRTUALLIST_CACHE_SIZE; i++)
+            state->cache[i].index = -1;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_VIRTUALLIST, state);
 
-    float width = 16;
+    if (!_nnUpdateVirtualListIndex(state, heightFunc, userData, numItems))
+        return state->selectedIndex;
 
-    // Ensure the value is clamped between min and max
-    state->value = fmaxf(min, fminf(max, state->value));
+    const int rowHeight = nnTextHeight() + 14; // Height of each row if no height function is given
+    const int scrollbarWidth = 6;
+    int totalHeight = numItems > 0 ? _nnVirtualListRowTop(state, numItems, rowHeight) : 0;
+    float maxScroll = totalHeight > height ? (float)(totalHeight - height) : 0.0f;
 
-    // Get mouse state
     nnPos mousePos = nnMousePosition();
-    bool hovered = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, 16, height});
-    bool dragging = hovered && nnMouseDown(0);
+    bool hovering = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
 
-    // Handle dragging
-    if (dragging)
+    // Focus handling
+    if (nnMouseReleased(0))
     {
-        float relativeY = mousePos.y - y;
-        float proportion = fmaxf(0, fminf(1, 1.0f - (relativeY / height)));
-        state->value = min + proportion * (max - min);
-        state->value = roundf(state->value / step) * step; // Apply step resolution
+        state->hasFocus = hovering;
     }
 
-    // Calculate the knob position
-    float proportion = (state->value - min) / (max - min);
-    int knobY = y + height - (int)(proportion * height);
+    // Scrollbar dragging
+    bool scrollable = totalHeight > height;
+    bool hoveringScrollbar = scrollable && hovering && mousePos.x >= x + width - scrollbarWidth * 2;
+    if (hoveringScrollbar && nnMouseHit(0))
+    {
+        state->draggingScrollbar = true;
+    }
+    if (state->draggingScrollbar)
+    {
+        float proportion = fmaxf(0, fminf(1, (float)(mousePos.y - y) / height));
+        state->scrollTarget = proportion * maxScroll;
+        state->scrollY = state->scrollTarget;
+    }
 
-    // Draw the slider bar
+    // Mouse wheel scrolls by three default rows
+    if (hovering && scrollable)
+    {
+        state->scrollTarget -= nnMouseWheelDelta() * rowHeight * 3;
+    }
+
+    // Keyboard navigation
+    if (state->hasFocus && numItems > 0)
+    {
+        int selected = state->selectedIndex;
+        int pageRows = height / rowHeight > 1 ? height / rowHeight : 1;
+        if (nnKeyHit(nnVK_UP))
+            selected--;
+        if (nnKeyHit(nnVK_DOWN))
+            selected++;
+        if (nnKeyHit(nnVK_PAGE_UP))
+            selected -= pageRows;
+        if (nnKeyHit(nnVK_PAGE_DOWN))
+            selected += pageRows;
+        if (nnKeyHit(nnVK_HOME))
+            selected = 0;
+        if (nnKeyHit(nnVK_END))
+            selected = numItems - 1;
+
+        if (selected != state->selectedIndex)
+        {
+            selected = selected < 0 ? 0 : (selected >= numItems ? numItems - 1 : selected);
+            state->selectedIndex = selected;
+
+            // Scroll the selected row into view
+            int rowTop = _nnVirtualListRowTop(state, selected, rowHeight);
+            int rowBottom = _nnVirtualListRowTop(state, selected + 1, rowHeight);
+            if (rowTop < state->scrollTarget)
+                state->scrollTarget = rowTop;
+            else if (rowBottom > state->scrollTarget + height)
+                state->scrollTarget = rowBottom - height;
+        }
+    }
+
+    // Ease the scroll position towards its target
+    state->scrollTarget = fmaxf(0, fminf(maxScroll, state->scrollTarget));
+    float ease = fminf(1.0f, nnDT * 15.0f);
+    state->scrollY += (state->scrollTarget - state->scrollY) * (ease > 0 ? ease : 1.0f);
+    if (fabsf(state->scrollTarget - state->scrollY) < 0.5f)
+        state->scrollY = state->scrollTarget;
+
+    // Draw container background
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    nnColorf borderColor = state->hasFocus ? _nnCurrentTheme.primaryColor : _nnCurrentTheme.borderColor;
+    nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _nnBlendAlpha();
 
-    // Draw the filled portion
-    nnColorf fillColor = hovered ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
     glBegin(GL_QUADS);
-    glColor4f(fillColor.r, fillColor.g,
-              fillColor.b, fillColor.a);
-    glVertex2f(x, y + height);
+    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    glVertex2f(x, y);
+    glVertex2f(x + width, y);
     glVertex2f(x + width, y + height);
-    glVertex2f(x + width, knobY);
-    glVertex2f(x, knobY);
+    glVertex2f(x, y + height);
     glEnd();
 
-    // Draw the unfilled portion
-    nnColorf unfilledColor = hovered ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
-    glBegin(GL_QUADS);
-    glColor4f(unfilledColor.r, unfilledColor.g,
-              unfilledColor.b, unfilledColor.a);
-    glVertex2f(x, knobY);
-    glVertex2f(x + width, knobY);
-    glVertex2f(x + width, y);
-    glVertex2f(x, y);
-    glEnd();
+    // Clip partially visible rows
+    glEnable(GL_SCISSOR_TEST);
+    _nnScissor(x, y, width, height);
 
-    // Draw the border
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
+    // Draw only the visible rows
+    int firstRow = _nnVirtualListRowAt(state, state->scrollY, rowHeight, numItems);
+    float textMaxWidth = width - 16 - (scrollable ? scrollbarWidth : 0);
+    for (int row = firstRow; row < numItems; row++)
+    {
+        int rowTop = _nnVirtualListRowTop(state, row, rowHeight);
+        int rowBottom = _nnVirtualListRowTop(state, row + 1, rowHeight);
+        float rowY = y + rowTop - state->scrollY;
+        float rowH = rowBottom - rowTop;
+        if (rowY >= y + height)
+            break;
+
+        bool hoveringRow = hovering && !hoveringScrollbar && !state->draggingScrollbar && mousePos.y >= rowY && mousePos.y < rowY + rowH;
+        if (hoveringRow && nnMouseReleased(0))
+        {
+            state->selectedIndex = row;
+        }
+
+        nnColorf rowBgColor = row == state->selectedIndex ? _nnCurrentTheme.primaryColor
+                                                          : (hoveringRow ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor);
+        glBegin(GL_QUADS);
+        glColor4f(rowBgColor.r, rowBgColor.g, rowBgColor.b, rowBgColor.a);
+        glVertex2f(x, rowY);
+        glVertex2f(x + width - 1, rowY);
+        glVertex2f(x + width - 1, rowY + rowH);
+        glVertex2f(x, rowY + rowH);
+        glEnd();
+
+        // Fetch the display string, truncating it only if the item text, font or width changed
+        const char *itemText = itemFunc(row, userData);
+        if (!itemText)
+            itemText = "";
+        unsigned int hash = _nnHashBytes(2166136261u, itemText, strlen(itemText));
+        _nnVirtualListCacheEntry *entry = &state->cache[row & (_NN_VIRTUALLIST_CACHE_SIZE - 1)];
+        if (entry->index != row || entry->hash != hash || entry->font != nnGetFont() || entry->maxWidth != textMaxWidth)
+        {
+            _nnTruncateText(itemText, textMaxWidth, entry->text, sizeof(entry->text));
+            entry->index = row;
+            entry->hash = hash;
+            entry->font = nnGetFont();
+            entry->maxWidth = textMaxWidth;
+        }
+
+        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+        _nnDrawString(entry->text, x + 8, (int)(rowY + (rowH - nnTextHeight()) / 2), 0.0f);
+        glEnable(GL_BLEND);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+
+    // The drag only ends after the rows were handled, so releasing it does not select the row under the mouse
+    if (!nnMouseDown(0))
+    {
+        state->draggingScrollbar = false;
+    }
+
+    // Draw scrollbar
+    if (scrollable)
+    {
+        float scrollbarHeight = fmaxf(12.0f, (float)height / totalHeight * height);
+        float scrollbarY = y + (maxScroll > 0 ? state->scrollY / maxScroll : 0) * (height - scrollbarHeight);
+        int scrollbarX = x + width - scrollbarWidth;
+
+        nnColorf scrollbarColor = state->draggingScrollbar ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor;
+        glBegin(GL_QUADS);
+        glColor4f(scrollbarColor.r, scrollbarColor.g, scrollbarColor.b, scrollbarColor.a);
+        glVertex2f(scrollbarX, scrollbarY);
+        glVertex2f(scrollbarX + scrollbarWidth, scrollbarY);
+        glVertex2f(scrollbarX + scrollbarWidth, scrollbarY + scrollbarHeight);
+        glVertex2f(scrollbarX, scrollbarY + scrollbarHeight);
+        glEnd();
+    }
+
+    // Draw container border
     glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
     glBegin(GL_LINE_LOOP);
     glVertex2f(x, y);
@@ -2991,328 +9744,688 @@ float nnVSlider(float min, float max, float initial, float step, int x, int y, i
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw the knob
-    nnColorf knobColor = hovered ? _nnCurrentTheme.borderColorAccent : _nnCurrentTheme.borderColor;
-    glBegin(GL_QUADS);
-    glColor4f(knobColor.r, knobColor.g,
-              knobColor.b, knobColor.a);
-    glVertex2f(x - 2, knobY - 4);
-    glVertex2f(x + width + 2, knobY - 4);
-    glVertex2f(x + width + 2, knobY + 4);
-    glVertex2f(x - 2, knobY + 4);
-    glEnd();
-
     glDisable(GL_BLEND);
 
     nnSetColor(nnGetColor());
-    return state->value;
+
+    return state->selectedIndex;
 }
 
-int nnHProgressbar(float min, float max, float deltaFillState, int x, int y, int width)
+/*
+ * Text documents are piece tables: the text is a sequence of pieces referencing either the original or the append-only added
+ * buffer. The pieces are kept in a treap with subtree lengths and line feed counts, and every buffer keeps the positions of its
+ * line feeds, so offsets, lines and edits are all found in O(log n) regardless of the document size.
+ */
+
+static unsigned int _nnPieceRandom()
 {
-    if (min >= max)
+    static unsigned int seed = 2463534242u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Number of line feeds before the given position in a buffer.
+static size_t _nnLineFeedsBefore(nnTextDocument *document, int buffer, size_t position)
+{
+    size_t low = 0, high = document->lineFeedCounts[buffer];
+    while (low < high)
     {
-        printf("Error: min must be less than max.\n");
-        return 0;
+        size_t mid = (low + high) / 2;
+        if (document->lineFeeds[buffer][mid] < position)
+            low = mid + 1;
+        else
+            high = mid;
     }
+    return low;
+}
 
-    // Unique ID based on position
-    unsigned int id = _nnGenUID(x, y);
+static void _nnUpdatePieceNode(_nnPieceNode *node)
+{
+    node->subtreeLength = node->length;
+    node->subtreeLineFeeds = node->lineFeeds;
+    if (node->left)
+    {
+        node->subtreeLength += node->left->subtreeLength;
+        node->subtreeLineFeeds += node->left->subtreeLineFeeds;
+    }
+    if (node->right)
+    {
+        node->subtreeLength += node->right->subtreeLength;
+        node->subtreeLineFeeds += node->right->subtreeLineFeeds;
+    }
+}
 
-    // Find or initialize progressbar state
-    _nnProgressbarState *state = NULL;
-    for (int i = 0; i < _nnProgressbarStateCount; i++)
+static _nnPieceNode *_nnCreatePieceNode(nnTextDocument *document, int buffer, size_t start, size_t length, unsigned int priority)
+{
+    _nnPieceNode *node = calloc(1, sizeof(_nnPieceNode));
+    if (!node)
     {
-        if (_nnProgressbarStates[i].id == id)
+        printf("Failed to allocate memory for text document piece.\n");
+        return NULL;
+    }
+    node->priority = priority;
+    node->buffer = buffer;
+    node->start = start;
+    node->length = length;
+    node->lineFeeds = _nnLineFeedsBefore(document, buffer, start + length) - _nnLineFeedsBefore(document, buffer, start);
+    _nnUpdatePieceNode(node);
+    return node;
+}
+
+static void _nnFreePieceNodes(_nnPieceNode *node)
+{
+    if (!node)
+        return;
+    _nnFreePieceNodes(node->left);
+    _nnFreePieceNodes(node->right);
+    free(node);
+}
+
+// Splits the pieces into those before and after `offset`, cutting a piece in two if needed.
+static void _nnSplitPieces(nnTextDocument *document, _nnPieceNode *node, size_t offset, _nnPieceNode **left, _nnPieceNode **right)
+{
+    if (!node)
+    {
+        *left = *right = NULL;
+        return;
+    }
+
+    size_t leftLength = node->left ? node->left->subtreeLength : 0;
+    if (offset <= leftLength)
+    {
+        _nnSplitPieces(document, node->left, offset, left, &node->left);
+        _nnUpdatePieceNode(node);
+        *right = node;
+    }
+    else if (offset >= leftLength + node->length)
+    {
+        _nnSplitPieces(document, node->right, offset - leftLength - node->length, &node->right, right);
+        _nnUpdatePieceNode(node);
+        *left = node;
+    }
+    else
+    {
+        // The offset is inside this piece. The second half keeps the priority so the heap order stays intact.
+        size_t cut = offset - leftLength;
+        _nnPieceNode *second = _nnCreatePieceNode(document, node->buffer, node->start + cut, node->length - cut, node->priority);
+        if (!second)
         {
-            state = &_nnProgressbarStates[i];
-            break;
+            // Keep the document intact, the split just happens at the piece start instead
+            _nnSplitPieces(document, node->left, leftLength, left, &node->left);
+            _nnUpdatePieceNode(node);
+            *right = node;
+            return;
         }
+        node->length = cut;
+        node->lineFeeds -= second->lineFeeds;
+        second->right = node->right;
+        node->right = NULL;
+        _nnUpdatePieceNode(second);
+        _nnUpdatePieceNode(node);
+        *left = node;
+        *right = second;
     }
-    if (!state)
+}
+
+static _nnPieceNode *_nnMergePieces(_nnPieceNode *left, _nnPieceNode *right)
+{
+    if (!left)
+        return right;
+    if (!right)
+        return left;
+
+    if (left->priority >= right->priority)
     {
-        if (_nnProgressbarStateCount >= _NN_MAX_PROGRESSBAR_STATES)
+        left->right = _nnMergePieces(left->right, right);
+        _nnUpdatePieceNode(left);
+        return left;
+    }
+    right->left = _nnMergePieces(left, right->left);
+    _nnUpdatePieceNode(right);
+    return right;
+}
+
+// Appends text to one of the document buffers and records its line feeds.
+static bool _nnAppendToTextBuffer(nnTextDocument *document, int buffer, const char *text, size_t length)
+{
+    if (document->bufferLengths[buffer] + length > document->bufferCapacities[buffer])
+    {
+        size_t capacity = document->bufferCapacities[buffer] ? document->bufferCapacities[buffer] : 4096;
+        while (capacity < document->bufferLengths[buffer] + length)
+            capacity *= 2;
+        char *newBuffer = realloc(document->buffers[buffer], capacity);
+        if (!newBuffer)
         {
-            printf("Error: Too many progressbars! Increase _NN_MAX_PROGRESSBAR_STATES.\n");
-            return -1;
+            printf("Failed to allocate memory for text document.\n");
+            return false;
         }
-        state = &_nnProgressbarStates[_nnProgressbarStateCount++];
-        state->id = id;
-        state->fillState = 0.0;
+        document->buffers[buffer] = newBuffer;
+        document->bufferCapacities[buffer] = capacity;
     }
 
-    // Adjust the fillState by the delta provided
-    state->fillState += deltaFillState;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (text[i] != '\n')
+            continue;
+
+        if (document->lineFeedCounts[buffer] == document->lineFeedCapacities[buffer])
+        {
+            size_t capacity = document->lineFeedCapacities[buffer] ? document->lineFeedCapacities[buffer] * 2 : 1024;
+            size_t *newLineFeeds = realloc(document->lineFeeds[buffer], capacity * sizeof(size_t));
+            if (!newLineFeeds)
+            {
+                printf("Failed to allocate memory for text document.\n");
+                return false;
+            }
+            document->lineFeeds[buffer] = newLineFeeds;
+            document->lineFeedCapacities[buffer] = capacity;
+        }
+        document->lineFeeds[buffer][document->lineFeedCounts[buffer]++] = document->bufferLengths[buffer] + i;
+    }
+
+    memcpy(document->buffers[buffer] + document->bufferLengths[buffer], text, length);
+    document->bufferLengths[buffer] += length;
+    return true;
+}
+
+// Copies the bytes in [from, to) of the given subtree into `buffer`, visiting only the pieces in that range.
+static void _nnCopyPieces(nnTextDocument *document, _nnPieceNode *node, size_t from, size_t to, char *buffer)
+{
+    if (!node || from >= to)
+        return;
+
+    size_t leftLength = node->left ? node->left->subtreeLength : 0;
+    if (from < leftLength)
+    {
+        _nnCopyPieces(document, node->left, from, to < leftLength ? to : leftLength, buffer);
+    }
+
+    size_t pieceFrom = from > leftLength ? from - leftLength : 0;
+    size_t pieceTo = to - leftLength < node->length ? to - leftLength : node->length;
+    if (to > leftLength && pieceFrom < node->length)
+    {
+        size_t written = leftLength + pieceFrom - from;
+        memcpy(buffer + written, document->buffers[node->buffer] + node->start + pieceFrom, pieceTo - pieceFrom);
+    }
+
+    size_t rightStart = leftLength + node->length;
+    if (to > rightStart)
+    {
+        size_t skipped = from > rightStart ? from - rightStart : 0;
+        _nnCopyPieces(document, node->right, skipped, to - rightStart, buffer + (rightStart + skipped - from));
+    }
+}
+
+nnTextDocument *nnCreateTextDocument(const char *text, size_t length)
+{
+    nnTextDocument *document = calloc(1, sizeof(nnTextDocument));
+    if (!document)
+    {
+        printf("Failed to allocate memory for text document.\n");
+        return NULL;
+    }
+
+    if (text && length > 0)
+    {
+        if (!_nnAppendToTextBuffer(document, 0, text, length))
+        {
+            nnFreeTextDocument(document);
+            return NULL;
+        }
+        document->root = _nnCreatePieceNode(document, 0, 0, length, _nnPieceRandom());
+    }
+    return document;
+}
+
+nnTextDocument *nnLoadTextDocument(const char *filepath)
+{
+    nnFileView view = nnMapFile(filepath);
+    if (!view.data)
+        return NULL;
+
+    nnTextDocument *document = nnCreateTextDocument((const char *)view.data, view.size);
+    nnUnmapFile(view);
+    return document;
+}
 
-    // Clamp the internal fillState within the range [min, max]
-    if (state->fillState < min)
-        state->fillState = min;
-    if (state->fillState > max)
-        state->fillState = max;
+void nnTextDocumentInsert(nnTextDocument *document, size_t offset, const char *text, size_t length)
+{
+    if (!document || !text || length == 0)
+        return;
 
-    // Calculate the percentage fill state
-    float range = max - min;
-    float percentage = (state->fillState - min) / range;
-    int filledWidth = (int)(percentage * width);
+    size_t documentLength = nnTextDocumentLength(document);
+    if (offset > documentLength)
+        offset = documentLength;
 
-    // Draw the progress bar background (secondary color)
-    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    size_t start = document->bufferLengths[1];
+    if (!_nnAppendToTextBuffer(document, 1, text, length))
+        return;
 
-    glBegin(GL_QUADS);
-    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + 20);
-    glVertex2f(x, y + 20);
-    glEnd();
+    _nnPieceNode *piece = _nnCreatePieceNode(document, 1, start, length, _nnPieceRandom());
+    if (!piece)
+        return;
 
-    // Draw the filled portion (primary color)
-    nnColorf fillColor = _nnCurrentTheme.primaryColor;
-    glBegin(GL_QUADS);
-    glColor4f(fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + filledWidth, y);
-    glVertex2f(x + filledWidth, y + 20);
-    glVertex2f(x, y + 20);
-    glEnd();
+    _nnPieceNode *left, *right;
+    _nnSplitPieces(document, document->root, offset, &left, &right);
+    document->root = _nnMergePieces(_nnMergePieces(left, piece), right);
+}
 
-    // Draw the border
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
-    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + 20);
-    glVertex2f(x, y + 20);
-    glEnd();
+void nnTextDocumentDelete(nnTextDocument *document, size_t offset, size_t length)
+{
+    if (!document || length == 0)
+        return;
 
-    glDisable(GL_BLEND);
+    _nnPieceNode *left, *middle, *right;
+    _nnSplitPieces(document, document->root, offset, &left, &right);
+    _nnSplitPieces(document, right, length, &middle, &right);
+    _nnFreePieceNodes(middle);
+    document->root = _nnMergePieces(left, right);
+}
 
-    nnSetColor(nnGetColor());
+size_t nnTextDocumentLength(nnTextDocument *document)
+{
+    return (document && document->root) ? document->root->subtreeLength : 0;
+}
 
-    return (int)(percentage * 100);
+size_t nnTextDocumentLineCount(nnTextDocument *document)
+{
+    return ((document && document->root) ? document->root->subtreeLineFeeds : 0) + 1;
 }
 
-int nnVProgressbar(float min, float max, float deltaFillState, int x, int y, int height)
+size_t nnTextDocumentLineOffset(nnTextDocument *document, size_t line)
 {
-    if (min >= max)
-    {
-        printf("Error: min must be less than max.\n");
+    if (!document || line == 0)
         return 0;
-    }
-
-    // Unique ID based on position
-    unsigned int id = _nnGenUID(x, y);
+    if (line >= nnTextDocumentLineCount(document))
+        return nnTextDocumentLength(document);
 
-    // Find or initialize progressbar state
-    _nnProgressbarState *state = NULL;
-    for (int i = 0; i < _nnProgressbarStateCount; i++)
+    // Find the piece holding the line feed that ends the previous line
+    _nnPieceNode *node = document->root;
+    size_t base = 0;
+    while (node)
     {
-        if (_nnProgressbarStates[i].id == id)
+        size_t leftLineFeeds = node->left ? node->left->subtreeLineFeeds : 0;
+        size_t leftLength = node->left ? node->left->subtreeLength : 0;
+        if (line <= leftLineFeeds)
         {
-            state = &_nnProgressbarStates[i];
-            break;
+            node = node->left;
+        }
+        else if (line <= leftLineFeeds + node->lineFeeds)
+        {
+            size_t first = _nnLineFeedsBefore(document, node->buffer, node->start);
+            size_t lineFeed = document->lineFeeds[node->buffer][first + line - leftLineFeeds - 1];
+            return base + leftLength + (lineFeed - node->start) + 1;
+        }
+        else
+        {
+            line -= leftLineFeeds + node->lineFeeds;
+            base += leftLength + node->length;
+            node = node->right;
         }
     }
-    if (!state)
+    return base;
+}
+
+size_t nnTextDocumentLineAt(nnTextDocument *document, size_t offset)
+{
+    if (!document)
+        return 0;
+
+    // Count the line feeds in front of the offset
+    _nnPieceNode *node = document->root;
+    size_t line = 0;
+    while (node)
     {
-        if (_nnProgressbarStateCount >= _NN_MAX_PROGRESSBAR_STATES)
+        size_t leftLength = node->left ? node->left->subtreeLength : 0;
+        if (offset < leftLength)
         {
-            printf("Error: Too many progressbars! Increase _NN_MAX_PROGRESSBAR_STATES.\n");
-            return -1;
+            node = node->left;
+        }
+        else if (offset < leftLength + node->length)
+        {
+            size_t first = _nnLineFeedsBefore(document, node->buffer, node->start);
+            line += node->left ? node->left->subtreeLineFeeds : 0;
+            return line + _nnLineFeedsBefore(document, node->buffer, node->start + offset - leftLength) - first;
+        }
+        else
+        {
+            line += (node->left ? node->left->subtreeLineFeeds : 0) + node->lineFeeds;
+            offset -= leftLength + node->length;
+            node = node->right;
         }
-        state = &_nnProgressbarStates[_nnProgressbarStateCount++];
-        state->id = id;
-        state->fillState = 0.0;
     }
+    return line;
+}
 
-    // Adjust the fillState by the delta provided
-    state->fillState += deltaFillState;
+size_t nnTextDocumentGetText(nnTextDocument *document, size_t offset, size_t length, char *buffer)
+{
+    size_t documentLength = nnTextDocumentLength(document);
+    if (!buffer || offset >= documentLength)
+        return 0;
+    if (length > documentLength - offset)
+        length = documentLength - offset;
 
-    // Clamp the internal fillState within the range [min, max]
-    if (state->fillState < min)
-        state->fillState = min;
-    if (state->fillState > max)
-        state->fillState = max;
+    _nnCopyPieces(document, document->root, offset, offset + length, buffer);
+    return length;
+}
 
-    // Calculate the percentage fill state
-    float range = max - min;
-    float percentage = (state->fillState - min) / range;
-    int filledHeight = (int)(percentage * height);
+void nnFreeTextDocument(nnTextDocument *document)
+{
+    if (!document)
+        return;
 
-    // Draw the progress bar background (secondary color)
-    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    // Views referencing the document forget it
+    for (int i = 0; i < _nnTextViewStateCount; i++)
+    {
+        if (_nnTextViewStates[i].document == document)
+            _nnTextViewStates[i].document = NULL;
+    }
 
-    glBegin(GL_QUADS);
-    glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    glVertex2f(x, y);
-    glVertex2f(x + 20, y);
-    glVertex2f(x + 20, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
+    _nnFreePieceNodes(document->root);
+    for (int buffer = 0; buffer < 2; buffer++)
+    {
+        free(document->buffers[buffer]);
+        free(document->lineFeeds[buffer]);
+    }
+    free(document);
+}
 
-    // Draw the filled portion (primary color)
-    nnColorf fillColor = _nnCurrentTheme.primaryColor;
-    glBegin(GL_QUADS);
-    glColor4f(fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-    glVertex2f(x, y + height - filledHeight);
-    glVertex2f(x + 20, y + height - filledHeight);
-    glVertex2f(x + 20, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
+#define _NN_TEXTVIEW_MAX_LINE_LENGTH 1023 // Longer lines are cut off when drawn
 
-    // Draw the border
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
-    glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(x, y);
-    glVertex2f(x + 20, y);
-    glVertex2f(x + 20, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
+// Advance of the byte at `text`: cached for ASCII, looked up for the first byte of a UTF-8 sequence and 0 for the rest of it.
+static float _nnTextViewAdvance(_nnTextViewState *state, const char *text)
+{
+    unsigned char c = (unsigned char)*text;
+    if (c < 128)
+        return state->advances[c];
+    if (c < 0xc0)
+        return 0.0f;
 
-    glDisable(GL_BLEND);
+    int codepoint = _nnDecodeUTF8(&text, NULL);
+    return _nnCodepointAdvance(state->advanceFont, codepoint);
+}
 
-    nnSetColor(nnGetColor());
+// Width of the first `length` bytes of the given text using the cached glyph advances.
+static float _nnTextViewWidth(_nnTextViewState *state, const char *text, size_t length)
+{
+    float width = 0.0f;
+    for (size_t i = 0; i < length; i++)
+        width += _nnTextViewAdvance(state, text + i);
+    return width;
+}
 
-    return (int)(percentage * 100);
+// Byte index in the given line text that is closest to the horizontal position. Never points into a UTF-8 sequence.
+static size_t _nnTextViewIndexAt(_nnTextViewState *state, const char *text, size_t length, float posX)
+{
+    float width = 0.0f;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (((unsigned char)text[i] & 0xc0) == 0x80)
+            continue;
+
+        float advance = _nnTextViewAdvance(state, text + i);
+        if (posX < width + advance / 2)
+            return i;
+        width += advance;
+    }
+    return length;
 }
 
-int nnDropdown(const char *buttonText, const char **options, int numOptions, int x, int y, int width, int height)
+// Length of the UTF-8 sequence that ends at `offset`, so moving or deleting backwards never splits a character.
+static size_t _nnTextViewPreviousLength(nnTextDocument *document, size_t offset)
+{
+    char bytes[4];
+    size_t count = nnTextDocumentGetText(document, offset > 4 ? offset - 4 : 0, offset > 4 ? 4 : offset, bytes);
+    size_t length = 1;
+    while (length < count && ((unsigned char)bytes[count - length] & 0xc0) == 0x80)
+        length++;
+    return count ? length : 0;
+}
+
+// Length of the UTF-8 sequence that starts at `offset`, 0 at the end of the document.
+static size_t _nnTextViewNextLength(nnTextDocument *document, size_t offset)
+{
+    char bytes[4];
+    size_t count = nnTextDocumentGetText(document, offset, 4, bytes);
+    size_t length = 1;
+    while (length < count && ((unsigned char)bytes[length] & 0xc0) == 0x80)
+        length++;
+    return count ? length : 0;
+}
+
+// Fetches the given line (without its line feed), cut off at _NN_TEXTVIEW_MAX_LINE_LENGTH.
+static size_t _nnTextViewGetLine(nnTextDocument *document, size_t line, char *buffer, size_t *lineStart)
+{
+    size_t start = nnTextDocumentLineOffset(document, line);
+    size_t end = line + 1 < nnTextDocumentLineCount(document) ? nnTextDocumentLineOffset(document, line + 1) - 1 : nnTextDocumentLength(document);
+    size_t length = end - start < _NN_TEXTVIEW_MAX_LINE_LENGTH ? end - start : _NN_TEXTVIEW_MAX_LINE_LENGTH;
+    if (lineStart)
+        *lineStart = start;
+    return nnTextDocumentGetText(document, start, length, buffer);
+}
+
+size_t nnTextView(nnTextDocument *document, bool editable, int x, int y, int width, int height)
 {
+    _nnFlushBatch();
+
     // Unique ID based on position
     unsigned int id = _nnGenUID(x, y);
 
-    // Find or initialize dropdown state
-    _nnDropdownState *state = NULL;
-    for (int i = 0; i < _nnDropdownStateCount; i++)
+    // Find or initialize text view state
+    _nnTextViewState *state = NULL;
+    for (int i = 0; i < _nnTextViewStateCount; i++)
     {
-        if (_nnDropdownStates[i].id == id)
+        if (_nnTextViewStates[i].id == id)
         {
-            state = &_nnDropdownStates[i];
+            state = &_nnTextViewStates[i];
             break;
         }
     }
     if (!state)
     {
-        if (_nnDropdownStateCount >= _NN_MAX_DROPDOWN_STATES)
+        if (_nnTextViewStateCount >= _NN_MAX_TEXTVIEW_STATES)
         {
-            printf("Error: Too many dropdowns! Increase _NN_MAX_DROPDOWN_STATES.\n");
-            return -1;
+            printf("Error: Too many text views! Increase _NN_MAX_TEXTVIEW_STATES.\n");
+            return 0;
         }
-        state = &_nnDropdownStates[_nnDropdownStateCount++];
+        state = &_nnTextViewStates[_nnTextViewStateCount++];
+        memset(state, 0, sizeof(*state));
         state->id = id;
-        state->isOpen = false;
-        state->selectedIndex = -1;
-        state->scrollOffset = 0;
-        state->initialized = false;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_TEXTVIEW, state);
 
-    const int maxVisibleOptions = 10;
-    // const int optionHeight = nnTextHeight() + 12;
+    if (!document)
+        return 0;
 
-    // Initialize the button text with the first option if not initialized
-    if (!state->initialized)
+    if (state->document != document)
     {
-        if (buttonText)
-        {
-            strncpy(state->selectedText, buttonText, sizeof(state->selectedText) - 1);
-        }
-        else if (numOptions > 0 && options[0])
-        {
-            strncpy(state->selectedText, options[0], sizeof(state->selectedText) - 1);
-        }
-        state->initialized = true;
+        state->document = document;
+        state->cursor = 0;
+        state->scrollLine = 0;
+        state->scrollX = 0.0f;
     }
 
-    // Get mouse position
-    nnPos mousePos = nnMousePosition();
+    // Cache the glyph advances of the current font
+    nnFont *font = nnGetFont();
+    if (!font)
+        return state->cursor;
+    if (state->advanceFont != font)
+    {
+        for (int c = 0; c < 128; c++)
+            state->advances[c] = (c >= 32) ? _nnCodepointAdvance(font, c) : 0.0f;
+        state->advances['\t'] = state->advances[' '] * 4;
+        state->advanceFont = font;
+    }
 
-    // Determine if the mouse is hovering over the dropdown button
-    bool hoveringButton = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
+    const int padding = 6;
+    const int lineHeight = nnTextHeight() + 8;
+    const int visibleLines = (height - padding * 2) / lineHeight > 1 ? (height - padding * 2) / lineHeight : 1;
+    const float textWidth = width - padding * 2;
 
-    // Calculate the actual height of the visible list
-    int actualVisibleOptions = (numOptions < maxVisibleOptions) ? numOptions : maxVisibleOptions;
-    int visibleListHeight = actualVisibleOptions * height;
+    size_t lineCount = nnTextDocumentLineCount(document);
+    size_t documentLength = nnTextDocumentLength(document);
+    if (state->cursor > documentLength)
+        state->cursor = documentLength;
 
-    // Check if the list fits below or above the button
-    int screenHeight = nnScreenHeight();
-    bool drawAbove = (y - height / 2) > screenHeight / 2;
+    nnPos mousePos = nnMousePosition();
+    bool hovering = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
 
-    // Adjust Y position for the list if drawing above
-    int listY = drawAbove ? (y - visibleListHeight) : (y + height);
+    char lineText[_NN_TEXTVIEW_MAX_LINE_LENGTH + 1];
+    size_t lineStart;
 
-    // Toggle dropdown open/close on button click
-    if (hoveringButton && nnMouseReleased(0))
+    // Focus handling and click to place the cursor
+    if (nnMouseReleased(0))
     {
-        state->isOpen = !state->isOpen;
-        // Other elements can use this to determine of they can be clicked.
-        // If a popup is open, other elements behind should not be clickable.
-        if (state->isOpen)
-        {
-            _nnstate.isAnyPopupOpen = true;
-        }
-        else
-        {
-            _nnstate.isAnyPopupOpen = false;
-        }
+        state->hasFocus = hovering;
     }
-
-    // Close dropdown if mouse is not hovering over button or list
-    bool hoveringList = false;
-    if (state->isOpen)
+    if (hovering && nnMouseHit(0))
     {
-        int visibleListHeight = maxVisibleOptions * height;
-        hoveringList = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, drawAbove ? listY : y, width, drawAbove ? visibleListHeight : visibleListHeight + height});
+        size_t line = state->scrollLine + (mousePos.y - y - padding) / lineHeight;
+        line = line < lineCount ? line : lineCount - 1;
+        size_t length = _nnTextViewGetLine(document, line, lineText, &lineStart);
+        state->cursor = lineStart + _nnTextViewIndexAt(state, lineText, length, mousePos.x - x - padding + state->scrollX);
+        state->preferredX = -1.0f;
     }
-    if (!hoveringButton && !hoveringList && nnMouseReleased(0))
+
+    // Mouse wheel scrolling
+    if (hovering)
     {
-        state->isOpen = false;
+        int wheelDelta = nnMouseWheelDelta();
+        if (wheelDelta > 0)
+            state->scrollLine = state->scrollLine > 3 ? state->scrollLine - 3 : 0;
+        else if (wheelDelta < 0)
+            state->scrollLine += 3;
     }
 
-    // Handle scrolling using nnMouseWheelDelta
-    if (state->isOpen && hoveringList)
+    bool cursorMoved = false;
+    if (state->hasFocus)
     {
-        int wheelDelta = nnMouseWheelDelta();
-        if (drawAbove)
+        size_t cursorLine = nnTextDocumentLineAt(document, state->cursor);
+        size_t targetLine = cursorLine;
+
+        if (editable)
         {
-            // Reverse the scroll direction for above layout
-            if (wheelDelta > 0)
+            const char *inputText = _nnFetchTextInput();
+            size_t inputLength = strlen(inputText);
+            if (nnKeyHit(nnVK_ENTER))
             {
-                state->scrollOffset = (state->scrollOffset < numOptions - maxVisibleOptions) ? state->scrollOffset + 1 : state->scrollOffset;
+                nnTextDocumentInsert(document, state->cursor, "\n", 1);
+                state->cursor++;
+                cursorMoved = true;
             }
-            else if (wheelDelta < 0)
+            if (nnKeyHit(nnVK_TAB))
             {
-                state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
+                nnTextDocumentInsert(document, state->cursor, "\t", 1);
+                state->cursor++;
+                cursorMoved = true;
             }
-        }
-        else
-        {
-            // Default scroll logic for below layout
-            if (wheelDelta > 0)
+            if (inputLength > 0)
+            {
+                nnTextDocumentInsert(document, state->cursor, inputText, inputLength);
+                state->cursor += inputLength;
+                cursorMoved = true;
+            }
+            if (nnKeyHit(nnVK_BACKSPACE) && state->cursor > 0)
+            {
+                size_t length = _nnTextViewPreviousLength(document, state->cursor);
+                nnTextDocumentDelete(document, state->cursor - length, length);
+                state->cursor -= length;
+                cursorMoved = true;
+            }
+            if (nnKeyHit(nnVK_DELETE))
+            {
+                nnTextDocumentDelete(document, state->cursor, _nnTextViewNextLength(document, state->cursor));
+                cursorMoved = true;
+            }
+            if (cursorMoved)
             {
-                state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
+                state->preferredX = -1.0f;
+                lineCount = nnTextDocumentLineCount(document);
+                documentLength = nnTextDocumentLength(document);
+                cursorLine = targetLine = nnTextDocumentLineAt(document, state->cursor);
             }
-            else if (wheelDelta < 0)
+        }
+
+        if (nnKeyHit(nnVK_LEFT) && state->cursor > 0)
+        {
+            state->cursor -= _nnTextViewPreviousLength(document, state->cursor);
+            state->preferredX = -1.0f;
+            cursorMoved = true;
+        }
+        if (nnKeyHit(nnVK_RIGHT) && state->cursor < documentLength)
+        {
+            state->cursor += _nnTextViewNextLength(document, state->cursor);
+            state->preferredX = -1.0f;
+            cursorMoved = true;
+        }
+        if (nnKeyHit(nnVK_HOME))
+        {
+            state->cursor = nnTextDocumentLineOffset(document, cursorLine);
+            state->preferredX = -1.0f;
+            cursorMoved = true;
+        }
+        if (nnKeyHit(nnVK_END))
+        {
+            size_t lineEnd = cursorLine + 1 < lineCount ? nnTextDocumentLineOffset(document, cursorLine + 1) - 1 : documentLength;
+            state->cursor = lineEnd;
+            state->preferredX = -1.0f;
+            cursorMoved = true;
+        }
+        if (nnKeyHit(nnVK_UP) && cursorLine > 0)
+            targetLine = cursorLine - 1;
+        if (nnKeyHit(nnVK_DOWN) && cursorLine + 1 < lineCount)
+            targetLine = cursorLine + 1;
+        if (nnKeyHit(nnVK_PAGE_UP))
+            targetLine = cursorLine > (size_t)visibleLines ? cursorLine - visibleLines : 0;
+        if (nnKeyHit(nnVK_PAGE_DOWN))
+            targetLine = cursorLine + visibleLines < lineCount ? cursorLine + visibleLines : lineCount - 1;
+
+        // Vertical movement keeps the horizontal cursor position
+        if (targetLine != cursorLine)
+        {
+            if (state->preferredX < 0.0f)
             {
-                state->scrollOffset = (state->scrollOffset < numOptions - maxVisibleOptions) ? state->scrollOffset + 1 : state->scrollOffset;
+                size_t length = _nnTextViewGetLine(document, cursorLine, lineText, &lineStart);
+                size_t column = state->cursor - lineStart < length ? state->cursor - lineStart : length;
+                state->preferredX = _nnTextViewWidth(state, lineText, column);
             }
+            size_t length = _nnTextViewGetLine(document, targetLine, lineText, &lineStart);
+            state->cursor = lineStart + _nnTextViewIndexAt(state, lineText, length, state->preferredX);
+            cursorMoved = true;
         }
     }
 
-    // Draw dropdown button
-    nnColorf bgColor = state->isOpen ? _nnCurrentTheme.primaryColorAccent
-                                     : (hoveringButton ? _nnCurrentTheme.primaryColorAccent : _nnCurrentTheme.primaryColor);
+    // Keep the cursor visible after it moved
+    size_t cursorLine = nnTextDocumentLineAt(document, state->cursor);
+    size_t cursorLineLength = _nnTextViewGetLine(document, cursorLine, lineText, &lineStart);
+    size_t cursorColumn = state->cursor - lineStart < cursorLineLength ? state->cursor - lineStart : cursorLineLength;
+    float cursorX = _nnTextViewWidth(state, lineText, cursorColumn);
+    if (cursorMoved)
+    {
+        if (cursorLine < state->scrollLine)
+            state->scrollLine = cursorLine;
+        else if (cursorLine >= state->scrollLine + visibleLines)
+            state->scrollLine = cursorLine - visibleLines + 1;
+
+        if (cursorX < state->scrollX)
+            state->scrollX = cursorX;
+        else if (cursorX > state->scrollX + textWidth - 2)
+            state->scrollX = cursorX - textWidth + 2;
+    }
+    size_t maxScrollLine = lineCount > (size_t)visibleLines ? lineCount - visibleLines : 0;
+    if (state->scrollLine > maxScrollLine)
+        state->scrollLine = maxScrollLine;
+
+    // Draw background
+    nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    nnColorf borderColor = state->hasFocus ? _nnCurrentTheme.primaryColor : _nnCurrentTheme.borderColor;
     nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
-    nnColorf borderColor = _nnCurrentTheme.borderColor;
 
-    // Draw button background
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _nnBlendAlpha();
+
     glBegin(GL_QUADS);
     glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
     glVertex2f(x, y);
@@ -3321,7 +10434,80 @@ int nnDropdown(const char *buttonText, const char **options, int numOptions, int
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw button border
+    // Draw only the visible lines
+    glEnable(GL_SCISSOR_TEST);
+    _nnScissor(x + padding, y + padding, width - padding * 2, height - padding * 2);
+
+    for (int i = 0; i < visibleLines && state->scrollLine + i < lineCount; i++)
+    {
+        size_t length = _nnTextViewGetLine(document, state->scrollLine + i, lineText, NULL);
+
+        // Skip the characters left of the view
+        float skippedWidth = 0.0f;
+        size_t first = 0;
+        while (first < length && skippedWidth + _nnTextViewWidth(state, lineText + first, 1) <= state->scrollX)
+        {
+            skippedWidth += _nnTextViewWidth(state, lineText + first, 1);
+            first++;
+        }
+
+        // Draw in runs separated by tabs, so tabs advance by four spaces
+        float runX = x + padding + skippedWidth - state->scrollX;
+        int lineY = y + padding + i * lineHeight + (lineHeight - nnTextHeight()) / 2;
+        size_t runStart = first;
+        for (size_t c = first; c <= length; c++)
+        {
+            if (c < length && lineText[c] != '\t')
+                continue;
+
+            if (c > runStart)
+            {
+                glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+                _nnDrawGlyphs(lineText + runStart, c - runStart, (int)runX, lineY, 0.0f, false);
+            }
+            runX += _nnTextViewWidth(state, lineText + runStart, c - runStart) + (c < length ? state->advances['\t'] : 0.0f);
+            runStart = c + 1;
+            if (runX > x + width)
+                break;
+        }
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glEnable(GL_BLEND);
+
+    // Draw cursor
+    if (state->hasFocus && cursorLine >= state->scrollLine && cursorLine < state->scrollLine + visibleLines)
+    {
+        float cursorDrawX = x + padding + cursorX - state->scrollX;
+        float cursorDrawY = y + padding + (cursorLine - state->scrollLine) * lineHeight;
+        if (cursorDrawX >= x && cursorDrawX <= x + width)
+        {
+            glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
+            glBegin(GL_LINES);
+            glVertex2f(cursorDrawX, cursorDrawY + 2);
+            glVertex2f(cursorDrawX, cursorDrawY + lineHeight - 2);
+            glEnd();
+        }
+    }
+
+    // Draw scrollbar
+    if (lineCount > (size_t)visibleLines)
+    {
+        float scrollbarHeight = fmaxf(12.0f, (float)visibleLines / lineCount * height);
+        float scrollbarY = y + (float)state->scrollLine / maxScrollLine * (height - scrollbarHeight);
+        int scrollbarX = x + width - 4;
+
+        nnColorf scrollbarColor = _nnCurrentTheme.primaryColor;
+        glBegin(GL_QUADS);
+        glColor4f(scrollbarColor.r, scrollbarColor.g, scrollbarColor.b, scrollbarColor.a);
+        glVertex2f(scrollbarX, scrollbarY);
+        glVertex2f(scrollbarX + 4, scrollbarY);
+        glVertex2f(scrollbarX + 4, scrollbarY + scrollbarHeight);
+        glVertex2f(scrollbarX, scrollbarY + scrollbarHeight);
+        glEnd();
+    }
+
+    // Draw border
     glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
     glBegin(GL_LINE_LOOP);
     glVertex2f(x, y);
@@ -3330,216 +10516,349 @@ int nnDropdown(const char *buttonText, const char **options, int numOptions, int
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw triangle indicator (direction depends on list position: above or below)
-    int triangleSize = height / 4;
-    int triangleX = x + width - triangleSize * 2; // Position triangle on the right side
-    int triangleY = drawAbove ? (y + height / 2) + triangleSize / 2 : (y + height / 2) - triangleSize / 2;
+    glDisable(GL_BLEND);
 
-    glBegin(GL_TRIANGLES);
-    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-    if (drawAbove)
+    nnSetColor(nnGetColor());
+
+    return state->cursor;
+}
+
+/*
+ * Plot data keeps a min/max pyramid next to the sample ring buffer. Appending a sample updates one block per level, and
+ * drawing picks for every pixel column the coarsest level whose blocks still fit into the column, so any zoom level costs a
+ * few block reads per column and results in at most 2 vertices per column, independent of the number of samples.
+ */
+
+nnPlotData *nnCreatePlotData(size_t capacity)
+{
+    if (capacity < 2)
+        capacity = 2;
+
+    nnPlotData *data = calloc(1, sizeof(nnPlotData));
+    if (!data)
     {
-        glVertex2f(triangleX, triangleY);
-        glVertex2f(triangleX + triangleSize, triangleY);
-        glVertex2f(triangleX + triangleSize / 2, triangleY - triangleSize);
+        printf("Failed to allocate memory for plot data.\n");
+        return NULL;
     }
-    else
+
+    data->capacity = capacity;
+    data->samples = malloc(capacity * sizeof(float));
+    if (!data->samples)
     {
-        glVertex2f(triangleX, triangleY);
-        glVertex2f(triangleX + triangleSize, triangleY);
-        glVertex2f(triangleX + triangleSize / 2, triangleY + triangleSize);
+        printf("Failed to allocate memory for plot data.\n");
+        free(data);
+        return NULL;
     }
-    glEnd();
 
-    // Draw button text (truncate if necessary)
-    char truncatedText[256];
-    strncpy(truncatedText, state->selectedText, sizeof(truncatedText) - 1);
-    truncatedText[sizeof(truncatedText) - 1] = '\0';
+    // Blocks of a level may straddle the oldest and newest sample, hence the 2 additional blocks
+    for (int level = 1; level < _NN_PLOT_MAX_LEVELS && (capacity >> (level * _NN_PLOT_LEVEL_SHIFT)) > 0; level++)
+    {
+        size_t blocks = 1;
+        while (blocks < (capacity >> (level * _NN_PLOT_LEVEL_SHIFT)) + 2)
+            blocks *= 2;
+        data->levelMin[level] = malloc(blocks * sizeof(float));
+        data->levelMax[level] = malloc(blocks * sizeof(float));
+        if (!data->levelMin[level] || !data->levelMax[level])
+        {
+            printf("Failed to allocate memory for plot data.\n");
+            nnFreePlotData(data);
+            return NULL;
+        }
+        data->levelMasks[level] = blocks - 1;
+        data->levelCount = level + 1;
+    }
+    if (data->levelCount == 0)
+        data->levelCount = 1;
+
+    return data;
+}
+
+void nnPlotAppend(nnPlotData *data, const float *samples, size_t count)
+{
+    if (!data || !samples)
+        return;
 
-    float textWidth = nnTextWidth(truncatedText);
-    if (textWidth > width - triangleSize * 3)
+    for (size_t i = 0; i < count; i++)
     {
-        for (int i = strlen(truncatedText) - 1; i > 0; i--)
+        float value = samples[i];
+        size_t index = data->total++;
+        data->samples[index % data->capacity] = value;
+
+        for (int level = 1; level < data->levelCount; level++)
         {
-            truncatedText[i] = '\0';
-            textWidth = nnTextWidth(truncatedText);
-            if (textWidth <= width - triangleSize * 3 - nnTextWidth("..."))
+            int shift = level * _NN_PLOT_LEVEL_SHIFT;
+            size_t block = (index >> shift) & data->levelMasks[level];
+            if ((index & (((size_t)1 << shift) - 1)) == 0)
+            {
+                // First sample of a new block
+                data->levelMin[level][block] = value;
+                data->levelMax[level][block] = value;
+            }
+            else if (value < data->levelMin[level][block])
+            {
+                data->levelMin[level][block] = value;
+            }
+            else if (value > data->levelMax[level][block])
+            {
+                data->levelMax[level][block] = value;
+            }
+            else
             {
-                strcat(truncatedText, "...");
+                // Blocks of the levels above contain this block, so they are not affected either
                 break;
             }
         }
     }
+}
 
-    int textX = x + 8; // Left-align with a margin of 8 pixels
-    int textY = y + (height - nnTextHeight()) / 2;
-    glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-    nnDrawText(truncatedText, textX, textY);
-
-    // Draw dropdown list if open
-    if (state->isOpen)
-    {
-        // Draw the dropdown list options
-        for (int i = 0; i < numOptions; i++)
-        {
-            // Calculate the visible range of options considering the scroll offset
-            int visibleStart = state->scrollOffset;
-            int visibleEnd = state->scrollOffset + actualVisibleOptions;
-            if (i < visibleStart || i >= visibleEnd)
-                continue;
+void nnPlotClear(nnPlotData *data)
+{
+    if (data)
+        data->total = 0;
+}
 
-            // Calculate option position
-            int visibleIndex = i - state->scrollOffset;
-            int optionY = drawAbove
-                              ? (listY + (actualVisibleOptions - 1 - visibleIndex) * height) // Adjust for drawing above
-                              : (listY + visibleIndex * height);                             // Default when drawing below
+size_t nnPlotSampleCount(nnPlotData *data)
+{
+    if (!data)
+        return 0;
+    return data->total < data->capacity ? data->total : data->capacity;
+}
 
-            // Determine if mouse is hovering over the option
-            bool hoveringOption = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, optionY, width, height});
+void nnFreePlotData(nnPlotData *data)
+{
+    if (!data)
+        return;
 
-            // Background color for the option
-            nnColorf optionBgColor = hoveringOption ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
+    // Plots referencing the data forget it
+    for (int i = 0; i < _nnPlotStateCount; i++)
+    {
+        if (_nnPlotStates[i].data == data)
+            _nnPlotStates[i].data = NULL;
+    }
 
-            // Draw option popup background
-            glBegin(GL_QUADS);
-            glColor4f(optionBgColor.r, optionBgColor.g, optionBgColor.b, optionBgColor.a);
-            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
-            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
-            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
-            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
-            glEnd();
+    for (int level = 1; level < _NN_PLOT_MAX_LEVELS; level++)
+    {
+        free(data->levelMin[level]);
+        free(data->levelMax[level]);
+    }
+    free(data->samples);
+    free(data);
+}
 
-            // Draw option popup border
-            glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-            glBegin(GL_LINE_LOOP);
-            glVertex3f(x, optionY, _NN_Z_INDEX_POPUP);
-            glVertex3f(x + width, optionY, _NN_Z_INDEX_POPUP);
-            glVertex3f(x + width, optionY + height, _NN_Z_INDEX_POPUP);
-            glVertex3f(x, optionY + height, _NN_Z_INDEX_POPUP);
-            glEnd();
+// Min and max of the samples in [first, last), read from the coarsest pyramid level whose blocks fit into the range.
+static void _nnPlotRange(nnPlotData *data, size_t first, size_t last, float *outMin, float *outMax)
+{
+    int level = 0;
+    while (level + 1 < data->levelCount && ((size_t)1 << ((level + 1) * _NN_PLOT_LEVEL_SHIFT)) <= last - first)
+        level++;
 
-            // Draw option text (truncate if necessary)
-            char optionText[256];
-            strncpy(optionText, options[i], sizeof(optionText) - 1);
-            optionText[sizeof(optionText) - 1] = '\0';
+    float min, max;
+    if (level == 0)
+    {
+        min = max = data->samples[first % data->capacity];
+        for (size_t i = first + 1; i < last; i++)
+        {
+            float value = data->samples[i % data->capacity];
+            min = value < min ? value : min;
+            max = value > max ? value : max;
+        }
+    }
+    else
+    {
+        // Blocks overlapping the range edges are included, which widens the column by less than a block
+        int shift = level * _NN_PLOT_LEVEL_SHIFT;
+        size_t lastBlock = (last - 1) >> shift;
+        size_t block = first >> shift;
+        min = data->levelMin[level][block & data->levelMasks[level]];
+        max = data->levelMax[level][block & data->levelMasks[level]];
+        for (block++; block <= lastBlock; block++)
+        {
+            size_t slot = block & data->levelMasks[level];
+            min = data->levelMin[level][slot] < min ? data->levelMin[level][slot] : min;
+            max = data->levelMax[level][slot] > max ? data->levelMax[level][slot] : max;
+        }
+    }
+    *outMin = min;
+    *outMax = max;
+}
 
-            float optionTextWidth = nnTextWidth(optionText);
-            float rightMargin = 20;
-            if (optionTextWidth > width - rightMargin)
-            {
-                for (int j = strlen(optionText) - 1; j > 0; j--)
-                {
-                    optionText[j] = '\0';
-                    optionTextWidth = nnTextWidth(optionText);
-                    if (optionTextWidth <= width - rightMargin - nnTextWidth("..."))
-                    {
-                        strcat(optionText, "...");
-                        break;
-                    }
-                }
-            }
+void nnPlot(nnPlotData *data, int x, int y, int width, int height)
+{
+    _nnFlushBatch();
 
-            int optionTextX = x + 10; // Left-aligned with a margin of 10 pixels
-            int optionTextY = optionY + (height - nnTextHeight()) / 2;
-            glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-            nnDrawTextZ(optionText, optionTextX, optionTextY, _NN_Z_INDEX_POPUP_TEXT);
+    // Unique ID based on position
+    unsigned int id = _nnGenUID(x, y);
 
-            // Handle option click
-            if (hoveringOption && nnMouseReleased(0))
-            {
-                state->selectedIndex = i;
-                strncpy(state->selectedText, options[i], sizeof(state->selectedText) - 1);
-                state->isOpen = false;
-                nnFlushMouse();
-            }
+    // Find or initialize plot state
+    _nnPlotState *state = NULL;
+    for (int i = 0; i < _nnPlotStateCount; i++)
+    {
+        if (_nnPlotStates[i].id == id)
+        {
+            state = &_nnPlotStates[i];
+            break;
         }
-
-        // Draw scrollbar if the list is scrollable
-        if (numOptions > maxVisibleOptions)
+    }
+    if (!state)
+    {
+        if (_nnPlotStateCount >= _NN_MAX_PLOT_STATES)
         {
-            float scrollbarHeight = (float)actualVisibleOptions / numOptions * visibleListHeight;
-            float scrollbarPosition = (float)state->scrollOffset / numOptions * visibleListHeight;
-            int scrollbarX = x + width - 2; // 4px wide scrollbar at the right edge
-            int scrollbarY = drawAbove
-                                 ? (listY + visibleListHeight - scrollbarHeight - scrollbarPosition)
-                                 : (listY + scrollbarPosition);
-
-            // Draw scrollbar background
-            // nnColorf scrollbarBgColor = _nnCurrentTheme.secondaryColor; // Background color
-            // glBegin(GL_QUADS);
-            // glColor4f(scrollbarBgColor.r, scrollbarBgColor.g, scrollbarBgColor.b, scrollbarBgColor.a);
-            // glVertex2f(scrollbarX, listY);
-            // glVertex2f(scrollbarX + 2, listY);
-            // glVertex2f(scrollbarX + 2, listY + visibleListHeight);
-            // glVertex2f(scrollbarX, listY + visibleListHeight);
-            // glEnd();
-
-            // Draw scrollbar foreground
-            nnColorf scrollbarFgColor = _nnCurrentTheme.primaryColor; // Scrollbar color
-            glBegin(GL_QUADS);
-            glColor4f(scrollbarFgColor.r, scrollbarFgColor.g, scrollbarFgColor.b, scrollbarFgColor.a);
-            glVertex3f(scrollbarX, scrollbarY, _NN_Z_INDEX_POPUP);
-            glVertex3f(scrollbarX + 2, scrollbarY, _NN_Z_INDEX_POPUP);
-            glVertex3f(scrollbarX + 2, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP);
-            glVertex3f(scrollbarX, scrollbarY + scrollbarHeight, _NN_Z_INDEX_POPUP);
-            glEnd();
+            printf("Error: Too many plots! Increase _NN_MAX_PLOT_STATES.\n");
+            return;
         }
+        state = &_nnPlotStates[_nnPlotStateCount++];
+        memset(state, 0, sizeof(*state));
+        state->id = id;
     }
+    _nnTrackCachedRegionWidget(_NN_CACHED_WIDGET_PLOT, state);
 
-    glDisable(GL_BLEND);
+    if (state->data != data)
+    {
+        state->data = data;
+        state->zoomed = false;
+        state->follow = true;
+    }
 
-    nnSetColor(nnGetColor());
+    const int padding = 4;
+    const int plotWidth = width - padding * 2 > 1 ? width - padding * 2 : 1;
+    const int plotHeight = height - padding * 2 > 1 ? height - padding * 2 : 1;
 
-    return state->selectedIndex;
-}
+    size_t count = nnPlotSampleCount(data);
+    size_t oldest = data ? data->total - count : 0;
+    size_t newest = data ? data->total : 0;
 
-int nnScrollableList(const char **items, int numItems, int x, int y, int width, int height)
-{
-    // Unique ID based on position
-    unsigned int id = _nnGenUID(x, y);
+    nnPos mousePos = nnMousePosition();
+    bool hovering = _nnstate.isAnyPopupOpen ? false : nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
 
-    // Find or initialize dropdown state
-    _nnScrollableListState *state = NULL;
-    for (int i = 0; i < _nnScrollableListStateCount; i++)
+    // Visible range
+    if (!state->zoomed || state->viewLength >= count)
+    {
+        state->zoomed = false;
+        state->follow = true;
+        state->viewLength = count;
+    }
+    if (state->follow)
+        state->viewStart = newest - state->viewLength;
+
+    // Mouse wheel zooms around the mouse position
+    int wheelDelta = hovering ? nnMouseWheelDelta() : 0;
+    if (wheelDelta != 0 && count >= 2)
+    {
+        double mouseSample = state->viewStart + (double)(mousePos.x - x - padding) / plotWidth * state->viewLength;
+        double length = state->viewLength * (wheelDelta > 0 ? 0.8 : 1.25);
+        length = length < 8 ? 8 : length;
+        state->zoomed = length < count;
+        state->viewLength = state->zoomed ? length : count;
+        state->viewStart = mouseSample - (double)(mousePos.x - x - padding) / plotWidth * state->viewLength;
+        state->follow = !state->zoomed || state->viewStart + state->viewLength >= newest;
+    }
+
+    // Dragging pans the plot
+    if (hovering && nnMouseHit(0))
     {
-        if (_nnScrollableListStates[i].id == id)
-        {
-            state = &_nnScrollableListStates[i];
-            break;
-        }
+        state->dragging = true;
+        state->lastMouseX = mousePos.x;
     }
-    if (!state)
+    if (!nnMouseDown(0))
     {
-        if (_nnScrollableListStateCount >= _NN_MAX_SCROLLABLELIST_STATES)
-        {
-            printf("Error: Too many scrollable lists! Increase _NN_MAX_SCROLLABLELIST_STATES.\n");
-            return -1;
-        }
-        state = &_nnScrollableListStates[_nnScrollableListStateCount++];
-        state->id = id;
-        state->selectedIndex = -1;
-        state->scrollOffset = 0;
+        state->dragging = false;
+    }
+    if (state->dragging && state->zoomed && mousePos.x != state->lastMouseX)
+    {
+        state->viewStart -= (double)(mousePos.x - state->lastMouseX) / plotWidth * state->viewLength;
+        state->follow = state->viewStart + state->viewLength >= newest;
+        state->lastMouseX = mousePos.x;
     }
 
-    const int itemHeight = nnTextHeight() + 14; // Fixed height for each item
-    int maxVisibleItems = height / itemHeight;  // Calculate how many items can be displayed
+    if (state->viewStart + state->viewLength > newest)
+        state->viewStart = newest - state->viewLength;
+    if (state->viewStart < oldest)
+        state->viewStart = oldest;
 
-    // Ensure the scroll offset and maxVisibleItems are valid
-    if (maxVisibleItems > numItems)
-        maxVisibleItems = numItems; // No need to scroll if all items fit
-    if (state->scrollOffset > numItems - maxVisibleItems)
-        state->scrollOffset = numItems - maxVisibleItems;
+    // Collect the vertices: min and max per pixel column, or the samples themselves when zoomed in that far
+    int vertexCount = 0;
+    float minValue = 0.0f, maxValue = 0.0f;
+    if (count >= 2)
+    {
+        if (state->vertexCapacity < (plotWidth + 2) * 2)
+        {
+            float *vertices = realloc(state->vertices, (plotWidth + 2) * 2 * 2 * sizeof(float));
+            if (!vertices)
+            {
+                printf("Failed to allocate memory for plot vertices.\n");
+                return;
+            }
+            state->vertices = vertices;
+            state->vertexCapacity = (plotWidth + 2) * 2;
+        }
 
-    // Get mouse position
-    nnPos mousePos = nnMousePosition();
+        double samplesPerPixel = state->viewLength / plotWidth;
+        minValue = INFINITY;
+        maxValue = -INFINITY;
+        if (samplesPerPixel > 1.0)
+        {
+            float lastValue = 0.0f;
+            for (int column = 0; column < plotWidth; column++)
+            {
+                size_t first = (size_t)(state->viewStart + column * samplesPerPixel);
+                size_t last = (size_t)(state->viewStart + (column + 1) * samplesPerPixel);
+                last = last > newest ? newest : last;
+                if (first < oldest || first >= last)
+                    continue;
+
+                float min, max;
+                _nnPlotRange(data, first, last, &min, &max);
+                minValue = min < minValue ? min : minValue;
+                maxValue = max > maxValue ? max : maxValue;
+
+                // Start with the value closer to the previous column to keep the strip short
+                bool minFirst = vertexCount == 0 || fabsf(lastValue - min) < fabsf(lastValue - max);
+                float *vertex = &state->vertices[vertexCount * 2];
+                vertex[0] = vertex[2] = column;
+                vertex[1] = minFirst ? min : max;
+                vertex[3] = minFirst ? max : min;
+                lastValue = vertex[3];
+                vertexCount += 2;
+            }
+        }
+        else
+        {
+            size_t first = (size_t)state->viewStart;
+            size_t last = (size_t)ceil(state->viewStart + state->viewLength) + 1;
+            last = last > newest ? newest : last;
+            for (size_t i = first; i < last && vertexCount < state->vertexCapacity; i++)
+            {
+                float value = data->samples[i % data->capacity];
+                minValue = value < minValue ? value : minValue;
+                maxValue = value > maxValue ? value : maxValue;
+                state->vertices[vertexCount * 2] = (float)((i - state->viewStart) / samplesPerPixel);
+                state->vertices[vertexCount * 2 + 1] = value;
+                vertexCount++;
+            }
+        }
 
-    // Draw the background of the scrollable list
+        // Map to screen coordinates using the visible value range
+        if (maxValue - minValue < 1e-6f)
+        {
+            minValue -= 0.5f;
+            maxValue += 0.5f;
+        }
+        float scaleY = plotHeight / (maxValue - minValue);
+        for (int i = 0; i < vertexCount; i++)
+        {
+            state->vertices[i * 2] += x + padding;
+            state->vertices[i * 2 + 1] = y + padding + (maxValue - state->vertices[i * 2 + 1]) * scaleY;
+        }
+    }
+
+    // Draw background
     nnColorf bgColor = _nnCurrentTheme.secondaryColor;
+    nnColorf lineColor = _nnCurrentTheme.primaryColor;
     nnColorf borderColor = _nnCurrentTheme.borderColor;
+
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _nnBlendAlpha();
 
-    // Draw container background
     glBegin(GL_QUADS);
     glColor4f(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
     glVertex2f(x, y);
@@ -3548,7 +10867,22 @@ int nnScrollableList(const char **items, int numItems, int x, int y, int width,
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw container border
+    // Draw all samples as a single line strip
+    if (vertexCount > 0)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        _nnScissor(x, y, width, height);
+
+        glColor4f(lineColor.r, lineColor.g, lineColor.b, lineColor.a);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(2, GL_FLOAT, 0, state->vertices);
+        glDrawArrays(GL_LINE_STRIP, 0, vertexCount);
+        glDisableClientState(GL_VERTEX_ARRAY);
+
+        glDisable(GL_SCISSOR_TEST);
+    }
+
+    // Draw border
     glColor4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
     glBegin(GL_LINE_LOOP);
     glVertex2f(x, y);
@@ -3557,107 +10891,368 @@ int nnScrollableList(const char **items, int numItems, int x, int y, int width,
     glVertex2f(x, y + height);
     glEnd();
 
-    // Draw visible items
-    for (int i = 0; i < maxVisibleItems && (i + state->scrollOffset) < numItems; i++)
+    glDisable(GL_BLEND);
+
+    nnSetColor(nnGetColor());
+}
+
+// Continues the hash with the parts of a widget state that change how the widget looks.
+static unsigned int _nnHashCachedRegionWidget(unsigned int hash, const _nnCachedRegionWidget *widget)
+{
+    hash = _nnHashBytes(hash, &widget->kind, sizeof(widget->kind));
+    switch (widget->kind)
     {
-        int itemIndex = i + state->scrollOffset;
-        int itemY = y + i * itemHeight;
+    case _NN_CACHED_WIDGET_TEXTINPUT:
+    {
+        const _nnTextInputState *textInput = widget->state;
+        hash = _nnHashBytes(hash, &textInput->cursorIndex, sizeof(textInput->cursorIndex));
+        hash = _nnHashBytes(hash, &textInput->hasFocus, sizeof(textInput->hasFocus));
+        hash = _nnHashBytes(hash, &textInput->scrollOffsetX, sizeof(textInput->scrollOffsetX));
+        return _nnHashBytes(hash, textInput->text, strlen(textInput->text));
+    }
+    case _NN_CACHED_WIDGET_CHECKBOX:
+        return _nnHashBytes(hash, widget->state, sizeof(_nnCheckboxState));
+    case _NN_CACHED_WIDGET_SLIDER:
+        return _nnHashBytes(hash, widget->state, sizeof(_nnSliderState));
+    case _NN_CACHED_WIDGET_PROGRESSBAR:
+        return _nnHashBytes(hash, widget->state, sizeof(_nnProgressbarState));
+    case _NN_CACHED_WIDGET_DROPDOWN:
+        return _nnHashBytes(hash, widget->state, sizeof(_nnDropdownState));
+    case _NN_CACHED_WIDGET_FILTER_DROPDOWN:
+    {
+        const _nnFilterDropdownState *dropdown = widget->state;
+        hash = _nnHashBytes(hash, &dropdown->isOpen, sizeof(dropdown->isOpen));
+        return _nnHashBytes(hash, &dropdown->selectedIndex, sizeof(dropdown->selectedIndex));
+    }
+    case _NN_CACHED_WIDGET_SCROLLABLELIST:
+        return _nnHashBytes(hash, widget->state, sizeof(_nnScrollableListState));
+    case _NN_CACHED_WIDGET_VIRTUALLIST:
+    {
+        const _nnVirtualListState *list = widget->state;
+        hash = _nnHashBytes(hash, &list->selectedIndex, sizeof(list->selectedIndex));
+        hash = _nnHashBytes(hash, &list->hasFocus, sizeof(list->hasFocus));
+        return _nnHashBytes(hash, &list->scrollY, sizeof(list->scrollY));
+    }
+    case _NN_CACHED_WIDGET_TEXTVIEW:
+    {
+        const _nnTextViewState *textView = widget->state;
+        hash = _nnHashBytes(hash, &textView->cursor, sizeof(textView->cursor));
+        hash = _nnHashBytes(hash, &textView->hasFocus, sizeof(textView->hasFocus));
+        hash = _nnHashBytes(hash, &textView->scrollLine, sizeof(textView->scrollLine));
+        return _nnHashBytes(hash, &textView->scrollX, sizeof(textView->scrollX));
+    }
+    case _NN_CACHED_WIDGET_PLOT:
+    {
+        const _nnPlotState *plot = widget->state;
+        size_t total = plot->data ? plot->data->total : 0;
+        hash = _nnHashBytes(hash, &total, sizeof(total));
+        hash = _nnHashBytes(hash, &plot->viewStart, sizeof(plot->viewStart));
+        return _nnHashBytes(hash, &plot->viewLength, sizeof(plot->viewLength));
+    }
+    }
+    return hash;
+}
 
-        // Check if the mouse is hovering over the item
-        bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, itemY, width, itemHeight});
+// Hash of everything besides input that changes how the given region looks: theme, font, scale and the states of the widgets
+// drawn while the region was last recorded. Widgets outside the region do not affect it.
+static unsigned int _nnCachedRegionHash(const _nnCachedRegionState *region)
+{
+    unsigned int hash = 2166136261u;
+    hash = _nnHashBytes(hash, &_nnCurrentTheme, sizeof(_nnCurrentTheme));
+    hash = _nnHashBytes(hash, &_nnstate.font, sizeof(_nnstate.font));
+    hash = _nnHashBytes(hash, &_nnstate.windowScaleX, sizeof(_nnstate.windowScaleX));
+    hash = _nnHashBytes(hash, &_nnstate.windowScaleY, sizeof(_nnstate.windowScaleY));
+    for (int i = 0; i < region->widgetCount; i++)
+    {
+        hash = _nnHashCachedRegionWidget(hash, &region->widgets[i]);
+    }
+    return hash;
+}
 
-        // Determine item background color
-        nnColorf itemBgColor;
-        if (itemIndex == state->selectedIndex)
-        {
-            itemBgColor = _nnCurrentTheme.primaryColor; // Selected item color
-        }
-        else
-        {
-            itemBgColor = hovering ? _nnCurrentTheme.secondaryColorAccent : _nnCurrentTheme.secondaryColor;
-        }
+// Makes sure the framebuffer and texture of the given region match the region size in window pixels.
+static bool _nnPrepareCachedRegion(_nnCachedRegionState *region)
+{
+    int textureWidth = (int)ceilf(region->rect.width * _nnstate.windowScaleX);
+    int textureHeight = (int)ceilf(region->rect.height * _nnstate.windowScaleY);
+    if (textureWidth <= 0 || textureHeight <= 0)
+        return false;
 
-        // Draw item background
-        glBegin(GL_QUADS);
-        glColor4f(itemBgColor.r, itemBgColor.g, itemBgColor.b, itemBgColor.a);
-        glVertex2f(x, itemY);
-        glVertex2f(x + width - 1, itemY);
-        glVertex2f(x + width - 1, itemY + itemHeight);
-        glVertex2f(x, itemY + itemHeight);
-        glEnd();
+    if (region->framebuffer != 0 && region->textureWidth == textureWidth && region->textureHeight == textureHeight)
+        return true;
 
-        // Draw item text (truncate if necessary)
-        char truncatedText[256];
-        strncpy(truncatedText, items[itemIndex], sizeof(truncatedText) - 1);
-        truncatedText[sizeof(truncatedText) - 1] = '\0';
+    if (region->framebuffer == 0)
+    {
+        _nnGenFramebuffers(1, &region->framebuffer);
+        glGenTextures(1, &region->textureID);
+    }
 
-        float textWidth = nnTextWidth(truncatedText);
-        if (textWidth > width - 16) // Leave some padding
-        {
-            for (int j = strlen(truncatedText) - 1; j > 0; j--)
-            {
-                truncatedText[j] = '\0';
-                textWidth = nnTextWidth(truncatedText);
-                if (textWidth <= width - 16 - nnTextWidth("..."))
-                {
-                    strcat(truncatedText, "...");
-                    break;
-                }
-            }
-        }
+    region->textureWidth = textureWidth;
+    region->textureHeight = textureHeight;
 
-        int textX = x + 8; // Left-align with a margin of 8 pixels
-        int textY = itemY + (itemHeight - nnTextHeight()) / 2;
-        nnColorf textColor = _nnCurrentTheme.textPrimaryColor;
-        glColor4f(textColor.r, textColor.g, textColor.b, textColor.a);
-        nnDrawText(truncatedText, textX, textY);
+    glBindTexture(GL_TEXTURE_2D, region->textureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
 
-        // Handle item click
-        if (hovering && nnMouseReleased(0))
+    _nnBindFramebuffer(GL_FRAMEBUFFER, region->framebuffer);
+    _nnFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, region->textureID, 0);
+    bool complete = _nnCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    _nnBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete)
+    {
+        printf("Error: Failed to create framebuffer for cached gui region.\n");
+        _nnDeleteFramebuffers(1, &region->framebuffer);
+        glDeleteTextures(1, &region->textureID);
+        region->framebuffer = 0;
+        region->textureID = 0;
+        return false;
+    }
+    return true;
+}
+
+bool nnGuiBeginCached(unsigned int id, nnRecf rect)
+{
+    _nnFlushBatch();
+
+    if (_nnActiveCachedRegion)
+    {
+        printf("Error: Cached gui regions can not be nested.\n");
+        return true;
+    }
+
+    // Find or initialize cached region state
+    _nnCachedRegionState *state = NULL;
+    for (int i = 0; i < _nnCachedRegionStateCount; i++)
+    {
+        if (_nnCachedRegionStates[i].id == id)
         {
-            state->selectedIndex = itemIndex;
+            state = &_nnCachedRegionStates[i];
+            break;
         }
     }
-
-    // Handle scrolling with mouse wheel
-    bool hovering = nnPosRecOverlaps(mousePos.x, mousePos.y, (nnRecf){x, y, width, height});
-    int wheelDelta = nnMouseWheelDelta();
-    if (hovering && numItems > maxVisibleItems)
+    if (!state)
     {
-        if (wheelDelta > 0)
+        if (_nnCachedRegionStateCount >= _NN_MAX_CACHED_REGION_STATES)
         {
-            state->scrollOffset = (state->scrollOffset > 0) ? state->scrollOffset - 1 : 0;
+            printf("Error: Too many cached gui regions! Increase _NN_MAX_CACHED_REGION_STATES.\n");
+            return true;
         }
-        else if (wheelDelta < 0)
+        state = &_nnCachedRegionStates[_nnCachedRegionStateCount++];
+        memset(state, 0, sizeof(*state));
+        state->id = id;
+    }
+
+    // Open popups may reach outside of the region, so draw directly while one is open
+    if (_nnstate.isAnyPopupOpen || !_nnLoadFramebufferFuncs())
+    {
+        state->valid = false;
+        return true;
+    }
+
+    // Any input touching the region invalidates it, including the mouse leaving it (hover states change)
+    nnPos mousePos = nnMousePosition();
+    bool hovered = nnPosRecOverlaps(mousePos.x, mousePos.y, rect);
+    bool touched = hovered != state->wasHovered || _nnstate.anyKeyEvent;
+    if (hovered)
+    {
+        touched = touched || _nnstate.mouseMotionDelta.x != 0 || _nnstate.mouseMotionDelta.y != 0 || _nnstate.mouseWheelDelta != 0;
+        for (int button = 0; button < _NN_MAX_MOUSE_BUTTONS; button++)
         {
-            state->scrollOffset = (state->scrollOffset < numItems - maxVisibleItems) ? state->scrollOffset + 1 : state->scrollOffset;
+            touched = touched || _nnstate.mouseButtons[button] || _nnstate.mouseButtonsPressed[button] || _nnstate.mouseButtonsReleased[button];
         }
     }
+    state->wasHovered = hovered;
 
-    // Draw scrollbar if necessary
-    if (numItems > maxVisibleItems)
+    bool sameRect = memcmp(&state->rect, &rect, sizeof(nnRecf)) == 0;
+    state->rect = rect;
+
+    _nnActiveCachedRegion = state;
+    if (state->valid && !touched && sameRect && state->stateHash == _nnCachedRegionHash(state))
     {
-        float scrollbarHeight = (float)maxVisibleItems / numItems * height;
-        float scrollbarPosition = (float)state->scrollOffset / numItems * height;
-        int scrollbarX = x + width - 3; // 4px wide scrollbar at the right edge
-        int scrollbarY = y + scrollbarPosition;
+        _nnActiveCachedRegionRecording = false;
+        return false;
+    }
 
-        // Draw scrollbar
-        nnColorf scrollbarColor = _nnCurrentTheme.primaryColor;
-        glBegin(GL_QUADS);
-        glColor4f(scrollbarColor.r, scrollbarColor.g, scrollbarColor.b, scrollbarColor.a);
-        glVertex2f(scrollbarX, scrollbarY);
-        glVertex2f(scrollbarX + 3, scrollbarY);
-        glVertex2f(scrollbarX + 3, scrollbarY + scrollbarHeight);
-        glVertex2f(scrollbarX, scrollbarY + scrollbarHeight);
-        glEnd();
+    if (!_nnPrepareCachedRegion(state))
+    {
+        _nnActiveCachedRegion = NULL;
+        state->valid = false;
+        return true;
+    }
+
+    // Redirect rendering into the region's texture, mapping the region rect onto the whole texture
+    _nnActiveCachedRegionRecording = true;
+    state->widgetCount = 0;
+    state->tooManyWidgets = false;
+    _nnBindFramebuffer(GL_FRAMEBUFFER, state->framebuffer);
+    glPushAttrib(GL_VIEWPORT_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_SCISSOR_BIT);
+    glViewport(0, 0, state->textureWidth, state->textureHeight);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    _nnBlendAlpha();
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(rect.x, rect.x + rect.width, rect.y + rect.height, rect.y, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    return true;
+}
+
+void nnGuiEndCached()
+{
+    _nnFlushBatch();
+
+    _nnCachedRegionState *state = _nnActiveCachedRegion;
+    if (!state)
+        return;
+
+    _nnActiveCachedRegion = NULL;
+
+    if (_nnActiveCachedRegionRecording)
+    {
+        glMatrixMode(GL_PROJECTION);
+        glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+        glPopMatrix();
+        glPopAttrib();
+        _nnBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        _nnActiveCachedRegionRecording = false;
+        state->valid = !state->tooManyWidgets;
+
+        // Hashed after drawing, widgets may have changed their state while being drawn (e.g. a clicked checkbox)
+        state->stateHash = _nnCachedRegionHash(state);
     }
 
+    // Draw the cached texture. Its colors are premultiplied, since alpha was accumulated separately while recording.
+    nnRecf rect = state->rect;
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, state->textureID);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+    glBegin(GL_QUADS);
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    glTexCoord2f(0.0f, 1.0f);
+    glVertex2f(rect.x, rect.y);
+    glTexCoord2f(1.0f, 1.0f);
+    glVertex2f(rect.x + rect.width, rect.y);
+    glTexCoord2f(1.0f, 0.0f);
+    glVertex2f(rect.x + rect.width, rect.y + rect.height);
+    glTexCoord2f(0.0f, 0.0f);
+    glVertex2f(rect.x, rect.y + rect.height);
+    glEnd();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
     glDisable(GL_BLEND);
 
     nnSetColor(nnGetColor());
+}
 
-    return state->selectedIndex;
+void nnGuiInvalidateCached(unsigned int id)
+{
+    for (int i = 0; i < _nnCachedRegionStateCount; i++)
+    {
+        if (_nnCachedRegionStates[i].id == id)
+        {
+            _nnCachedRegionStates[i].valid = false;
+            return;
+        }
+    }
+}
+
+/*
+ * UI Atlas
+ */
+
+void nnSetUIAtlas(bool enabled)
+{
+    if (_nnAtlasPageCount > 0)
+    {
+        printf("Error: nnSetUIAtlas must be called before any font is loaded or text is drawn.\n");
+        return;
+    }
+
+    _nnUIAtlas = enabled;
+}
+
+// Packs decoded image data into the UI atlas, without printing errors
+static nnAtlasImage _nnLoadAtlasImageData(const unsigned char *data, size_t size)
+{
+    nnAtlasImage image = {-1, 0, 0, 0, 0};
+    if (!_nnUIAtlas || size > 0x7fffffff)
+        return image;
+
+    int width, height;
+    unsigned char *pixels = stbi_load_from_memory(data, (int)size, &width, &height, 0, 4);
+    if (!pixels)
+        return image;
+
+    // The rectangle has a one pixel gap on every side, so filtering does not bleed into neighbouring glyphs and images
+    int x, y;
+    int pageIndex = width + 2 <= _NN_FONT_ATLAS_MAX_PAGE_SIZE && height + 2 <= _NN_FONT_ATLAS_MAX_PAGE_SIZE ? _nnAtlasAlloc(width + 2, height + 2, &x, &y) : -1;
+    if (pageIndex >= 0)
+    {
+        _nnAtlasUploadRGBA(pageIndex, x + 1, y + 1, width, height, pixels);
+        image = (nnAtlasImage){pageIndex, x + 1, y + 1, width, height};
+    }
+
+    stbi_image_free(pixels);
+    return image;
+}
+
+nnAtlasImage nnLoadAtlasImage(const char *filepath)
+{
+    nnFileView view;
+    nnAtlasImage image = {-1, 0, 0, 0, 0};
+    if (_nnMapFile(filepath, &view))
+    {
+        image = _nnLoadAtlasImageData(view.data, view.size);
+        _nnUnmapFile(&view);
+    }
+
+    if (image.page < 0)
+        printf("Failed to load atlas image (is the UI atlas enabled?):\n%s\n", filepath);
+
+    return image;
+}
+
+nnAtlasImage nnLoadAtlasImageMem(const unsigned char *data, int size)
+{
+    nnAtlasImage image = _nnLoadAtlasImageData(data, size > 0 ? size : 0);
+    if (image.page < 0)
+        printf("Failed to load atlas image from memory (is the UI atlas enabled?)\n");
+
+    return image;
+}
+
+void nnDrawAtlasImage(nnAtlasImage image, int x, int y)
+{
+    if (image.page < 0 || image.page >= _nnAtlasPageCount)
+    {
+        printf("Failed to draw atlas image\n");
+        return;
+    }
+
+    float color[4];
+    glGetFloatv(GL_CURRENT_COLOR, color);
+
+    // Pages may have grown since the image was loaded, so texture coordinates are computed from the current page size
+    _nnAtlasPage *page = &_nnAtlasPages[image.page];
+    _nnBeginBatchedDraw();
+    _nnBatchQuad(page->textureID, false, x, y, x + image.width, y + image.height, image.x / (float)page->width, image.y / (float)page->height,
+                 (image.x + image.width) / (float)page->width, (image.y + image.height) / (float)page->height, 0, color);
+    _nnEndBatchedDraw();
 }
 
 #endif // NONOGL_IMPLEMENTATION
\ No newline at end of file
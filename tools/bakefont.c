@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../nonogl/internal/include/stb_truetype.h"
+
+//
+// Packs the ASCII glyphs of a font into an atlas and writes it as a header, so the atlas can be uploaded without rasterizing at runtime.
+// NonoGL uses it to generate internal/include/default_font_atlas.h from the embedded Roboto font:
+//     bakefont Roboto-Regular.ttf 24 ../nonogl/internal/include/default_font_atlas.h
+//
+// To build it run:
+//     gcc bakefont.c -o bakefont.exe -std=c99 -O3 -march=native -funroll-loops -flto -fomit-frame-pointer -lm
+//
+
+#define BAKEFONT_FIRST_CHAR 32
+#define BAKEFONT_CHAR_COUNT 96
+#define BAKEFONT_MAX_ATLAS_SIZE 4096
+
+// Function to read a whole file into memory
+unsigned char *readFile(const char *path, long *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening %s\n", path);
+        exit(1);
+    }
+
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *data = malloc(*size);
+    if (data == NULL || fread(data, 1, *size, file) != (size_t)*size)
+    {
+        fprintf(stderr, "Error reading %s\n", path);
+        exit(1);
+    }
+
+    fclose(file);
+    return data;
+}
+
+// Function to format a float as a C float literal
+const char *floatLiteral(float value, char *buffer, size_t bufferSize)
+{
+    snprintf(buffer, bufferSize, "%.9g", value);
+    if (strpbrk(buffer, ".e") == NULL)
+        strcat(buffer, ".0");
+    strcat(buffer, "f");
+    return buffer;
+}
+
+// Function to pack the glyphs into the smallest power of two atlas they fit in
+unsigned char *packAtlas(const unsigned char *fontData, float pixelHeight, stbtt_packedchar *charData, int *outWidth, int *outHeight)
+{
+    for (int width = 64; width <= BAKEFONT_MAX_ATLAS_SIZE; width *= 2)
+    {
+        for (int height = width / 2; height <= width; height *= 2)
+        {
+            unsigned char *bitmap = calloc(1, (size_t)width * height);
+            if (bitmap == NULL)
+            {
+                fprintf(stderr, "Error allocating memory for a %dx%d atlas\n", width, height);
+                exit(1);
+            }
+
+            stbtt_pack_context context;
+            stbtt_pack_range range = {.font_size = pixelHeight,
+                                      .first_unicode_codepoint_in_range = BAKEFONT_FIRST_CHAR,
+                                      .num_chars = BAKEFONT_CHAR_COUNT,
+                                      .chardata_for_range = charData};
+            int packed = 0;
+            if (stbtt_PackBegin(&context, bitmap, width, height, 0, 1, NULL))
+            {
+                packed = stbtt_PackFontRanges(&context, fontData, 0, &range, 1);
+                stbtt_PackEnd(&context);
+            }
+
+            if (packed)
+            {
+                *outWidth = width;
+                *outHeight = height;
+                return bitmap;
+            }
+
+            free(bitmap);
+        }
+    }
+
+    fprintf(stderr, "Error: the glyphs do not fit into a %dx%d atlas\n", BAKEFONT_MAX_ATLAS_SIZE, BAKEFONT_MAX_ATLAS_SIZE);
+    exit(1);
+}
+
+// Function to bake a font and write the atlas header
+void bakeFont(const char *inputFilePath, float pixelHeight, const char *outputFilePath)
+{
+    long fontSize;
+    unsigned char *fontData = readFile(inputFilePath, &fontSize);
+
+    stbtt_packedchar charData[BAKEFONT_CHAR_COUNT];
+    int width, height;
+    unsigned char *bitmap = packAtlas(fontData, pixelHeight, charData, &width, &height);
+
+    FILE *outputFile = fopen(outputFilePath, "w");
+    if (outputFile == NULL)
+    {
+        fprintf(stderr, "Error creating %s\n", outputFilePath);
+        exit(1);
+    }
+
+    fprintf(outputFile, "#ifndef _NN_DEFAULT_FONT_ATLAS_H\n#define _NN_DEFAULT_FONT_ATLAS_H\n\n");
+    fprintf(outputFile, "// Generated by tools/bakefont.c, do not edit\n\n");
+    fprintf(outputFile, "#define _NN_DEFAULT_FONT_SIZE %g\n", pixelHeight);
+    fprintf(outputFile, "#define _NN_DEFAULT_FONT_ATLAS_WIDTH %d\n", width);
+    fprintf(outputFile, "#define _NN_DEFAULT_FONT_ATLAS_HEIGHT %d\n\n", height);
+
+    fprintf(outputFile, "static const stbtt_packedchar _nnDefaultFontCharData[%d] = {\n", BAKEFONT_CHAR_COUNT);
+    for (int i = 0; i < BAKEFONT_CHAR_COUNT; i++)
+    {
+        stbtt_packedchar *c = &charData[i];
+        char xoff[32], yoff[32], xadvance[32], xoff2[32], yoff2[32];
+        fprintf(outputFile, "    {%d, %d, %d, %d, %s, %s, %s, %s, %s},\n", c->x0, c->y0, c->x1, c->y1,
+                floatLiteral(c->xoff, xoff, sizeof(xoff) - 3), floatLiteral(c->yoff, yoff, sizeof(yoff) - 3), floatLiteral(c->xadvance, xadvance, sizeof(xadvance) - 3),
+                floatLiteral(c->xoff2, xoff2, sizeof(xoff2) - 3), floatLiteral(c->yoff2, yoff2, sizeof(yoff2) - 3));
+    }
+    fprintf(outputFile, "};\n\n");
+
+    fprintf(outputFile, "static const unsigned char _nnDefaultFontAtlas[%d] = {\n", width * height);
+    for (int i = 0; i < width * height; i++)
+    {
+        fprintf(outputFile, "%d,", bitmap[i]);
+        if (i % 64 == 63)
+            fprintf(outputFile, "\n");
+    }
+    fprintf(outputFile, "};\n\n#endif // _NN_DEFAULT_FONT_ATLAS_H\n");
+
+    if (ferror(outputFile))
+    {
+        fprintf(stderr, "Error writing %s\n", outputFilePath);
+        exit(1);
+    }
+
+    printf("%s: %d glyphs at %g px in a %dx%d atlas\n", outputFilePath, BAKEFONT_CHAR_COUNT, pixelHeight, width, height);
+
+    fclose(outputFile);
+    free(bitmap);
+    free(fontData);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 4 || atof(argv[2]) <= 0.0)
+    {
+        fprintf(stderr, "Usage: %s <input .ttf> <pixel height> <output .h>\n", argv[0]);
+        return 1;
+    }
+
+    bakeFont(argv[1], (float)atof(argv[2]), argv[3]);
+    return 0;
+}
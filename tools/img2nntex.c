@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "../nonogl/internal/include/stb_image.h"
+
+//
+// Converts an image (PNG, JPG, TGA, BMP, ...) to a .nntex file, which nnLoadImage maps and uploads without decoding
+//
+// To build it run:
+//     gcc img2nntex.c -o img2nntex.exe -std=c99 -O3 -march=native -funroll-loops -flto -fomit-frame-pointer -lm
+//
+// The .nntex format (all values are little-endian 32 bit unsigned integers):
+//     magic       "NNTX"
+//     version     1
+//     width       Width of the first mip level
+//     height      Height of the first mip level
+//     format      1 = RGBA8
+//     mipLevels   Number of mip levels (1 = no mip chain)
+//     dataOffset  Offset of the payload from the start of the file (32)
+//     reserved    0
+// The payload holds the mip levels from largest to smallest, each tightly packed with max(1, width >> level) x max(1, height >> level) pixels.
+//
+
+#define NNTEX_HEADER_SIZE 32
+#define NNTEX_FORMAT_RGBA8 1
+
+// Function to write a 32 bit unsigned integer in little-endian byte order
+void writeUint32(FILE *file, unsigned int value)
+{
+    unsigned char bytes[4] = {value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff};
+    fwrite(bytes, 1, 4, file);
+}
+
+// Function to halve an RGBA8 image with a box filter (dimensions are clamped to 1)
+unsigned char *downsample(const unsigned char *pixels, int width, int height, int *outWidth, int *outHeight)
+{
+    int newWidth = width > 1 ? width / 2 : 1;
+    int newHeight = height > 1 ? height / 2 : 1;
+    unsigned char *result = malloc((size_t)newWidth * newHeight * 4);
+    if (!result)
+    {
+        fprintf(stderr, "Error allocating memory for mip level\n");
+        exit(1);
+    }
+
+    for (int y = 0; y < newHeight; y++)
+    {
+        for (int x = 0; x < newWidth; x++)
+        {
+            int x0 = x * 2 < width ? x * 2 : width - 1;
+            int y0 = y * 2 < height ? y * 2 : height - 1;
+            int x1 = x0 + 1 < width ? x0 + 1 : x0;
+            int y1 = y0 + 1 < height ? y0 + 1 : y0;
+            for (int c = 0; c < 4; c++)
+            {
+                int sum = pixels[((size_t)y0 * width + x0) * 4 + c] + pixels[((size_t)y0 * width + x1) * 4 + c] +
+                          pixels[((size_t)y1 * width + x0) * 4 + c] + pixels[((size_t)y1 * width + x1) * 4 + c];
+                result[((size_t)y * newWidth + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+            }
+        }
+    }
+
+    *outWidth = newWidth;
+    *outHeight = newHeight;
+    return result;
+}
+
+// Function to convert an image to a .nntex file
+void convertImageToNNTex(const char *inputFilePath, const char *outputFilePath, int generateMips)
+{
+    int width, height;
+    unsigned char *pixels = stbi_load(inputFilePath, &width, &height, 0, 4);
+    if (pixels == NULL)
+    {
+        fprintf(stderr, "Error loading %s: %s\n", inputFilePath, stbi_failure_reason());
+        exit(1);
+    }
+
+    FILE *outputFile = fopen(outputFilePath, "wb");
+    if (outputFile == NULL)
+    {
+        fprintf(stderr, "Error creating %s\n", outputFilePath);
+        exit(1);
+    }
+
+    unsigned int mipLevels = 1;
+    if (generateMips)
+    {
+        for (int size = width > height ? width : height; size > 1; size /= 2)
+            mipLevels++;
+    }
+
+    // Header
+    fwrite("NNTX", 1, 4, outputFile);
+    writeUint32(outputFile, 1);
+    writeUint32(outputFile, width);
+    writeUint32(outputFile, height);
+    writeUint32(outputFile, NNTEX_FORMAT_RGBA8);
+    writeUint32(outputFile, mipLevels);
+    writeUint32(outputFile, NNTEX_HEADER_SIZE);
+    writeUint32(outputFile, 0);
+
+    // Payload
+    unsigned char *level = pixels;
+    int levelWidth = width, levelHeight = height;
+    for (unsigned int i = 0; i < mipLevels; i++)
+    {
+        fwrite(level, 1, (size_t)levelWidth * levelHeight * 4, outputFile);
+        if (i + 1 < mipLevels)
+        {
+            unsigned char *next = downsample(level, levelWidth, levelHeight, &levelWidth, &levelHeight);
+            if (level != pixels)
+                free(level);
+            level = next;
+        }
+    }
+    if (level != pixels)
+        free(level);
+
+    if (ferror(outputFile))
+    {
+        fprintf(stderr, "Error writing %s\n", outputFilePath);
+        exit(1);
+    }
+
+    printf("%s: %dx%d, %u mip level(s)\n", outputFilePath, width, height, mipLevels);
+
+    fclose(outputFile);
+    stbi_image_free(pixels);
+}
+
+int main(int argc, char **argv)
+{
+    int generateMips = argc == 4 && strcmp(argv[1], "-mips") == 0;
+    if (argc != 3 && !generateMips)
+    {
+        fprintf(stderr, "Usage: %s [-mips] <input image> <output .nntex>\n", argv[0]);
+        return 1;
+    }
+
+    convertImageToNNTex(argv[argc - 2], argv[argc - 1], generateMips);
+    return 0;
+}
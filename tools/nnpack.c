@@ -0,0 +1,236 @@
+// 64 bit file offsets for ftello, so files over 2GB are sized correctly where long is 32 bit
+#ifndef _WIN32
+#define _FILE_OFFSET_BITS 64
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Packs files into a .nnpack archive, which nnOpenArchive maps into memory so the files can be used without being read or copied
+//
+// To build it run:
+//     gcc nnpack.c -o nnpack.exe -std=c99 -O3 -march=native -funroll-loops -flto -fomit-frame-pointer
+//
+// The .nnpack format (all values are little-endian unsigned integers):
+//     magic             "NNPK"
+//     version           1 (32 bit)
+//     fileCount         Number of files (32 bit)
+//     stringTableSize   Size of the string table in bytes (32 bit)
+//     table of contents fileCount entries sorted by name, each with:
+//                           nameOffset  Offset of the name in the string table (32 bit)
+//                           nameLength  Length of the name without the terminating zero (32 bit)
+//                           dataOffset  Offset of the file data from the start of the archive (64 bit)
+//                           size        Size of the file data (64 bit)
+//     string table      Zero terminated file names
+//     file data         Every file starts at a multiple of 16 bytes
+//
+
+#define NNPACK_HEADER_SIZE 16
+#define NNPACK_ENTRY_SIZE 24
+#define NNPACK_ALIGNMENT 16
+
+typedef struct
+{
+    const char *path;         // Path of the file to pack
+    char name[256];           // Name of the file inside the archive
+    unsigned long long size;  // Size of the file
+    unsigned long long offset; // Offset of the file data inside the archive
+} PackEntry;
+
+// Function to write a little-endian unsigned integer with the given number of bytes
+void writeUint(FILE *file, unsigned long long value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        fputc((int)((value >> (i * 8)) & 0xff), file);
+    }
+}
+
+// Function to write zeros until the file position is a multiple of NNPACK_ALIGNMENT
+void writePadding(FILE *file, unsigned long long position)
+{
+    while (position % NNPACK_ALIGNMENT != 0)
+    {
+        fputc(0, file);
+        position++;
+    }
+}
+
+// Function to compare pack entries by name for qsort
+int compareEntries(const void *a, const void *b)
+{
+    return strcmp(((const PackEntry *)a)->name, ((const PackEntry *)b)->name);
+}
+
+// Function to turn a path into an archive name: forward slashes and no leading "./"
+void makeEntryName(const char *path, char *name, size_t nameSize)
+{
+    while (strncmp(path, "./", 2) == 0 || strncmp(path, ".\\", 2) == 0)
+        path += 2;
+
+    if (strlen(path) >= nameSize)
+    {
+        fprintf(stderr, "Error: path too long: %s\n", path);
+        exit(1);
+    }
+
+    strcpy(name, path);
+    for (int i = 0; name[i]; i++)
+    {
+        if (name[i] == '\\')
+            name[i] = '/';
+    }
+}
+
+// Function to get the size of a file. ftell returns a long, which is 32 bit on Windows.
+unsigned long long getFileSize(FILE *file, const char *path)
+{
+#ifdef _WIN32
+    long long size = _fseeki64(file, 0, SEEK_END) == 0 ? _ftelli64(file) : -1;
+#else
+    long long size = fseeko(file, 0, SEEK_END) == 0 ? (long long)ftello(file) : -1;
+#endif
+    if (size < 0)
+    {
+        fprintf(stderr, "Error getting the size of %s\n", path);
+        exit(1);
+    }
+    return (unsigned long long)size;
+}
+
+// Function to pack the given files into an archive
+void packFiles(const char *outputFilePath, const char **inputFilePaths, int fileCount)
+{
+    PackEntry *entries = calloc(fileCount, sizeof(PackEntry));
+    if (entries == NULL)
+    {
+        fprintf(stderr, "Error allocating memory for %d files\n", fileCount);
+        exit(1);
+    }
+
+    // Collect names and sizes
+    unsigned long long stringTableSize = 0;
+    for (int i = 0; i < fileCount; i++)
+    {
+        entries[i].path = inputFilePaths[i];
+        makeEntryName(inputFilePaths[i], entries[i].name, sizeof(entries[i].name));
+
+        FILE *inputFile = fopen(entries[i].path, "rb");
+        if (inputFile == NULL)
+        {
+            fprintf(stderr, "Error opening %s\n", entries[i].path);
+            exit(1);
+        }
+        entries[i].size = getFileSize(inputFile, entries[i].path);
+        fclose(inputFile);
+
+        stringTableSize += strlen(entries[i].name) + 1;
+    }
+
+    qsort(entries, fileCount, sizeof(PackEntry), compareEntries);
+    for (int i = 1; i < fileCount; i++)
+    {
+        if (strcmp(entries[i - 1].name, entries[i].name) == 0)
+        {
+            fprintf(stderr, "Error: %s is packed twice\n", entries[i].name);
+            exit(1);
+        }
+    }
+
+    // Lay out the file data
+    unsigned long long offset = NNPACK_HEADER_SIZE + (unsigned long long)fileCount * NNPACK_ENTRY_SIZE + stringTableSize;
+    for (int i = 0; i < fileCount; i++)
+    {
+        offset = (offset + NNPACK_ALIGNMENT - 1) / NNPACK_ALIGNMENT * NNPACK_ALIGNMENT;
+        entries[i].offset = offset;
+        offset += entries[i].size;
+    }
+
+    FILE *outputFile = fopen(outputFilePath, "wb");
+    if (outputFile == NULL)
+    {
+        fprintf(stderr, "Error creating %s\n", outputFilePath);
+        exit(1);
+    }
+
+    // Header
+    fwrite("NNPK", 1, 4, outputFile);
+    writeUint(outputFile, 1, 4);
+    writeUint(outputFile, fileCount, 4);
+    writeUint(outputFile, stringTableSize, 4);
+
+    // Table of contents
+    unsigned long long nameOffset = 0;
+    for (int i = 0; i < fileCount; i++)
+    {
+        size_t nameLength = strlen(entries[i].name);
+        writeUint(outputFile, nameOffset, 4);
+        writeUint(outputFile, nameLength, 4);
+        writeUint(outputFile, entries[i].offset, 8);
+        writeUint(outputFile, entries[i].size, 8);
+        nameOffset += nameLength + 1;
+    }
+
+    // String table
+    for (int i = 0; i < fileCount; i++)
+    {
+        fwrite(entries[i].name, 1, strlen(entries[i].name) + 1, outputFile);
+    }
+
+    // File data
+    unsigned long long position = NNPACK_HEADER_SIZE + (unsigned long long)fileCount * NNPACK_ENTRY_SIZE + stringTableSize;
+    unsigned char buffer[64 * 1024];
+    for (int i = 0; i < fileCount; i++)
+    {
+        writePadding(outputFile, position);
+        position = entries[i].offset;
+
+        FILE *inputFile = fopen(entries[i].path, "rb");
+        if (inputFile == NULL)
+        {
+            fprintf(stderr, "Error opening %s\n", entries[i].path);
+            exit(1);
+        }
+        size_t bytesRead;
+        unsigned long long written = 0;
+        while ((bytesRead = fread(buffer, 1, sizeof(buffer), inputFile)) > 0)
+        {
+            fwrite(buffer, 1, bytesRead, outputFile);
+            written += bytesRead;
+        }
+        fclose(inputFile);
+
+        if (written != entries[i].size)
+        {
+            fprintf(stderr, "Error: %s changed while packing\n", entries[i].path);
+            exit(1);
+        }
+        position += written;
+    }
+
+    if (ferror(outputFile))
+    {
+        fprintf(stderr, "Error writing %s\n", outputFilePath);
+        exit(1);
+    }
+
+    printf("%s: %d file(s), %llu bytes\n", outputFilePath, fileCount, position);
+
+    fclose(outputFile);
+    free(entries);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <output .nnpack> <input file>...\n", argv[0]);
+        return 1;
+    }
+
+    packFiles(argv[1], (const char **)argv + 2, argc - 2);
+    return 0;
+}